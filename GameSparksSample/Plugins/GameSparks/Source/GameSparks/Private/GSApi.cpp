@@ -1,5 +1,7 @@
 #include "GSApi.h"
 #include "GameSparksPrivatePCH.h"
+#include "GameSparksProxyPool.h"
+#include "GameSparksStats.h"
 
 
 void AcceptChallengeRequestResponseCallback(GameSparks::Core::GS& gsInstance, const GameSparks::Api::Responses::AcceptChallengeResponse& response){
@@ -8,7 +10,7 @@ void AcceptChallengeRequestResponseCallback(GameSparks::Core::GS& gsInstance, co
     	return;
     }
     
-    FGSAcceptChallengeResponse unreal_response = FGSAcceptChallengeResponse(response.GetBaseData());
+    FGSAcceptChallengeResponse unreal_response = ToUnrealStruct<FGSAcceptChallengeResponse>(response);
     
     UGSAcceptChallengeRequest* g_UGSAcceptChallengeRequest = static_cast<UGSAcceptChallengeRequest*>(response.GetUserData());
                                              
@@ -96,7 +98,7 @@ void AccountDetailsRequestResponseCallback(GameSparks::Core::GS& gsInstance, con
     	return;
     }
     
-    FGSAccountDetailsResponse unreal_response = FGSAccountDetailsResponse(response.GetBaseData());
+    FGSAccountDetailsResponse unreal_response = ToUnrealStruct<FGSAccountDetailsResponse>(response);
     
     UGSAccountDetailsRequest* g_UGSAccountDetailsRequest = static_cast<UGSAccountDetailsRequest*>(response.GetUserData());
                                              
@@ -174,7 +176,7 @@ void AmazonBuyGoodsRequestResponseCallback(GameSparks::Core::GS& gsInstance, con
     	return;
     }
     
-    FGSBuyVirtualGoodResponse unreal_response = FGSBuyVirtualGoodResponse(response.GetBaseData());
+    FGSBuyVirtualGoodResponse unreal_response = ToUnrealStruct<FGSBuyVirtualGoodResponse>(response);
     
     UGSAmazonBuyGoodsRequest* g_UGSAmazonBuyGoodsRequest = static_cast<UGSAmazonBuyGoodsRequest*>(response.GetUserData());
                                              
@@ -277,7 +279,7 @@ void AmazonConnectRequestResponseCallback(GameSparks::Core::GS& gsInstance, cons
     	return;
     }
     
-    FGSAuthenticationResponse unreal_response = FGSAuthenticationResponse(response.GetBaseData());
+    FGSAuthenticationResponse unreal_response = ToUnrealStruct<FGSAuthenticationResponse>(response);
     
     UGSAmazonConnectRequest* g_UGSAmazonConnectRequest = static_cast<UGSAmazonConnectRequest*>(response.GetUserData());
                                              
@@ -390,7 +392,7 @@ void AnalyticsRequestResponseCallback(GameSparks::Core::GS& gsInstance, const Ga
     	return;
     }
     
-    FGSAnalyticsResponse unreal_response = FGSAnalyticsResponse(response.GetBaseData());
+    FGSAnalyticsResponse unreal_response = ToUnrealStruct<FGSAnalyticsResponse>(response);
     
     UGSAnalyticsRequest* g_UGSAnalyticsRequest = static_cast<UGSAnalyticsRequest*>(response.GetUserData());
                                              
@@ -402,11 +404,13 @@ void AnalyticsRequestResponseCallback(GameSparks::Core::GS& gsInstance, const Ga
     {
         g_UGSAnalyticsRequest->OnResponse.Broadcast(unreal_response, false);
     }
+
+    TGameSparksProxyPool<UGSAnalyticsRequest>::Release(g_UGSAnalyticsRequest);
 }
 
 UGSAnalyticsRequest* UGSAnalyticsRequest::SendAnalyticsRequest(UGameSparksScriptData* Data, bool End, FString Key, bool Start,  UGameSparksScriptData* ScriptData, bool Durable, int32 RequestTimeoutSeconds)
 {
-	UGSAnalyticsRequest* proxy = NewObject<UGSAnalyticsRequest>();
+	UGSAnalyticsRequest* proxy = TGameSparksProxyPool<UGSAnalyticsRequest>::Acquire();
 	proxy->data = Data;
 	proxy->end = End;
 	proxy->key = Key;
@@ -419,7 +423,7 @@ UGSAnalyticsRequest* UGSAnalyticsRequest::SendAnalyticsRequest(UGameSparksScript
 
 UGSAnalyticsRequest* UGSAnalyticsRequest::SendAnalyticsRequestOnBehalfOf(const FString& PlayerId, UGameSparksScriptData* Data, bool End, FString Key, bool Start,  UGameSparksScriptData* ScriptData, bool Durable, int32 RequestTimeoutSeconds)
 {
-	UGSAnalyticsRequest* proxy = NewObject<UGSAnalyticsRequest>();
+	UGSAnalyticsRequest* proxy = TGameSparksProxyPool<UGSAnalyticsRequest>::Acquire();
 	proxy->data = Data;
 	proxy->end = End;
 	proxy->key = Key;
@@ -481,6 +485,13 @@ UGSAnalyticsRequest::~UGSAnalyticsRequest()
  }
 }
 
+void UGSAnalyticsRequest::ResetForReuse()
+{
+	data = nullptr;
+	scriptData = nullptr;
+	playerId = FString();
+}
+
 
 void AroundMeLeaderboardRequestResponseCallback(GameSparks::Core::GS& gsInstance, const GameSparks::Api::Responses::AroundMeLeaderboardResponse& response){
     
@@ -488,7 +499,7 @@ void AroundMeLeaderboardRequestResponseCallback(GameSparks::Core::GS& gsInstance
     	return;
     }
     
-    FGSAroundMeLeaderboardResponse unreal_response = FGSAroundMeLeaderboardResponse(response.GetBaseData());
+    FGSAroundMeLeaderboardResponse unreal_response = ToUnrealStruct<FGSAroundMeLeaderboardResponse>(response);
     
     UGSAroundMeLeaderboardRequest* g_UGSAroundMeLeaderboardRequest = static_cast<UGSAroundMeLeaderboardRequest*>(response.GetUserData());
                                              
@@ -647,7 +658,7 @@ void AuthenticationRequestResponseCallback(GameSparks::Core::GS& gsInstance, con
     	return;
     }
     
-    FGSAuthenticationResponse unreal_response = FGSAuthenticationResponse(response.GetBaseData());
+    FGSAuthenticationResponse unreal_response = ToUnrealStruct<FGSAuthenticationResponse>(response);
     
     UGSAuthenticationRequest* g_UGSAuthenticationRequest = static_cast<UGSAuthenticationRequest*>(response.GetUserData());
                                              
@@ -735,7 +746,7 @@ void BatchAdminRequestResponseCallback(GameSparks::Core::GS& gsInstance, const G
     	return;
     }
     
-    FGSBatchAdminResponse unreal_response = FGSBatchAdminResponse(response.GetBaseData());
+    FGSBatchAdminResponse unreal_response = ToUnrealStruct<FGSBatchAdminResponse>(response);
     
     UGSBatchAdminRequest* g_UGSBatchAdminRequest = static_cast<UGSBatchAdminRequest*>(response.GetUserData());
                                              
@@ -815,7 +826,7 @@ void BuyVirtualGoodsRequestResponseCallback(GameSparks::Core::GS& gsInstance, co
     	return;
     }
     
-    FGSBuyVirtualGoodResponse unreal_response = FGSBuyVirtualGoodResponse(response.GetBaseData());
+    FGSBuyVirtualGoodResponse unreal_response = ToUnrealStruct<FGSBuyVirtualGoodResponse>(response);
     
     UGSBuyVirtualGoodsRequest* g_UGSBuyVirtualGoodsRequest = static_cast<UGSBuyVirtualGoodsRequest*>(response.GetUserData());
                                              
@@ -913,7 +924,7 @@ void CancelBulkJobAdminRequestResponseCallback(GameSparks::Core::GS& gsInstance,
     	return;
     }
     
-    FGSCancelBulkJobAdminResponse unreal_response = FGSCancelBulkJobAdminResponse(response.GetBaseData());
+    FGSCancelBulkJobAdminResponse unreal_response = ToUnrealStruct<FGSCancelBulkJobAdminResponse>(response);
     
     UGSCancelBulkJobAdminRequest* g_UGSCancelBulkJobAdminRequest = static_cast<UGSCancelBulkJobAdminRequest*>(response.GetUserData());
                                              
@@ -989,7 +1000,7 @@ void ChangeUserDetailsRequestResponseCallback(GameSparks::Core::GS& gsInstance,
     	return;
     }
     
-    FGSChangeUserDetailsResponse unreal_response = FGSChangeUserDetailsResponse(response.GetBaseData());
+    FGSChangeUserDetailsResponse unreal_response = ToUnrealStruct<FGSChangeUserDetailsResponse>(response);
     
     UGSChangeUserDetailsRequest* g_UGSChangeUserDetailsRequest = static_cast<UGSChangeUserDetailsRequest*>(response.GetUserData());
                                              
@@ -1092,7 +1103,7 @@ void ChatOnChallengeRequestResponseCallback(GameSparks::Core::GS& gsInstance, co
     	return;
     }
     
-    FGSChatOnChallengeResponse unreal_response = FGSChatOnChallengeResponse(response.GetBaseData());
+    FGSChatOnChallengeResponse unreal_response = ToUnrealStruct<FGSChatOnChallengeResponse>(response);
     
     UGSChatOnChallengeRequest* g_UGSChatOnChallengeRequest = static_cast<UGSChatOnChallengeRequest*>(response.GetUserData());
                                              
@@ -1180,7 +1191,7 @@ void ConsumeVirtualGoodRequestResponseCallback(GameSparks::Core::GS& gsInstance,
     	return;
     }
     
-    FGSConsumeVirtualGoodResponse unreal_response = FGSConsumeVirtualGoodResponse(response.GetBaseData());
+    FGSConsumeVirtualGoodResponse unreal_response = ToUnrealStruct<FGSConsumeVirtualGoodResponse>(response);
     
     UGSConsumeVirtualGoodRequest* g_UGSConsumeVirtualGoodRequest = static_cast<UGSConsumeVirtualGoodRequest*>(response.GetUserData());
                                              
@@ -1268,7 +1279,7 @@ void CreateChallengeRequestResponseCallback(GameSparks::Core::GS& gsInstance, co
     	return;
     }
     
-    FGSCreateChallengeResponse unreal_response = FGSCreateChallengeResponse(response.GetBaseData());
+    FGSCreateChallengeResponse unreal_response = ToUnrealStruct<FGSCreateChallengeResponse>(response);
     
     UGSCreateChallengeRequest* g_UGSCreateChallengeRequest = static_cast<UGSCreateChallengeRequest*>(response.GetUserData());
                                              
@@ -1453,7 +1464,7 @@ void CreateTeamRequestResponseCallback(GameSparks::Core::GS& gsInstance, const G
     	return;
     }
     
-    FGSCreateTeamResponse unreal_response = FGSCreateTeamResponse(response.GetBaseData());
+    FGSCreateTeamResponse unreal_response = ToUnrealStruct<FGSCreateTeamResponse>(response);
     
     UGSCreateTeamRequest* g_UGSCreateTeamRequest = static_cast<UGSCreateTeamRequest*>(response.GetUserData());
                                              
@@ -1546,7 +1557,7 @@ void DeclineChallengeRequestResponseCallback(GameSparks::Core::GS& gsInstance, c
     	return;
     }
     
-    FGSDeclineChallengeResponse unreal_response = FGSDeclineChallengeResponse(response.GetBaseData());
+    FGSDeclineChallengeResponse unreal_response = ToUnrealStruct<FGSDeclineChallengeResponse>(response);
     
     UGSDeclineChallengeRequest* g_UGSDeclineChallengeRequest = static_cast<UGSDeclineChallengeRequest*>(response.GetUserData());
                                              
@@ -1634,7 +1645,7 @@ void DeviceAuthenticationRequestResponseCallback(GameSparks::Core::GS& gsInstanc
     	return;
     }
     
-    FGSAuthenticationResponse unreal_response = FGSAuthenticationResponse(response.GetBaseData());
+    FGSAuthenticationResponse unreal_response = ToUnrealStruct<FGSAuthenticationResponse>(response);
     
     UGSDeviceAuthenticationRequest* g_UGSDeviceAuthenticationRequest = static_cast<UGSDeviceAuthenticationRequest*>(response.GetUserData());
                                              
@@ -1752,7 +1763,7 @@ void DismissMessageRequestResponseCallback(GameSparks::Core::GS& gsInstance, con
     	return;
     }
     
-    FGSDismissMessageResponse unreal_response = FGSDismissMessageResponse(response.GetBaseData());
+    FGSDismissMessageResponse unreal_response = ToUnrealStruct<FGSDismissMessageResponse>(response);
     
     UGSDismissMessageRequest* g_UGSDismissMessageRequest = static_cast<UGSDismissMessageRequest*>(response.GetUserData());
                                              
@@ -1835,7 +1846,7 @@ void DismissMultipleMessagesRequestResponseCallback(GameSparks::Core::GS& gsInst
     	return;
     }
     
-    FGSDismissMultipleMessagesResponse unreal_response = FGSDismissMultipleMessagesResponse(response.GetBaseData());
+    FGSDismissMultipleMessagesResponse unreal_response = ToUnrealStruct<FGSDismissMultipleMessagesResponse>(response);
     
     UGSDismissMultipleMessagesRequest* g_UGSDismissMultipleMessagesRequest = static_cast<UGSDismissMultipleMessagesRequest*>(response.GetUserData());
                                              
@@ -1925,7 +1936,7 @@ void DropTeamRequestResponseCallback(GameSparks::Core::GS& gsInstance, const Gam
     	return;
     }
     
-    FGSDropTeamResponse unreal_response = FGSDropTeamResponse(response.GetBaseData());
+    FGSDropTeamResponse unreal_response = ToUnrealStruct<FGSDropTeamResponse>(response);
     
     UGSDropTeamRequest* g_UGSDropTeamRequest = static_cast<UGSDropTeamRequest*>(response.GetUserData());
                                              
@@ -2018,7 +2029,7 @@ void EndSessionRequestResponseCallback(GameSparks::Core::GS& gsInstance, const G
     	return;
     }
     
-    FGSEndSessionResponse unreal_response = FGSEndSessionResponse(response.GetBaseData());
+    FGSEndSessionResponse unreal_response = ToUnrealStruct<FGSEndSessionResponse>(response);
     
     UGSEndSessionRequest* g_UGSEndSessionRequest = static_cast<UGSEndSessionRequest*>(response.GetUserData());
                                              
@@ -2096,7 +2107,7 @@ void FacebookConnectRequestResponseCallback(GameSparks::Core::GS& gsInstance, co
     	return;
     }
     
-    FGSAuthenticationResponse unreal_response = FGSAuthenticationResponse(response.GetBaseData());
+    FGSAuthenticationResponse unreal_response = ToUnrealStruct<FGSAuthenticationResponse>(response);
     
     UGSFacebookConnectRequest* g_UGSFacebookConnectRequest = static_cast<UGSFacebookConnectRequest*>(response.GetUserData());
                                              
@@ -2214,7 +2225,7 @@ void FindChallengeRequestResponseCallback(GameSparks::Core::GS& gsInstance, cons
     	return;
     }
     
-    FGSFindChallengeResponse unreal_response = FGSFindChallengeResponse(response.GetBaseData());
+    FGSFindChallengeResponse unreal_response = ToUnrealStruct<FGSFindChallengeResponse>(response);
     
     UGSFindChallengeRequest* g_UGSFindChallengeRequest = static_cast<UGSFindChallengeRequest*>(response.GetUserData());
                                              
@@ -2324,7 +2335,7 @@ void FindMatchRequestResponseCallback(GameSparks::Core::GS& gsInstance, const Ga
     	return;
     }
     
-    FGSFindMatchResponse unreal_response = FGSFindMatchResponse(response.GetBaseData());
+    FGSFindMatchResponse unreal_response = ToUnrealStruct<FGSFindMatchResponse>(response);
     
     UGSFindMatchRequest* g_UGSFindMatchRequest = static_cast<UGSFindMatchRequest*>(response.GetUserData());
                                              
@@ -2422,7 +2433,7 @@ void FindPendingMatchesRequestResponseCallback(GameSparks::Core::GS& gsInstance,
     	return;
     }
     
-    FGSFindPendingMatchesResponse unreal_response = FGSFindPendingMatchesResponse(response.GetBaseData());
+    FGSFindPendingMatchesResponse unreal_response = ToUnrealStruct<FGSFindPendingMatchesResponse>(response);
     
     UGSFindPendingMatchesRequest* g_UGSFindPendingMatchesRequest = static_cast<UGSFindPendingMatchesRequest*>(response.GetUserData());
                                              
@@ -2515,7 +2526,7 @@ void GameCenterConnectRequestResponseCallback(GameSparks::Core::GS& gsInstance,
     	return;
     }
     
-    FGSAuthenticationResponse unreal_response = FGSAuthenticationResponse(response.GetBaseData());
+    FGSAuthenticationResponse unreal_response = ToUnrealStruct<FGSAuthenticationResponse>(response);
     
     UGSGameCenterConnectRequest* g_UGSGameCenterConnectRequest = static_cast<UGSGameCenterConnectRequest*>(response.GetUserData());
                                              
@@ -2653,7 +2664,7 @@ void GetChallengeRequestResponseCallback(GameSparks::Core::GS& gsInstance, const
     	return;
     }
     
-    FGSGetChallengeResponse unreal_response = FGSGetChallengeResponse(response.GetBaseData());
+    FGSGetChallengeResponse unreal_response = ToUnrealStruct<FGSGetChallengeResponse>(response);
     
     UGSGetChallengeRequest* g_UGSGetChallengeRequest = static_cast<UGSGetChallengeRequest*>(response.GetUserData());
                                              
@@ -2741,7 +2752,7 @@ void GetDownloadableRequestResponseCallback(GameSparks::Core::GS& gsInstance, co
     	return;
     }
     
-    FGSGetDownloadableResponse unreal_response = FGSGetDownloadableResponse(response.GetBaseData());
+    FGSGetDownloadableResponse unreal_response = ToUnrealStruct<FGSGetDownloadableResponse>(response);
     
     UGSGetDownloadableRequest* g_UGSGetDownloadableRequest = static_cast<UGSGetDownloadableRequest*>(response.GetUserData());
                                              
@@ -2824,7 +2835,7 @@ void GetLeaderboardEntriesRequestResponseCallback(GameSparks::Core::GS& gsInstan
     	return;
     }
     
-    FGSGetLeaderboardEntriesResponse unreal_response = FGSGetLeaderboardEntriesResponse(response.GetBaseData());
+    FGSGetLeaderboardEntriesResponse unreal_response = ToUnrealStruct<FGSGetLeaderboardEntriesResponse>(response);
     
     UGSGetLeaderboardEntriesRequest* g_UGSGetLeaderboardEntriesRequest = static_cast<UGSGetLeaderboardEntriesRequest*>(response.GetUserData());
                                              
@@ -2953,7 +2964,7 @@ void GetMessageRequestResponseCallback(GameSparks::Core::GS& gsInstance, const G
     	return;
     }
     
-    FGSGetMessageResponse unreal_response = FGSGetMessageResponse(response.GetBaseData());
+    FGSGetMessageResponse unreal_response = ToUnrealStruct<FGSGetMessageResponse>(response);
     
     UGSGetMessageRequest* g_UGSGetMessageRequest = static_cast<UGSGetMessageRequest*>(response.GetUserData());
                                              
@@ -3036,7 +3047,7 @@ void GetMyTeamsRequestResponseCallback(GameSparks::Core::GS& gsInstance, const G
     	return;
     }
     
-    FGSGetMyTeamsResponse unreal_response = FGSGetMyTeamsResponse(response.GetBaseData());
+    FGSGetMyTeamsResponse unreal_response = ToUnrealStruct<FGSGetMyTeamsResponse>(response);
     
     UGSGetMyTeamsRequest* g_UGSGetMyTeamsRequest = static_cast<UGSGetMyTeamsRequest*>(response.GetUserData());
                                              
@@ -3131,7 +3142,7 @@ void GetPropertyRequestResponseCallback(GameSparks::Core::GS& gsInstance, const
     	return;
     }
     
-    FGSGetPropertyResponse unreal_response = FGSGetPropertyResponse(response.GetBaseData());
+    FGSGetPropertyResponse unreal_response = ToUnrealStruct<FGSGetPropertyResponse>(response);
     
     UGSGetPropertyRequest* g_UGSGetPropertyRequest = static_cast<UGSGetPropertyRequest*>(response.GetUserData());
                                              
@@ -3214,7 +3225,7 @@ void GetPropertySetRequestResponseCallback(GameSparks::Core::GS& gsInstance, con
     	return;
     }
     
-    FGSGetPropertySetResponse unreal_response = FGSGetPropertySetResponse(response.GetBaseData());
+    FGSGetPropertySetResponse unreal_response = ToUnrealStruct<FGSGetPropertySetResponse>(response);
     
     UGSGetPropertySetRequest* g_UGSGetPropertySetRequest = static_cast<UGSGetPropertySetRequest*>(response.GetUserData());
                                              
@@ -3297,7 +3308,7 @@ void GetTeamRequestResponseCallback(GameSparks::Core::GS& gsInstance, const Game
     	return;
     }
     
-    FGSGetTeamResponse unreal_response = FGSGetTeamResponse(response.GetBaseData());
+    FGSGetTeamResponse unreal_response = ToUnrealStruct<FGSGetTeamResponse>(response);
     
     UGSGetTeamRequest* g_UGSGetTeamRequest = static_cast<UGSGetTeamRequest*>(response.GetUserData());
                                              
@@ -3390,7 +3401,7 @@ void GetUploadUrlRequestResponseCallback(GameSparks::Core::GS& gsInstance, const
     	return;
     }
     
-    FGSGetUploadUrlResponse unreal_response = FGSGetUploadUrlResponse(response.GetBaseData());
+    FGSGetUploadUrlResponse unreal_response = ToUnrealStruct<FGSGetUploadUrlResponse>(response);
     
     UGSGetUploadUrlRequest* g_UGSGetUploadUrlRequest = static_cast<UGSGetUploadUrlRequest*>(response.GetUserData());
                                              
@@ -3473,7 +3484,7 @@ void GetUploadedRequestResponseCallback(GameSparks::Core::GS& gsInstance, const
     	return;
     }
     
-    FGSGetUploadedResponse unreal_response = FGSGetUploadedResponse(response.GetBaseData());
+    FGSGetUploadedResponse unreal_response = ToUnrealStruct<FGSGetUploadedResponse>(response);
     
     UGSGetUploadedRequest* g_UGSGetUploadedRequest = static_cast<UGSGetUploadedRequest*>(response.GetUserData());
                                              
@@ -3556,7 +3567,7 @@ void GooglePlayBuyGoodsRequestResponseCallback(GameSparks::Core::GS& gsInstance,
     	return;
     }
     
-    FGSBuyVirtualGoodResponse unreal_response = FGSBuyVirtualGoodResponse(response.GetBaseData());
+    FGSBuyVirtualGoodResponse unreal_response = ToUnrealStruct<FGSBuyVirtualGoodResponse>(response);
     
     UGSGooglePlayBuyGoodsRequest* g_UGSGooglePlayBuyGoodsRequest = static_cast<UGSGooglePlayBuyGoodsRequest*>(response.GetUserData());
                                              
@@ -3659,7 +3670,7 @@ void GooglePlayConnectRequestResponseCallback(GameSparks::Core::GS& gsInstance,
     	return;
     }
     
-    FGSAuthenticationResponse unreal_response = FGSAuthenticationResponse(response.GetBaseData());
+    FGSAuthenticationResponse unreal_response = ToUnrealStruct<FGSAuthenticationResponse>(response);
     
     UGSGooglePlayConnectRequest* g_UGSGooglePlayConnectRequest = static_cast<UGSGooglePlayConnectRequest*>(response.GetUserData());
                                              
@@ -3797,7 +3808,7 @@ void GooglePlusConnectRequestResponseCallback(GameSparks::Core::GS& gsInstance,
     	return;
     }
     
-    FGSAuthenticationResponse unreal_response = FGSAuthenticationResponse(response.GetBaseData());
+    FGSAuthenticationResponse unreal_response = ToUnrealStruct<FGSAuthenticationResponse>(response);
     
     UGSGooglePlusConnectRequest* g_UGSGooglePlusConnectRequest = static_cast<UGSGooglePlusConnectRequest*>(response.GetUserData());
                                              
@@ -3920,7 +3931,7 @@ void IOSBuyGoodsRequestResponseCallback(GameSparks::Core::GS& gsInstance, const
     	return;
     }
     
-    FGSBuyVirtualGoodResponse unreal_response = FGSBuyVirtualGoodResponse(response.GetBaseData());
+    FGSBuyVirtualGoodResponse unreal_response = ToUnrealStruct<FGSBuyVirtualGoodResponse>(response);
     
     UGSIOSBuyGoodsRequest* g_UGSIOSBuyGoodsRequest = static_cast<UGSIOSBuyGoodsRequest*>(response.GetUserData());
                                              
@@ -4023,7 +4034,7 @@ void JoinChallengeRequestResponseCallback(GameSparks::Core::GS& gsInstance, cons
     	return;
     }
     
-    FGSJoinChallengeResponse unreal_response = FGSJoinChallengeResponse(response.GetBaseData());
+    FGSJoinChallengeResponse unreal_response = ToUnrealStruct<FGSJoinChallengeResponse>(response);
     
     UGSJoinChallengeRequest* g_UGSJoinChallengeRequest = static_cast<UGSJoinChallengeRequest*>(response.GetUserData());
                                              
@@ -4116,7 +4127,7 @@ void JoinPendingMatchRequestResponseCallback(GameSparks::Core::GS& gsInstance, c
     	return;
     }
     
-    FGSJoinPendingMatchResponse unreal_response = FGSJoinPendingMatchResponse(response.GetBaseData());
+    FGSJoinPendingMatchResponse unreal_response = ToUnrealStruct<FGSJoinPendingMatchResponse>(response);
     
     UGSJoinPendingMatchRequest* g_UGSJoinPendingMatchRequest = static_cast<UGSJoinPendingMatchRequest*>(response.GetUserData());
                                              
@@ -4209,7 +4220,7 @@ void JoinTeamRequestResponseCallback(GameSparks::Core::GS& gsInstance, const Gam
     	return;
     }
     
-    FGSJoinTeamResponse unreal_response = FGSJoinTeamResponse(response.GetBaseData());
+    FGSJoinTeamResponse unreal_response = ToUnrealStruct<FGSJoinTeamResponse>(response);
     
     UGSJoinTeamRequest* g_UGSJoinTeamRequest = static_cast<UGSJoinTeamRequest*>(response.GetUserData());
                                              
@@ -4302,7 +4313,7 @@ void KongregateConnectRequestResponseCallback(GameSparks::Core::GS& gsInstance,
     	return;
     }
     
-    FGSAuthenticationResponse unreal_response = FGSAuthenticationResponse(response.GetBaseData());
+    FGSAuthenticationResponse unreal_response = ToUnrealStruct<FGSAuthenticationResponse>(response);
     
     UGSKongregateConnectRequest* g_UGSKongregateConnectRequest = static_cast<UGSKongregateConnectRequest*>(response.GetUserData());
                                              
@@ -4420,7 +4431,7 @@ void LeaderboardDataRequestResponseCallback(GameSparks::Core::GS& gsInstance, co
     	return;
     }
     
-    FGSLeaderboardDataResponse unreal_response = FGSLeaderboardDataResponse(response.GetBaseData());
+    FGSLeaderboardDataResponse unreal_response = ToUnrealStruct<FGSLeaderboardDataResponse>(response);
     
     UGSLeaderboardDataRequest* g_UGSLeaderboardDataRequest = static_cast<UGSLeaderboardDataRequest*>(response.GetUserData());
                                              
@@ -4579,7 +4590,7 @@ void LeaderboardsEntriesRequestResponseCallback(GameSparks::Core::GS& gsInstance
     	return;
     }
     
-    FGSLeaderboardsEntriesResponse unreal_response = FGSLeaderboardsEntriesResponse(response.GetBaseData());
+    FGSLeaderboardsEntriesResponse unreal_response = ToUnrealStruct<FGSLeaderboardsEntriesResponse>(response);
     
     UGSLeaderboardsEntriesRequest* g_UGSLeaderboardsEntriesRequest = static_cast<UGSLeaderboardsEntriesRequest*>(response.GetUserData());
                                              
@@ -4708,7 +4719,7 @@ void LeaveTeamRequestResponseCallback(GameSparks::Core::GS& gsInstance, const Ga
     	return;
     }
     
-    FGSLeaveTeamResponse unreal_response = FGSLeaveTeamResponse(response.GetBaseData());
+    FGSLeaveTeamResponse unreal_response = ToUnrealStruct<FGSLeaveTeamResponse>(response);
     
     UGSLeaveTeamRequest* g_UGSLeaveTeamRequest = static_cast<UGSLeaveTeamRequest*>(response.GetUserData());
                                              
@@ -4801,7 +4812,7 @@ void ListAchievementsRequestResponseCallback(GameSparks::Core::GS& gsInstance, c
     	return;
     }
     
-    FGSListAchievementsResponse unreal_response = FGSListAchievementsResponse(response.GetBaseData());
+    FGSListAchievementsResponse unreal_response = ToUnrealStruct<FGSListAchievementsResponse>(response);
     
     UGSListAchievementsRequest* g_UGSListAchievementsRequest = static_cast<UGSListAchievementsRequest*>(response.GetUserData());
                                              
@@ -4879,7 +4890,7 @@ void ListBulkJobsAdminRequestResponseCallback(GameSparks::Core::GS& gsInstance,
     	return;
     }
     
-    FGSListBulkJobsAdminResponse unreal_response = FGSListBulkJobsAdminResponse(response.GetBaseData());
+    FGSListBulkJobsAdminResponse unreal_response = ToUnrealStruct<FGSListBulkJobsAdminResponse>(response);
     
     UGSListBulkJobsAdminRequest* g_UGSListBulkJobsAdminRequest = static_cast<UGSListBulkJobsAdminRequest*>(response.GetUserData());
                                              
@@ -4955,7 +4966,7 @@ void ListChallengeRequestResponseCallback(GameSparks::Core::GS& gsInstance, cons
     	return;
     }
     
-    FGSListChallengeResponse unreal_response = FGSListChallengeResponse(response.GetBaseData());
+    FGSListChallengeResponse unreal_response = ToUnrealStruct<FGSListChallengeResponse>(response);
     
     UGSListChallengeRequest* g_UGSListChallengeRequest = static_cast<UGSListChallengeRequest*>(response.GetUserData());
                                              
@@ -5065,7 +5076,7 @@ void ListChallengeTypeRequestResponseCallback(GameSparks::Core::GS& gsInstance,
     	return;
     }
     
-    FGSListChallengeTypeResponse unreal_response = FGSListChallengeTypeResponse(response.GetBaseData());
+    FGSListChallengeTypeResponse unreal_response = ToUnrealStruct<FGSListChallengeTypeResponse>(response);
     
     UGSListChallengeTypeRequest* g_UGSListChallengeTypeRequest = static_cast<UGSListChallengeTypeRequest*>(response.GetUserData());
                                              
@@ -5143,7 +5154,7 @@ void ListGameFriendsRequestResponseCallback(GameSparks::Core::GS& gsInstance, co
     	return;
     }
     
-    FGSListGameFriendsResponse unreal_response = FGSListGameFriendsResponse(response.GetBaseData());
+    FGSListGameFriendsResponse unreal_response = ToUnrealStruct<FGSListGameFriendsResponse>(response);
     
     UGSListGameFriendsRequest* g_UGSListGameFriendsRequest = static_cast<UGSListGameFriendsRequest*>(response.GetUserData());
                                              
@@ -5221,7 +5232,7 @@ void ListInviteFriendsRequestResponseCallback(GameSparks::Core::GS& gsInstance,
     	return;
     }
     
-    FGSListInviteFriendsResponse unreal_response = FGSListInviteFriendsResponse(response.GetBaseData());
+    FGSListInviteFriendsResponse unreal_response = ToUnrealStruct<FGSListInviteFriendsResponse>(response);
     
     UGSListInviteFriendsRequest* g_UGSListInviteFriendsRequest = static_cast<UGSListInviteFriendsRequest*>(response.GetUserData());
                                              
@@ -5299,7 +5310,7 @@ void ListLeaderboardsRequestResponseCallback(GameSparks::Core::GS& gsInstance, c
     	return;
     }
     
-    FGSListLeaderboardsResponse unreal_response = FGSListLeaderboardsResponse(response.GetBaseData());
+    FGSListLeaderboardsResponse unreal_response = ToUnrealStruct<FGSListLeaderboardsResponse>(response);
     
     UGSListLeaderboardsRequest* g_UGSListLeaderboardsRequest = static_cast<UGSListLeaderboardsRequest*>(response.GetUserData());
                                              
@@ -5377,7 +5388,7 @@ void ListMessageDetailRequestResponseCallback(GameSparks::Core::GS& gsInstance,
     	return;
     }
     
-    FGSListMessageDetailResponse unreal_response = FGSListMessageDetailResponse(response.GetBaseData());
+    FGSListMessageDetailResponse unreal_response = ToUnrealStruct<FGSListMessageDetailResponse>(response);
     
     UGSListMessageDetailRequest* g_UGSListMessageDetailRequest = static_cast<UGSListMessageDetailRequest*>(response.GetUserData());
                                              
@@ -5475,7 +5486,7 @@ void ListMessageRequestResponseCallback(GameSparks::Core::GS& gsInstance, const
     	return;
     }
     
-    FGSListMessageResponse unreal_response = FGSListMessageResponse(response.GetBaseData());
+    FGSListMessageResponse unreal_response = ToUnrealStruct<FGSListMessageResponse>(response);
     
     UGSListMessageRequest* g_UGSListMessageRequest = static_cast<UGSListMessageRequest*>(response.GetUserData());
                                              
@@ -5568,7 +5579,7 @@ void ListMessageSummaryRequestResponseCallback(GameSparks::Core::GS& gsInstance,
     	return;
     }
     
-    FGSListMessageSummaryResponse unreal_response = FGSListMessageSummaryResponse(response.GetBaseData());
+    FGSListMessageSummaryResponse unreal_response = ToUnrealStruct<FGSListMessageSummaryResponse>(response);
     
     UGSListMessageSummaryRequest* g_UGSListMessageSummaryRequest = static_cast<UGSListMessageSummaryRequest*>(response.GetUserData());
                                              
@@ -5656,7 +5667,7 @@ void ListTeamChatRequestResponseCallback(GameSparks::Core::GS& gsInstance, const
     	return;
     }
     
-    FGSListTeamChatResponse unreal_response = FGSListTeamChatResponse(response.GetBaseData());
+    FGSListTeamChatResponse unreal_response = ToUnrealStruct<FGSListTeamChatResponse>(response);
     
     UGSListTeamChatRequest* g_UGSListTeamChatRequest = static_cast<UGSListTeamChatRequest*>(response.GetUserData());
                                              
@@ -5759,7 +5770,7 @@ void ListTeamsRequestResponseCallback(GameSparks::Core::GS& gsInstance, const Ga
     	return;
     }
     
-    FGSListTeamsResponse unreal_response = FGSListTeamsResponse(response.GetBaseData());
+    FGSListTeamsResponse unreal_response = ToUnrealStruct<FGSListTeamsResponse>(response);
     
     UGSListTeamsRequest* g_UGSListTeamsRequest = static_cast<UGSListTeamsRequest*>(response.GetUserData());
                                              
@@ -5857,7 +5868,7 @@ void ListTransactionsRequestResponseCallback(GameSparks::Core::GS& gsInstance, c
     	return;
     }
     
-    FGSListTransactionsResponse unreal_response = FGSListTransactionsResponse(response.GetBaseData());
+    FGSListTransactionsResponse unreal_response = ToUnrealStruct<FGSListTransactionsResponse>(response);
     
     UGSListTransactionsRequest* g_UGSListTransactionsRequest = static_cast<UGSListTransactionsRequest*>(response.GetUserData());
                                              
@@ -5960,7 +5971,7 @@ void ListVirtualGoodsRequestResponseCallback(GameSparks::Core::GS& gsInstance, c
     	return;
     }
     
-    FGSListVirtualGoodsResponse unreal_response = FGSListVirtualGoodsResponse(response.GetBaseData());
+    FGSListVirtualGoodsResponse unreal_response = ToUnrealStruct<FGSListVirtualGoodsResponse>(response);
     
     UGSListVirtualGoodsRequest* g_UGSListVirtualGoodsRequest = static_cast<UGSListVirtualGoodsRequest*>(response.GetUserData());
                                              
@@ -6055,7 +6066,7 @@ void LogChallengeEventRequestResponseCallback(GameSparks::Core::GS& gsInstance,
     	return;
     }
     
-    FGSLogChallengeEventResponse unreal_response = FGSLogChallengeEventResponse(response.GetBaseData());
+    FGSLogChallengeEventResponse unreal_response = ToUnrealStruct<FGSLogChallengeEventResponse>(response);
     
     UGSLogChallengeEventRequest* g_UGSLogChallengeEventRequest = static_cast<UGSLogChallengeEventRequest*>(response.GetUserData());
                                              
@@ -6143,7 +6154,7 @@ void LogEventRequestResponseCallback(GameSparks::Core::GS& gsInstance, const Gam
     	return;
     }
     
-    FGSLogEventResponse unreal_response = FGSLogEventResponse(response.GetBaseData());
+    FGSLogEventResponse unreal_response = ToUnrealStruct<FGSLogEventResponse>(response);
     
     UGSLogEventRequest* g_UGSLogEventRequest = static_cast<UGSLogEventRequest*>(response.GetUserData());
                                              
@@ -6155,11 +6166,13 @@ void LogEventRequestResponseCallback(GameSparks::Core::GS& gsInstance, const Gam
     {
         g_UGSLogEventRequest->OnResponse.Broadcast(unreal_response, false);
     }
+
+    TGameSparksProxyPool<UGSLogEventRequest>::Release(g_UGSLogEventRequest);
 }
 
 UGSLogEventRequest* UGSLogEventRequest::SendLogEventRequest(FString EventKey,  UGameSparksLogEventData* LogEventData, bool Durable, int32 RequestTimeoutSeconds)
 {
-	UGSLogEventRequest* proxy = NewObject<UGSLogEventRequest>();
+	UGSLogEventRequest* proxy = TGameSparksProxyPool<UGSLogEventRequest>::Acquire();
 	proxy->eventKey = EventKey;
 	proxy->logEventData = LogEventData;
 	proxy->durable = Durable;
@@ -6169,7 +6182,7 @@ UGSLogEventRequest* UGSLogEventRequest::SendLogEventRequest(FString EventKey,  U
 
 UGSLogEventRequest* UGSLogEventRequest::SendLogEventRequestOnBehalfOf(const FString& PlayerId, FString EventKey,  UGameSparksLogEventData* LogEventData, bool Durable, int32 RequestTimeoutSeconds)
 {
-	UGSLogEventRequest* proxy = NewObject<UGSLogEventRequest>();
+	UGSLogEventRequest* proxy = TGameSparksProxyPool<UGSLogEventRequest>::Acquire();
 	proxy->eventKey = EventKey;
 	proxy->logEventData = LogEventData;
 	proxy->durable = Durable;
@@ -6219,6 +6232,12 @@ UGSLogEventRequest::~UGSLogEventRequest()
  }
 }
 
+void UGSLogEventRequest::ResetForReuse()
+{
+	logEventData = nullptr;
+	playerId = FString();
+}
+
 
 void MatchDetailsRequestResponseCallback(GameSparks::Core::GS& gsInstance, const GameSparks::Api::Responses::MatchDetailsResponse& response){
     
@@ -6226,7 +6245,7 @@ void MatchDetailsRequestResponseCallback(GameSparks::Core::GS& gsInstance, const
     	return;
     }
     
-    FGSMatchDetailsResponse unreal_response = FGSMatchDetailsResponse(response.GetBaseData());
+    FGSMatchDetailsResponse unreal_response = ToUnrealStruct<FGSMatchDetailsResponse>(response);
     
     UGSMatchDetailsRequest* g_UGSMatchDetailsRequest = static_cast<UGSMatchDetailsRequest*>(response.GetUserData());
                                              
@@ -6314,7 +6333,7 @@ void MatchmakingRequestResponseCallback(GameSparks::Core::GS& gsInstance, const
     	return;
     }
     
-    FGSMatchmakingResponse unreal_response = FGSMatchmakingResponse(response.GetBaseData());
+    FGSMatchmakingResponse unreal_response = ToUnrealStruct<FGSMatchmakingResponse>(response);
     
     UGSMatchmakingRequest* g_UGSMatchmakingRequest = static_cast<UGSMatchmakingRequest*>(response.GetUserData());
                                              
@@ -6427,7 +6446,7 @@ void NXConnectRequestResponseCallback(GameSparks::Core::GS& gsInstance, const Ga
     	return;
     }
     
-    FGSAuthenticationResponse unreal_response = FGSAuthenticationResponse(response.GetBaseData());
+    FGSAuthenticationResponse unreal_response = ToUnrealStruct<FGSAuthenticationResponse>(response);
     
     UGSNXConnectRequest* g_UGSNXConnectRequest = static_cast<UGSNXConnectRequest*>(response.GetUserData());
                                              
@@ -6550,7 +6569,7 @@ void PSNAccountConnectRequestResponseCallback(GameSparks::Core::GS& gsInstance,
     	return;
     }
     
-    FGSAuthenticationResponse unreal_response = FGSAuthenticationResponse(response.GetBaseData());
+    FGSAuthenticationResponse unreal_response = ToUnrealStruct<FGSAuthenticationResponse>(response);
     
     UGSPSNAccountConnectRequest* g_UGSPSNAccountConnectRequest = static_cast<UGSPSNAccountConnectRequest*>(response.GetUserData());
                                              
@@ -6668,7 +6687,7 @@ void PSNConnectRequestResponseCallback(GameSparks::Core::GS& gsInstance, const G
     	return;
     }
     
-    FGSAuthenticationResponse unreal_response = FGSAuthenticationResponse(response.GetBaseData());
+    FGSAuthenticationResponse unreal_response = ToUnrealStruct<FGSAuthenticationResponse>(response);
     
     UGSPSNConnectRequest* g_UGSPSNConnectRequest = static_cast<UGSPSNConnectRequest*>(response.GetUserData());
                                              
@@ -6786,7 +6805,7 @@ void PsnBuyGoodsRequestResponseCallback(GameSparks::Core::GS& gsInstance, const
     	return;
     }
     
-    FGSBuyVirtualGoodResponse unreal_response = FGSBuyVirtualGoodResponse(response.GetBaseData());
+    FGSBuyVirtualGoodResponse unreal_response = ToUnrealStruct<FGSBuyVirtualGoodResponse>(response);
     
     UGSPsnBuyGoodsRequest* g_UGSPsnBuyGoodsRequest = static_cast<UGSPsnBuyGoodsRequest*>(response.GetUserData());
                                              
@@ -6899,7 +6918,7 @@ void PushRegistrationRequestResponseCallback(GameSparks::Core::GS& gsInstance, c
     	return;
     }
     
-    FGSPushRegistrationResponse unreal_response = FGSPushRegistrationResponse(response.GetBaseData());
+    FGSPushRegistrationResponse unreal_response = ToUnrealStruct<FGSPushRegistrationResponse>(response);
     
     UGSPushRegistrationRequest* g_UGSPushRegistrationRequest = static_cast<UGSPushRegistrationRequest*>(response.GetUserData());
                                              
@@ -6987,7 +7006,7 @@ void QQConnectRequestResponseCallback(GameSparks::Core::GS& gsInstance, const Ga
     	return;
     }
     
-    FGSAuthenticationResponse unreal_response = FGSAuthenticationResponse(response.GetBaseData());
+    FGSAuthenticationResponse unreal_response = ToUnrealStruct<FGSAuthenticationResponse>(response);
     
     UGSQQConnectRequest* g_UGSQQConnectRequest = static_cast<UGSQQConnectRequest*>(response.GetUserData());
                                              
@@ -7100,7 +7119,7 @@ void RegistrationRequestResponseCallback(GameSparks::Core::GS& gsInstance, const
     	return;
     }
     
-    FGSRegistrationResponse unreal_response = FGSRegistrationResponse(response.GetBaseData());
+    FGSRegistrationResponse unreal_response = ToUnrealStruct<FGSRegistrationResponse>(response);
     
     UGSRegistrationRequest* g_UGSRegistrationRequest = static_cast<UGSRegistrationRequest*>(response.GetUserData());
                                              
@@ -7198,7 +7217,7 @@ void RevokePurchaseGoodsRequestResponseCallback(GameSparks::Core::GS& gsInstance
     	return;
     }
     
-    FGSRevokePurchaseGoodsResponse unreal_response = FGSRevokePurchaseGoodsResponse(response.GetBaseData());
+    FGSRevokePurchaseGoodsResponse unreal_response = ToUnrealStruct<FGSRevokePurchaseGoodsResponse>(response);
     
     UGSRevokePurchaseGoodsRequest* g_UGSRevokePurchaseGoodsRequest = static_cast<UGSRevokePurchaseGoodsRequest*>(response.GetUserData());
                                              
@@ -7282,7 +7301,7 @@ void ScheduleBulkJobAdminRequestResponseCallback(GameSparks::Core::GS& gsInstanc
     	return;
     }
     
-    FGSScheduleBulkJobAdminResponse unreal_response = FGSScheduleBulkJobAdminResponse(response.GetBaseData());
+    FGSScheduleBulkJobAdminResponse unreal_response = ToUnrealStruct<FGSScheduleBulkJobAdminResponse>(response);
     
     UGSScheduleBulkJobAdminRequest* g_UGSScheduleBulkJobAdminRequest = static_cast<UGSScheduleBulkJobAdminRequest*>(response.GetUserData());
                                              
@@ -7367,7 +7386,7 @@ void SendFriendMessageRequestResponseCallback(GameSparks::Core::GS& gsInstance,
     	return;
     }
     
-    FGSSendFriendMessageResponse unreal_response = FGSSendFriendMessageResponse(response.GetBaseData());
+    FGSSendFriendMessageResponse unreal_response = ToUnrealStruct<FGSSendFriendMessageResponse>(response);
     
     UGSSendFriendMessageRequest* g_UGSSendFriendMessageRequest = static_cast<UGSSendFriendMessageRequest*>(response.GetUserData());
                                              
@@ -7462,7 +7481,7 @@ void SendTeamChatMessageRequestResponseCallback(GameSparks::Core::GS& gsInstance
     	return;
     }
     
-    FGSSendTeamChatMessageResponse unreal_response = FGSSendTeamChatMessageResponse(response.GetBaseData());
+    FGSSendTeamChatMessageResponse unreal_response = ToUnrealStruct<FGSSendTeamChatMessageResponse>(response);
     
     UGSSendTeamChatMessageRequest* g_UGSSendTeamChatMessageRequest = static_cast<UGSSendTeamChatMessageRequest*>(response.GetUserData());
                                              
@@ -7560,7 +7579,7 @@ void SocialDisconnectRequestResponseCallback(GameSparks::Core::GS& gsInstance, c
     	return;
     }
     
-    FGSSocialDisconnectResponse unreal_response = FGSSocialDisconnectResponse(response.GetBaseData());
+    FGSSocialDisconnectResponse unreal_response = ToUnrealStruct<FGSSocialDisconnectResponse>(response);
     
     UGSSocialDisconnectRequest* g_UGSSocialDisconnectRequest = static_cast<UGSSocialDisconnectRequest*>(response.GetUserData());
                                              
@@ -7643,7 +7662,7 @@ void SocialLeaderboardDataRequestResponseCallback(GameSparks::Core::GS& gsInstan
     	return;
     }
     
-    FGSLeaderboardDataResponse unreal_response = FGSLeaderboardDataResponse(response.GetBaseData());
+    FGSLeaderboardDataResponse unreal_response = ToUnrealStruct<FGSLeaderboardDataResponse>(response);
     
     UGSSocialLeaderboardDataRequest* g_UGSSocialLeaderboardDataRequest = static_cast<UGSSocialLeaderboardDataRequest*>(response.GetUserData());
                                              
@@ -7802,7 +7821,7 @@ void SocialStatusRequestResponseCallback(GameSparks::Core::GS& gsInstance, const
     	return;
     }
     
-    FGSSocialStatusResponse unreal_response = FGSSocialStatusResponse(response.GetBaseData());
+    FGSSocialStatusResponse unreal_response = ToUnrealStruct<FGSSocialStatusResponse>(response);
     
     UGSSocialStatusRequest* g_UGSSocialStatusRequest = static_cast<UGSSocialStatusRequest*>(response.GetUserData());
                                              
@@ -7880,7 +7899,7 @@ void SteamBuyGoodsRequestResponseCallback(GameSparks::Core::GS& gsInstance, cons
     	return;
     }
     
-    FGSBuyVirtualGoodResponse unreal_response = FGSBuyVirtualGoodResponse(response.GetBaseData());
+    FGSBuyVirtualGoodResponse unreal_response = ToUnrealStruct<FGSBuyVirtualGoodResponse>(response);
     
     UGSSteamBuyGoodsRequest* g_UGSSteamBuyGoodsRequest = static_cast<UGSSteamBuyGoodsRequest*>(response.GetUserData());
                                              
@@ -7978,7 +7997,7 @@ void SteamConnectRequestResponseCallback(GameSparks::Core::GS& gsInstance, const
     	return;
     }
     
-    FGSAuthenticationResponse unreal_response = FGSAuthenticationResponse(response.GetBaseData());
+    FGSAuthenticationResponse unreal_response = ToUnrealStruct<FGSAuthenticationResponse>(response);
     
     UGSSteamConnectRequest* g_UGSSteamConnectRequest = static_cast<UGSSteamConnectRequest*>(response.GetUserData());
                                              
@@ -8091,7 +8110,7 @@ void TwitchConnectRequestResponseCallback(GameSparks::Core::GS& gsInstance, cons
     	return;
     }
     
-    FGSAuthenticationResponse unreal_response = FGSAuthenticationResponse(response.GetBaseData());
+    FGSAuthenticationResponse unreal_response = ToUnrealStruct<FGSAuthenticationResponse>(response);
     
     UGSTwitchConnectRequest* g_UGSTwitchConnectRequest = static_cast<UGSTwitchConnectRequest*>(response.GetUserData());
                                              
@@ -8204,7 +8223,7 @@ void TwitterConnectRequestResponseCallback(GameSparks::Core::GS& gsInstance, con
     	return;
     }
     
-    FGSAuthenticationResponse unreal_response = FGSAuthenticationResponse(response.GetBaseData());
+    FGSAuthenticationResponse unreal_response = ToUnrealStruct<FGSAuthenticationResponse>(response);
     
     UGSTwitterConnectRequest* g_UGSTwitterConnectRequest = static_cast<UGSTwitterConnectRequest*>(response.GetUserData());
                                              
@@ -8322,7 +8341,7 @@ void UpdateMessageRequestResponseCallback(GameSparks::Core::GS& gsInstance, cons
     	return;
     }
     
-    FGSUpdateMessageResponse unreal_response = FGSUpdateMessageResponse(response.GetBaseData());
+    FGSUpdateMessageResponse unreal_response = ToUnrealStruct<FGSUpdateMessageResponse>(response);
     
     UGSUpdateMessageRequest* g_UGSUpdateMessageRequest = static_cast<UGSUpdateMessageRequest*>(response.GetUserData());
                                              
@@ -8410,7 +8429,7 @@ void ViberConnectRequestResponseCallback(GameSparks::Core::GS& gsInstance, const
     	return;
     }
     
-    FGSAuthenticationResponse unreal_response = FGSAuthenticationResponse(response.GetBaseData());
+    FGSAuthenticationResponse unreal_response = ToUnrealStruct<FGSAuthenticationResponse>(response);
     
     UGSViberConnectRequest* g_UGSViberConnectRequest = static_cast<UGSViberConnectRequest*>(response.GetUserData());
                                              
@@ -8528,7 +8547,7 @@ void WeChatConnectRequestResponseCallback(GameSparks::Core::GS& gsInstance, cons
     	return;
     }
     
-    FGSAuthenticationResponse unreal_response = FGSAuthenticationResponse(response.GetBaseData());
+    FGSAuthenticationResponse unreal_response = ToUnrealStruct<FGSAuthenticationResponse>(response);
     
     UGSWeChatConnectRequest* g_UGSWeChatConnectRequest = static_cast<UGSWeChatConnectRequest*>(response.GetUserData());
                                              
@@ -8646,7 +8665,7 @@ void WindowsBuyGoodsRequestResponseCallback(GameSparks::Core::GS& gsInstance, co
     	return;
     }
     
-    FGSBuyVirtualGoodResponse unreal_response = FGSBuyVirtualGoodResponse(response.GetBaseData());
+    FGSBuyVirtualGoodResponse unreal_response = ToUnrealStruct<FGSBuyVirtualGoodResponse>(response);
     
     UGSWindowsBuyGoodsRequest* g_UGSWindowsBuyGoodsRequest = static_cast<UGSWindowsBuyGoodsRequest*>(response.GetUserData());
                                              
@@ -8749,7 +8768,7 @@ void WithdrawChallengeRequestResponseCallback(GameSparks::Core::GS& gsInstance,
     	return;
     }
     
-    FGSWithdrawChallengeResponse unreal_response = FGSWithdrawChallengeResponse(response.GetBaseData());
+    FGSWithdrawChallengeResponse unreal_response = ToUnrealStruct<FGSWithdrawChallengeResponse>(response);
     
     UGSWithdrawChallengeRequest* g_UGSWithdrawChallengeRequest = static_cast<UGSWithdrawChallengeRequest*>(response.GetUserData());
                                              
@@ -8837,7 +8856,7 @@ void XBOXLiveConnectRequestResponseCallback(GameSparks::Core::GS& gsInstance, co
     	return;
     }
     
-    FGSAuthenticationResponse unreal_response = FGSAuthenticationResponse(response.GetBaseData());
+    FGSAuthenticationResponse unreal_response = ToUnrealStruct<FGSAuthenticationResponse>(response);
     
     UGSXBOXLiveConnectRequest* g_UGSXBOXLiveConnectRequest = static_cast<UGSXBOXLiveConnectRequest*>(response.GetUserData());
                                              
@@ -8955,7 +8974,7 @@ void XboxOneConnectRequestResponseCallback(GameSparks::Core::GS& gsInstance, con
     	return;
     }
     
-    FGSAuthenticationResponse unreal_response = FGSAuthenticationResponse(response.GetBaseData());
+    FGSAuthenticationResponse unreal_response = ToUnrealStruct<FGSAuthenticationResponse>(response);
     
     UGSXboxOneConnectRequest* g_UGSXboxOneConnectRequest = static_cast<UGSXboxOneConnectRequest*>(response.GetUserData());
                                              
@@ -335,6 +335,9 @@ public:
 	
 	~UGSAnalyticsRequest();
 
+	/// drops the references of a proxy that is put back into its TGameSparksProxyPool
+	void ResetForReuse();
+
 private:
 	
 	UPROPERTY()
@@ -4108,6 +4111,9 @@ public:
 	
 	~UGSLogEventRequest();
 
+	/// drops the references of a proxy that is put back into its TGameSparksProxyPool
+	void ResetForReuse();
+
 private:
 	
 	UPROPERTY()
@@ -5,879 +5,425 @@
 #include "GameSparksComponent.h"
 #include "GameSparksModule.h"
 #include "GSMessageListenersObject.h"
+#include "GameSparksStats.h"
 
-void UGSMessageListeners_OnAchievementEarnedMessage(GameSparks::Core::GS& gsInstance, const GameSparks::Api::Messages::AchievementEarnedMessage& message)
+namespace
 {
-    FGSAchievementEarnedMessage unreal_message(message.GetBaseData());
-    
-    for ( TObjectIterator<UGSMessageListeners> Itr; Itr; ++Itr )
+    bool IsInGameWorld(const UObject* Object)
     {
+        UWorld* World = Object->GetWorld();
         #if GS_UE_VERSION < GS_MAKE_VERSION(4, 14) // since 4.14 auto-generated enums no longer use TEnumAsByte
-        if(Itr->GetWorld() != nullptr && (Itr->GetWorld()->WorldType.GetValue() == EWorldType::Game || Itr->GetWorld()->WorldType.GetValue() == EWorldType::PIE) && (!Itr->IsPendingKill()))
+        return World != nullptr && (World->WorldType.GetValue() == EWorldType::Game || World->WorldType.GetValue() == EWorldType::PIE) && !Object->IsPendingKill();
         #else
-        if(Itr->GetWorld() != nullptr && (Itr->GetWorld()->WorldType == EWorldType::Game || Itr->GetWorld()->WorldType == EWorldType::PIE) && (!Itr->IsPendingKill()))
+        return World != nullptr && (World->WorldType == EWorldType::Game || World->WorldType == EWorldType::PIE) && !Object->IsPendingKill();
         #endif
-		{
-               Itr->OnAchievementEarnedMessage.Broadcast(unreal_message);
-		}
     }
 
-    // Also notify UGSMessageListenersObject instances
-    for (TObjectIterator<UGSMessageListenersObject> Itr; Itr; ++Itr)
+    // returns true, if a registered listener has bound the delegate of this message type.
+    // used to skip the conversion of messages nobody listens to.
+    template <typename ComponentDelegate, typename ObjectDelegate>
+    bool HasMessageListeners(ComponentDelegate UGSMessageListeners::* ComponentMember, ObjectDelegate UGSMessageListenersObject::* ObjectMember)
     {
-        #if GS_UE_VERSION < GS_MAKE_VERSION(4, 14) // since 4.14 auto-generated enums no longer use TEnumAsByte
-        if(Itr->GetWorld() != nullptr && (Itr->GetWorld()->WorldType.GetValue() == EWorldType::Game || Itr->GetWorld()->WorldType.GetValue() == EWorldType::PIE) && (!Itr->IsPendingKill()))
-        #else
-        if(Itr->GetWorld() != nullptr && (Itr->GetWorld()->WorldType == EWorldType::Game || Itr->GetWorld()->WorldType == EWorldType::PIE) && (!Itr->IsPendingKill()))
-        #endif
+        UGameSparksModule* Module = UGameSparksModule::GetModulePtr();
+        if (Module == nullptr)
         {
-            Itr->OnAchievementEarnedMessage.Broadcast(unreal_message);
+            return false;
         }
-    }
-}
 
-void UGSMessageListeners_OnChallengeAcceptedMessage(GameSparks::Core::GS& gsInstance, const GameSparks::Api::Messages::ChallengeAcceptedMessage& message)
-{
-    FGSChallengeAcceptedMessage unreal_message(message.GetBaseData());
-    
-    for ( TObjectIterator<UGSMessageListeners> Itr; Itr; ++Itr )
-    {
-        #if GS_UE_VERSION < GS_MAKE_VERSION(4, 14) // since 4.14 auto-generated enums no longer use TEnumAsByte
-        if(Itr->GetWorld() != nullptr && (Itr->GetWorld()->WorldType.GetValue() == EWorldType::Game || Itr->GetWorld()->WorldType.GetValue() == EWorldType::PIE) && (!Itr->IsPendingKill()))
-        #else
-        if(Itr->GetWorld() != nullptr && (Itr->GetWorld()->WorldType == EWorldType::Game || Itr->GetWorld()->WorldType == EWorldType::PIE) && (!Itr->IsPendingKill()))
-        #endif
-		{
-               Itr->OnChallengeAcceptedMessage.Broadcast(unreal_message);
-		}
+        for (const TWeakObjectPtr<UGSMessageListeners>& Listener : Module->GetMessageListenerComponents())
+        {
+            if (Listener.IsValid() && (Listener.Get()->*ComponentMember).IsBound())
+            {
+                return true;
+            }
+        }
+
+        for (const TWeakObjectPtr<UGSMessageListenersObject>& Listener : Module->GetMessageListenerObjects())
+        {
+            if (Listener.IsValid() && (Listener.Get()->*ObjectMember).IsBound())
+            {
+                return true;
+            }
+        }
+
+        return false;
     }
 
-    // Also notify UGSMessageListenersObject instances
-    for (TObjectIterator<UGSMessageListenersObject> Itr; Itr; ++Itr)
+    template <typename MessageType, typename ComponentDelegate, typename ObjectDelegate>
+    void BroadcastToMessageListeners(const MessageType& Message, ComponentDelegate UGSMessageListeners::* ComponentMember, ObjectDelegate UGSMessageListenersObject::* ObjectMember)
     {
-        #if GS_UE_VERSION < GS_MAKE_VERSION(4, 14) // since 4.14 auto-generated enums no longer use TEnumAsByte
-        if(Itr->GetWorld() != nullptr && (Itr->GetWorld()->WorldType.GetValue() == EWorldType::Game || Itr->GetWorld()->WorldType.GetValue() == EWorldType::PIE) && (!Itr->IsPendingKill()))
-        #else
-        if(Itr->GetWorld() != nullptr && (Itr->GetWorld()->WorldType == EWorldType::Game || Itr->GetWorld()->WorldType == EWorldType::PIE) && (!Itr->IsPendingKill()))
-        #endif
+        UGameSparksModule* Module = UGameSparksModule::GetModulePtr();
+
+        // handlers may add or remove listeners, so iterate over a copy of the registry
+        TArray<TWeakObjectPtr<UGSMessageListeners>, TInlineAllocator<16>> Components(Module->GetMessageListenerComponents());
+        for (const TWeakObjectPtr<UGSMessageListeners>& Listener : Components)
+        {
+            UGSMessageListeners* Component = Listener.Get();
+            if (Component != nullptr && (Component->*ComponentMember).IsBound() && IsInGameWorld(Component))
+            {
+                (Component->*ComponentMember).Broadcast(Message);
+            }
+        }
+
+        // Also notify UGSMessageListenersObject instances
+        TArray<TWeakObjectPtr<UGSMessageListenersObject>, TInlineAllocator<16>> Objects(Module->GetMessageListenerObjects());
+        for (const TWeakObjectPtr<UGSMessageListenersObject>& Listener : Objects)
         {
-            Itr->OnChallengeAcceptedMessage.Broadcast(unreal_message);
+            UGSMessageListenersObject* Object = Listener.Get();
+            if (Object != nullptr && (Object->*ObjectMember).IsBound() && IsInGameWorld(Object))
+            {
+                (Object->*ObjectMember).Broadcast(Message);
+            }
         }
     }
 }
 
-void UGSMessageListeners_OnChallengeChangedMessage(GameSparks::Core::GS& gsInstance, const GameSparks::Api::Messages::ChallengeChangedMessage& message)
+void UGSMessageListeners_OnAchievementEarnedMessage(GameSparks::Core::GS& gsInstance, const GameSparks::Api::Messages::AchievementEarnedMessage& message)
 {
-    FGSChallengeChangedMessage unreal_message(message.GetBaseData());
-    
-    for ( TObjectIterator<UGSMessageListeners> Itr; Itr; ++Itr )
+    if (!HasMessageListeners(&UGSMessageListeners::OnAchievementEarnedMessage, &UGSMessageListenersObject::OnAchievementEarnedMessage))
     {
-        #if GS_UE_VERSION < GS_MAKE_VERSION(4, 14) // since 4.14 auto-generated enums no longer use TEnumAsByte
-        if(Itr->GetWorld() != nullptr && (Itr->GetWorld()->WorldType.GetValue() == EWorldType::Game || Itr->GetWorld()->WorldType.GetValue() == EWorldType::PIE) && (!Itr->IsPendingKill()))
-        #else
-        if(Itr->GetWorld() != nullptr && (Itr->GetWorld()->WorldType == EWorldType::Game || Itr->GetWorld()->WorldType == EWorldType::PIE) && (!Itr->IsPendingKill()))
-        #endif
-		{
-               Itr->OnChallengeChangedMessage.Broadcast(unreal_message);
-		}
+        return;
     }
 
-    // Also notify UGSMessageListenersObject instances
-    for (TObjectIterator<UGSMessageListenersObject> Itr; Itr; ++Itr)
+    FGSAchievementEarnedMessage unreal_message = ToUnrealStruct<FGSAchievementEarnedMessage>(message);
+    BroadcastToMessageListeners(unreal_message, &UGSMessageListeners::OnAchievementEarnedMessage, &UGSMessageListenersObject::OnAchievementEarnedMessage);
+}
+
+void UGSMessageListeners_OnChallengeAcceptedMessage(GameSparks::Core::GS& gsInstance, const GameSparks::Api::Messages::ChallengeAcceptedMessage& message)
+{
+    if (!HasMessageListeners(&UGSMessageListeners::OnChallengeAcceptedMessage, &UGSMessageListenersObject::OnChallengeAcceptedMessage))
     {
-        #if GS_UE_VERSION < GS_MAKE_VERSION(4, 14) // since 4.14 auto-generated enums no longer use TEnumAsByte
-        if(Itr->GetWorld() != nullptr && (Itr->GetWorld()->WorldType.GetValue() == EWorldType::Game || Itr->GetWorld()->WorldType.GetValue() == EWorldType::PIE) && (!Itr->IsPendingKill()))
-        #else
-        if(Itr->GetWorld() != nullptr && (Itr->GetWorld()->WorldType == EWorldType::Game || Itr->GetWorld()->WorldType == EWorldType::PIE) && (!Itr->IsPendingKill()))
-        #endif
-        {
-            Itr->OnChallengeChangedMessage.Broadcast(unreal_message);
-        }
+        return;
     }
+
+    FGSChallengeAcceptedMessage unreal_message = ToUnrealStruct<FGSChallengeAcceptedMessage>(message);
+    BroadcastToMessageListeners(unreal_message, &UGSMessageListeners::OnChallengeAcceptedMessage, &UGSMessageListenersObject::OnChallengeAcceptedMessage);
 }
 
-void UGSMessageListeners_OnChallengeChatMessage(GameSparks::Core::GS& gsInstance, const GameSparks::Api::Messages::ChallengeChatMessage& message)
+void UGSMessageListeners_OnChallengeChangedMessage(GameSparks::Core::GS& gsInstance, const GameSparks::Api::Messages::ChallengeChangedMessage& message)
 {
-    FGSChallengeChatMessage unreal_message(message.GetBaseData());
-    
-    for ( TObjectIterator<UGSMessageListeners> Itr; Itr; ++Itr )
+    if (!HasMessageListeners(&UGSMessageListeners::OnChallengeChangedMessage, &UGSMessageListenersObject::OnChallengeChangedMessage))
     {
-        #if GS_UE_VERSION < GS_MAKE_VERSION(4, 14) // since 4.14 auto-generated enums no longer use TEnumAsByte
-        if(Itr->GetWorld() != nullptr && (Itr->GetWorld()->WorldType.GetValue() == EWorldType::Game || Itr->GetWorld()->WorldType.GetValue() == EWorldType::PIE) && (!Itr->IsPendingKill()))
-        #else
-        if(Itr->GetWorld() != nullptr && (Itr->GetWorld()->WorldType == EWorldType::Game || Itr->GetWorld()->WorldType == EWorldType::PIE) && (!Itr->IsPendingKill()))
-        #endif
-		{
-               Itr->OnChallengeChatMessage.Broadcast(unreal_message);
-		}
+        return;
     }
 
-    // Also notify UGSMessageListenersObject instances
-    for (TObjectIterator<UGSMessageListenersObject> Itr; Itr; ++Itr)
+    FGSChallengeChangedMessage unreal_message = ToUnrealStruct<FGSChallengeChangedMessage>(message);
+    BroadcastToMessageListeners(unreal_message, &UGSMessageListeners::OnChallengeChangedMessage, &UGSMessageListenersObject::OnChallengeChangedMessage);
+}
+
+void UGSMessageListeners_OnChallengeChatMessage(GameSparks::Core::GS& gsInstance, const GameSparks::Api::Messages::ChallengeChatMessage& message)
+{
+    if (!HasMessageListeners(&UGSMessageListeners::OnChallengeChatMessage, &UGSMessageListenersObject::OnChallengeChatMessage))
     {
-        #if GS_UE_VERSION < GS_MAKE_VERSION(4, 14) // since 4.14 auto-generated enums no longer use TEnumAsByte
-        if(Itr->GetWorld() != nullptr && (Itr->GetWorld()->WorldType.GetValue() == EWorldType::Game || Itr->GetWorld()->WorldType.GetValue() == EWorldType::PIE) && (!Itr->IsPendingKill()))
-        #else
-        if(Itr->GetWorld() != nullptr && (Itr->GetWorld()->WorldType == EWorldType::Game || Itr->GetWorld()->WorldType == EWorldType::PIE) && (!Itr->IsPendingKill()))
-        #endif
-        {
-            Itr->OnChallengeChatMessage.Broadcast(unreal_message);
-        }
+        return;
     }
+
+    FGSChallengeChatMessage unreal_message = ToUnrealStruct<FGSChallengeChatMessage>(message);
+    BroadcastToMessageListeners(unreal_message, &UGSMessageListeners::OnChallengeChatMessage, &UGSMessageListenersObject::OnChallengeChatMessage);
 }
 
 void UGSMessageListeners_OnChallengeDeclinedMessage(GameSparks::Core::GS& gsInstance, const GameSparks::Api::Messages::ChallengeDeclinedMessage& message)
 {
-    FGSChallengeDeclinedMessage unreal_message(message.GetBaseData());
-    
-    for ( TObjectIterator<UGSMessageListeners> Itr; Itr; ++Itr )
+    if (!HasMessageListeners(&UGSMessageListeners::OnChallengeDeclinedMessage, &UGSMessageListenersObject::OnChallengeDeclinedMessage))
     {
-        #if GS_UE_VERSION < GS_MAKE_VERSION(4, 14) // since 4.14 auto-generated enums no longer use TEnumAsByte
-        if(Itr->GetWorld() != nullptr && (Itr->GetWorld()->WorldType.GetValue() == EWorldType::Game || Itr->GetWorld()->WorldType.GetValue() == EWorldType::PIE) && (!Itr->IsPendingKill()))
-        #else
-        if(Itr->GetWorld() != nullptr && (Itr->GetWorld()->WorldType == EWorldType::Game || Itr->GetWorld()->WorldType == EWorldType::PIE) && (!Itr->IsPendingKill()))
-        #endif
-		{
-               Itr->OnChallengeDeclinedMessage.Broadcast(unreal_message);
-		}
+        return;
     }
 
-    // Also notify UGSMessageListenersObject instances
-    for (TObjectIterator<UGSMessageListenersObject> Itr; Itr; ++Itr)
-    {
-        #if GS_UE_VERSION < GS_MAKE_VERSION(4, 14) // since 4.14 auto-generated enums no longer use TEnumAsByte
-        if(Itr->GetWorld() != nullptr && (Itr->GetWorld()->WorldType.GetValue() == EWorldType::Game || Itr->GetWorld()->WorldType.GetValue() == EWorldType::PIE) && (!Itr->IsPendingKill()))
-        #else
-        if(Itr->GetWorld() != nullptr && (Itr->GetWorld()->WorldType == EWorldType::Game || Itr->GetWorld()->WorldType == EWorldType::PIE) && (!Itr->IsPendingKill()))
-        #endif
-        {
-            Itr->OnChallengeDeclinedMessage.Broadcast(unreal_message);
-        }
-    }
+    FGSChallengeDeclinedMessage unreal_message = ToUnrealStruct<FGSChallengeDeclinedMessage>(message);
+    BroadcastToMessageListeners(unreal_message, &UGSMessageListeners::OnChallengeDeclinedMessage, &UGSMessageListenersObject::OnChallengeDeclinedMessage);
 }
 
 void UGSMessageListeners_OnChallengeDrawnMessage(GameSparks::Core::GS& gsInstance, const GameSparks::Api::Messages::ChallengeDrawnMessage& message)
 {
-    FGSChallengeDrawnMessage unreal_message(message.GetBaseData());
-    
-    for ( TObjectIterator<UGSMessageListeners> Itr; Itr; ++Itr )
+    if (!HasMessageListeners(&UGSMessageListeners::OnChallengeDrawnMessage, &UGSMessageListenersObject::OnChallengeDrawnMessage))
     {
-        #if GS_UE_VERSION < GS_MAKE_VERSION(4, 14) // since 4.14 auto-generated enums no longer use TEnumAsByte
-        if(Itr->GetWorld() != nullptr && (Itr->GetWorld()->WorldType.GetValue() == EWorldType::Game || Itr->GetWorld()->WorldType.GetValue() == EWorldType::PIE) && (!Itr->IsPendingKill()))
-        #else
-        if(Itr->GetWorld() != nullptr && (Itr->GetWorld()->WorldType == EWorldType::Game || Itr->GetWorld()->WorldType == EWorldType::PIE) && (!Itr->IsPendingKill()))
-        #endif
-		{
-               Itr->OnChallengeDrawnMessage.Broadcast(unreal_message);
-		}
+        return;
     }
 
-    // Also notify UGSMessageListenersObject instances
-    for (TObjectIterator<UGSMessageListenersObject> Itr; Itr; ++Itr)
-    {
-        #if GS_UE_VERSION < GS_MAKE_VERSION(4, 14) // since 4.14 auto-generated enums no longer use TEnumAsByte
-        if(Itr->GetWorld() != nullptr && (Itr->GetWorld()->WorldType.GetValue() == EWorldType::Game || Itr->GetWorld()->WorldType.GetValue() == EWorldType::PIE) && (!Itr->IsPendingKill()))
-        #else
-        if(Itr->GetWorld() != nullptr && (Itr->GetWorld()->WorldType == EWorldType::Game || Itr->GetWorld()->WorldType == EWorldType::PIE) && (!Itr->IsPendingKill()))
-        #endif
-        {
-            Itr->OnChallengeDrawnMessage.Broadcast(unreal_message);
-        }
-    }
+    FGSChallengeDrawnMessage unreal_message = ToUnrealStruct<FGSChallengeDrawnMessage>(message);
+    BroadcastToMessageListeners(unreal_message, &UGSMessageListeners::OnChallengeDrawnMessage, &UGSMessageListenersObject::OnChallengeDrawnMessage);
 }
 
 void UGSMessageListeners_OnChallengeExpiredMessage(GameSparks::Core::GS& gsInstance, const GameSparks::Api::Messages::ChallengeExpiredMessage& message)
 {
-    FGSChallengeExpiredMessage unreal_message(message.GetBaseData());
-    
-    for ( TObjectIterator<UGSMessageListeners> Itr; Itr; ++Itr )
+    if (!HasMessageListeners(&UGSMessageListeners::OnChallengeExpiredMessage, &UGSMessageListenersObject::OnChallengeExpiredMessage))
     {
-        #if GS_UE_VERSION < GS_MAKE_VERSION(4, 14) // since 4.14 auto-generated enums no longer use TEnumAsByte
-        if(Itr->GetWorld() != nullptr && (Itr->GetWorld()->WorldType.GetValue() == EWorldType::Game || Itr->GetWorld()->WorldType.GetValue() == EWorldType::PIE) && (!Itr->IsPendingKill()))
-        #else
-        if(Itr->GetWorld() != nullptr && (Itr->GetWorld()->WorldType == EWorldType::Game || Itr->GetWorld()->WorldType == EWorldType::PIE) && (!Itr->IsPendingKill()))
-        #endif
-		{
-               Itr->OnChallengeExpiredMessage.Broadcast(unreal_message);
-		}
+        return;
     }
 
-    // Also notify UGSMessageListenersObject instances
-    for (TObjectIterator<UGSMessageListenersObject> Itr; Itr; ++Itr)
-    {
-        #if GS_UE_VERSION < GS_MAKE_VERSION(4, 14) // since 4.14 auto-generated enums no longer use TEnumAsByte
-        if(Itr->GetWorld() != nullptr && (Itr->GetWorld()->WorldType.GetValue() == EWorldType::Game || Itr->GetWorld()->WorldType.GetValue() == EWorldType::PIE) && (!Itr->IsPendingKill()))
-        #else
-        if(Itr->GetWorld() != nullptr && (Itr->GetWorld()->WorldType == EWorldType::Game || Itr->GetWorld()->WorldType == EWorldType::PIE) && (!Itr->IsPendingKill()))
-        #endif
-        {
-            Itr->OnChallengeExpiredMessage.Broadcast(unreal_message);
-        }
-    }
+    FGSChallengeExpiredMessage unreal_message = ToUnrealStruct<FGSChallengeExpiredMessage>(message);
+    BroadcastToMessageListeners(unreal_message, &UGSMessageListeners::OnChallengeExpiredMessage, &UGSMessageListenersObject::OnChallengeExpiredMessage);
 }
 
 void UGSMessageListeners_OnChallengeIssuedMessage(GameSparks::Core::GS& gsInstance, const GameSparks::Api::Messages::ChallengeIssuedMessage& message)
 {
-    FGSChallengeIssuedMessage unreal_message(message.GetBaseData());
-    
-    for ( TObjectIterator<UGSMessageListeners> Itr; Itr; ++Itr )
+    if (!HasMessageListeners(&UGSMessageListeners::OnChallengeIssuedMessage, &UGSMessageListenersObject::OnChallengeIssuedMessage))
     {
-        #if GS_UE_VERSION < GS_MAKE_VERSION(4, 14) // since 4.14 auto-generated enums no longer use TEnumAsByte
-        if(Itr->GetWorld() != nullptr && (Itr->GetWorld()->WorldType.GetValue() == EWorldType::Game || Itr->GetWorld()->WorldType.GetValue() == EWorldType::PIE) && (!Itr->IsPendingKill()))
-        #else
-        if(Itr->GetWorld() != nullptr && (Itr->GetWorld()->WorldType == EWorldType::Game || Itr->GetWorld()->WorldType == EWorldType::PIE) && (!Itr->IsPendingKill()))
-        #endif
-		{
-               Itr->OnChallengeIssuedMessage.Broadcast(unreal_message);
-		}
+        return;
     }
 
-    // Also notify UGSMessageListenersObject instances
-    for (TObjectIterator<UGSMessageListenersObject> Itr; Itr; ++Itr)
-    {
-        #if GS_UE_VERSION < GS_MAKE_VERSION(4, 14) // since 4.14 auto-generated enums no longer use TEnumAsByte
-        if(Itr->GetWorld() != nullptr && (Itr->GetWorld()->WorldType.GetValue() == EWorldType::Game || Itr->GetWorld()->WorldType.GetValue() == EWorldType::PIE) && (!Itr->IsPendingKill()))
-        #else
-        if(Itr->GetWorld() != nullptr && (Itr->GetWorld()->WorldType == EWorldType::Game || Itr->GetWorld()->WorldType == EWorldType::PIE) && (!Itr->IsPendingKill()))
-        #endif
-        {
-            Itr->OnChallengeIssuedMessage.Broadcast(unreal_message);
-        }
-    }
+    FGSChallengeIssuedMessage unreal_message = ToUnrealStruct<FGSChallengeIssuedMessage>(message);
+    BroadcastToMessageListeners(unreal_message, &UGSMessageListeners::OnChallengeIssuedMessage, &UGSMessageListenersObject::OnChallengeIssuedMessage);
 }
 
 void UGSMessageListeners_OnChallengeJoinedMessage(GameSparks::Core::GS& gsInstance, const GameSparks::Api::Messages::ChallengeJoinedMessage& message)
 {
-    FGSChallengeJoinedMessage unreal_message(message.GetBaseData());
-    
-    for ( TObjectIterator<UGSMessageListeners> Itr; Itr; ++Itr )
+    if (!HasMessageListeners(&UGSMessageListeners::OnChallengeJoinedMessage, &UGSMessageListenersObject::OnChallengeJoinedMessage))
     {
-        #if GS_UE_VERSION < GS_MAKE_VERSION(4, 14) // since 4.14 auto-generated enums no longer use TEnumAsByte
-        if(Itr->GetWorld() != nullptr && (Itr->GetWorld()->WorldType.GetValue() == EWorldType::Game || Itr->GetWorld()->WorldType.GetValue() == EWorldType::PIE) && (!Itr->IsPendingKill()))
-        #else
-        if(Itr->GetWorld() != nullptr && (Itr->GetWorld()->WorldType == EWorldType::Game || Itr->GetWorld()->WorldType == EWorldType::PIE) && (!Itr->IsPendingKill()))
-        #endif
-		{
-               Itr->OnChallengeJoinedMessage.Broadcast(unreal_message);
-		}
+        return;
     }
 
-    // Also notify UGSMessageListenersObject instances
-    for (TObjectIterator<UGSMessageListenersObject> Itr; Itr; ++Itr)
-    {
-        #if GS_UE_VERSION < GS_MAKE_VERSION(4, 14) // since 4.14 auto-generated enums no longer use TEnumAsByte
-        if(Itr->GetWorld() != nullptr && (Itr->GetWorld()->WorldType.GetValue() == EWorldType::Game || Itr->GetWorld()->WorldType.GetValue() == EWorldType::PIE) && (!Itr->IsPendingKill()))
-        #else
-        if(Itr->GetWorld() != nullptr && (Itr->GetWorld()->WorldType == EWorldType::Game || Itr->GetWorld()->WorldType == EWorldType::PIE) && (!Itr->IsPendingKill()))
-        #endif
-        {
-            Itr->OnChallengeJoinedMessage.Broadcast(unreal_message);
-        }
-    }
+    FGSChallengeJoinedMessage unreal_message = ToUnrealStruct<FGSChallengeJoinedMessage>(message);
+    BroadcastToMessageListeners(unreal_message, &UGSMessageListeners::OnChallengeJoinedMessage, &UGSMessageListenersObject::OnChallengeJoinedMessage);
 }
 
 void UGSMessageListeners_OnChallengeLapsedMessage(GameSparks::Core::GS& gsInstance, const GameSparks::Api::Messages::ChallengeLapsedMessage& message)
 {
-    FGSChallengeLapsedMessage unreal_message(message.GetBaseData());
-    
-    for ( TObjectIterator<UGSMessageListeners> Itr; Itr; ++Itr )
+    if (!HasMessageListeners(&UGSMessageListeners::OnChallengeLapsedMessage, &UGSMessageListenersObject::OnChallengeLapsedMessage))
     {
-        #if GS_UE_VERSION < GS_MAKE_VERSION(4, 14) // since 4.14 auto-generated enums no longer use TEnumAsByte
-        if(Itr->GetWorld() != nullptr && (Itr->GetWorld()->WorldType.GetValue() == EWorldType::Game || Itr->GetWorld()->WorldType.GetValue() == EWorldType::PIE) && (!Itr->IsPendingKill()))
-        #else
-        if(Itr->GetWorld() != nullptr && (Itr->GetWorld()->WorldType == EWorldType::Game || Itr->GetWorld()->WorldType == EWorldType::PIE) && (!Itr->IsPendingKill()))
-        #endif
-		{
-               Itr->OnChallengeLapsedMessage.Broadcast(unreal_message);
-		}
+        return;
     }
 
-    // Also notify UGSMessageListenersObject instances
-    for (TObjectIterator<UGSMessageListenersObject> Itr; Itr; ++Itr)
-    {
-        #if GS_UE_VERSION < GS_MAKE_VERSION(4, 14) // since 4.14 auto-generated enums no longer use TEnumAsByte
-        if(Itr->GetWorld() != nullptr && (Itr->GetWorld()->WorldType.GetValue() == EWorldType::Game || Itr->GetWorld()->WorldType.GetValue() == EWorldType::PIE) && (!Itr->IsPendingKill()))
-        #else
-        if(Itr->GetWorld() != nullptr && (Itr->GetWorld()->WorldType == EWorldType::Game || Itr->GetWorld()->WorldType == EWorldType::PIE) && (!Itr->IsPendingKill()))
-        #endif
-        {
-            Itr->OnChallengeLapsedMessage.Broadcast(unreal_message);
-        }
-    }
+    FGSChallengeLapsedMessage unreal_message = ToUnrealStruct<FGSChallengeLapsedMessage>(message);
+    BroadcastToMessageListeners(unreal_message, &UGSMessageListeners::OnChallengeLapsedMessage, &UGSMessageListenersObject::OnChallengeLapsedMessage);
 }
 
 void UGSMessageListeners_OnChallengeLostMessage(GameSparks::Core::GS& gsInstance, const GameSparks::Api::Messages::ChallengeLostMessage& message)
 {
-    FGSChallengeLostMessage unreal_message(message.GetBaseData());
-    
-    for ( TObjectIterator<UGSMessageListeners> Itr; Itr; ++Itr )
+    if (!HasMessageListeners(&UGSMessageListeners::OnChallengeLostMessage, &UGSMessageListenersObject::OnChallengeLostMessage))
     {
-        #if GS_UE_VERSION < GS_MAKE_VERSION(4, 14) // since 4.14 auto-generated enums no longer use TEnumAsByte
-        if(Itr->GetWorld() != nullptr && (Itr->GetWorld()->WorldType.GetValue() == EWorldType::Game || Itr->GetWorld()->WorldType.GetValue() == EWorldType::PIE) && (!Itr->IsPendingKill()))
-        #else
-        if(Itr->GetWorld() != nullptr && (Itr->GetWorld()->WorldType == EWorldType::Game || Itr->GetWorld()->WorldType == EWorldType::PIE) && (!Itr->IsPendingKill()))
-        #endif
-		{
-               Itr->OnChallengeLostMessage.Broadcast(unreal_message);
-		}
+        return;
     }
 
-    // Also notify UGSMessageListenersObject instances
-    for (TObjectIterator<UGSMessageListenersObject> Itr; Itr; ++Itr)
-    {
-        #if GS_UE_VERSION < GS_MAKE_VERSION(4, 14) // since 4.14 auto-generated enums no longer use TEnumAsByte
-        if(Itr->GetWorld() != nullptr && (Itr->GetWorld()->WorldType.GetValue() == EWorldType::Game || Itr->GetWorld()->WorldType.GetValue() == EWorldType::PIE) && (!Itr->IsPendingKill()))
-        #else
-        if(Itr->GetWorld() != nullptr && (Itr->GetWorld()->WorldType == EWorldType::Game || Itr->GetWorld()->WorldType == EWorldType::PIE) && (!Itr->IsPendingKill()))
-        #endif
-        {
-            Itr->OnChallengeLostMessage.Broadcast(unreal_message);
-        }
-    }
+    FGSChallengeLostMessage unreal_message = ToUnrealStruct<FGSChallengeLostMessage>(message);
+    BroadcastToMessageListeners(unreal_message, &UGSMessageListeners::OnChallengeLostMessage, &UGSMessageListenersObject::OnChallengeLostMessage);
 }
 
 void UGSMessageListeners_OnChallengeStartedMessage(GameSparks::Core::GS& gsInstance, const GameSparks::Api::Messages::ChallengeStartedMessage& message)
 {
-    FGSChallengeStartedMessage unreal_message(message.GetBaseData());
-    
-    for ( TObjectIterator<UGSMessageListeners> Itr; Itr; ++Itr )
+    if (!HasMessageListeners(&UGSMessageListeners::OnChallengeStartedMessage, &UGSMessageListenersObject::OnChallengeStartedMessage))
     {
-        #if GS_UE_VERSION < GS_MAKE_VERSION(4, 14) // since 4.14 auto-generated enums no longer use TEnumAsByte
-        if(Itr->GetWorld() != nullptr && (Itr->GetWorld()->WorldType.GetValue() == EWorldType::Game || Itr->GetWorld()->WorldType.GetValue() == EWorldType::PIE) && (!Itr->IsPendingKill()))
-        #else
-        if(Itr->GetWorld() != nullptr && (Itr->GetWorld()->WorldType == EWorldType::Game || Itr->GetWorld()->WorldType == EWorldType::PIE) && (!Itr->IsPendingKill()))
-        #endif
-		{
-               Itr->OnChallengeStartedMessage.Broadcast(unreal_message);
-		}
+        return;
     }
 
-    // Also notify UGSMessageListenersObject instances
-    for (TObjectIterator<UGSMessageListenersObject> Itr; Itr; ++Itr)
-    {
-        #if GS_UE_VERSION < GS_MAKE_VERSION(4, 14) // since 4.14 auto-generated enums no longer use TEnumAsByte
-        if(Itr->GetWorld() != nullptr && (Itr->GetWorld()->WorldType.GetValue() == EWorldType::Game || Itr->GetWorld()->WorldType.GetValue() == EWorldType::PIE) && (!Itr->IsPendingKill()))
-        #else
-        if(Itr->GetWorld() != nullptr && (Itr->GetWorld()->WorldType == EWorldType::Game || Itr->GetWorld()->WorldType == EWorldType::PIE) && (!Itr->IsPendingKill()))
-        #endif
-        {
-            Itr->OnChallengeStartedMessage.Broadcast(unreal_message);
-        }
-    }
+    FGSChallengeStartedMessage unreal_message = ToUnrealStruct<FGSChallengeStartedMessage>(message);
+    BroadcastToMessageListeners(unreal_message, &UGSMessageListeners::OnChallengeStartedMessage, &UGSMessageListenersObject::OnChallengeStartedMessage);
 }
 
 void UGSMessageListeners_OnChallengeTurnTakenMessage(GameSparks::Core::GS& gsInstance, const GameSparks::Api::Messages::ChallengeTurnTakenMessage& message)
 {
-    FGSChallengeTurnTakenMessage unreal_message(message.GetBaseData());
-    
-    for ( TObjectIterator<UGSMessageListeners> Itr; Itr; ++Itr )
+    if (!HasMessageListeners(&UGSMessageListeners::OnChallengeTurnTakenMessage, &UGSMessageListenersObject::OnChallengeTurnTakenMessage))
     {
-        #if GS_UE_VERSION < GS_MAKE_VERSION(4, 14) // since 4.14 auto-generated enums no longer use TEnumAsByte
-        if(Itr->GetWorld() != nullptr && (Itr->GetWorld()->WorldType.GetValue() == EWorldType::Game || Itr->GetWorld()->WorldType.GetValue() == EWorldType::PIE) && (!Itr->IsPendingKill()))
-        #else
-        if(Itr->GetWorld() != nullptr && (Itr->GetWorld()->WorldType == EWorldType::Game || Itr->GetWorld()->WorldType == EWorldType::PIE) && (!Itr->IsPendingKill()))
-        #endif
-		{
-               Itr->OnChallengeTurnTakenMessage.Broadcast(unreal_message);
-		}
+        return;
     }
 
-    // Also notify UGSMessageListenersObject instances
-    for (TObjectIterator<UGSMessageListenersObject> Itr; Itr; ++Itr)
-    {
-        #if GS_UE_VERSION < GS_MAKE_VERSION(4, 14) // since 4.14 auto-generated enums no longer use TEnumAsByte
-        if(Itr->GetWorld() != nullptr && (Itr->GetWorld()->WorldType.GetValue() == EWorldType::Game || Itr->GetWorld()->WorldType.GetValue() == EWorldType::PIE) && (!Itr->IsPendingKill()))
-        #else
-        if(Itr->GetWorld() != nullptr && (Itr->GetWorld()->WorldType == EWorldType::Game || Itr->GetWorld()->WorldType == EWorldType::PIE) && (!Itr->IsPendingKill()))
-        #endif
-        {
-            Itr->OnChallengeTurnTakenMessage.Broadcast(unreal_message);
-        }
-    }
+    FGSChallengeTurnTakenMessage unreal_message = ToUnrealStruct<FGSChallengeTurnTakenMessage>(message);
+    BroadcastToMessageListeners(unreal_message, &UGSMessageListeners::OnChallengeTurnTakenMessage, &UGSMessageListenersObject::OnChallengeTurnTakenMessage);
 }
 
 void UGSMessageListeners_OnChallengeWaitingMessage(GameSparks::Core::GS& gsInstance, const GameSparks::Api::Messages::ChallengeWaitingMessage& message)
 {
-    FGSChallengeWaitingMessage unreal_message(message.GetBaseData());
-    
-    for ( TObjectIterator<UGSMessageListeners> Itr; Itr; ++Itr )
+    if (!HasMessageListeners(&UGSMessageListeners::OnChallengeWaitingMessage, &UGSMessageListenersObject::OnChallengeWaitingMessage))
     {
-        #if GS_UE_VERSION < GS_MAKE_VERSION(4, 14) // since 4.14 auto-generated enums no longer use TEnumAsByte
-        if(Itr->GetWorld() != nullptr && (Itr->GetWorld()->WorldType.GetValue() == EWorldType::Game || Itr->GetWorld()->WorldType.GetValue() == EWorldType::PIE) && (!Itr->IsPendingKill()))
-        #else
-        if(Itr->GetWorld() != nullptr && (Itr->GetWorld()->WorldType == EWorldType::Game || Itr->GetWorld()->WorldType == EWorldType::PIE) && (!Itr->IsPendingKill()))
-        #endif
-		{
-               Itr->OnChallengeWaitingMessage.Broadcast(unreal_message);
-		}
+        return;
     }
 
-    // Also notify UGSMessageListenersObject instances
-    for (TObjectIterator<UGSMessageListenersObject> Itr; Itr; ++Itr)
-    {
-        #if GS_UE_VERSION < GS_MAKE_VERSION(4, 14) // since 4.14 auto-generated enums no longer use TEnumAsByte
-        if(Itr->GetWorld() != nullptr && (Itr->GetWorld()->WorldType.GetValue() == EWorldType::Game || Itr->GetWorld()->WorldType.GetValue() == EWorldType::PIE) && (!Itr->IsPendingKill()))
-        #else
-        if(Itr->GetWorld() != nullptr && (Itr->GetWorld()->WorldType == EWorldType::Game || Itr->GetWorld()->WorldType == EWorldType::PIE) && (!Itr->IsPendingKill()))
-        #endif
-        {
-            Itr->OnChallengeWaitingMessage.Broadcast(unreal_message);
-        }
-    }
+    FGSChallengeWaitingMessage unreal_message = ToUnrealStruct<FGSChallengeWaitingMessage>(message);
+    BroadcastToMessageListeners(unreal_message, &UGSMessageListeners::OnChallengeWaitingMessage, &UGSMessageListenersObject::OnChallengeWaitingMessage);
 }
 
 void UGSMessageListeners_OnChallengeWithdrawnMessage(GameSparks::Core::GS& gsInstance, const GameSparks::Api::Messages::ChallengeWithdrawnMessage& message)
 {
-    FGSChallengeWithdrawnMessage unreal_message(message.GetBaseData());
-    
-    for ( TObjectIterator<UGSMessageListeners> Itr; Itr; ++Itr )
+    if (!HasMessageListeners(&UGSMessageListeners::OnChallengeWithdrawnMessage, &UGSMessageListenersObject::OnChallengeWithdrawnMessage))
     {
-        #if GS_UE_VERSION < GS_MAKE_VERSION(4, 14) // since 4.14 auto-generated enums no longer use TEnumAsByte
-        if(Itr->GetWorld() != nullptr && (Itr->GetWorld()->WorldType.GetValue() == EWorldType::Game || Itr->GetWorld()->WorldType.GetValue() == EWorldType::PIE) && (!Itr->IsPendingKill()))
-        #else
-        if(Itr->GetWorld() != nullptr && (Itr->GetWorld()->WorldType == EWorldType::Game || Itr->GetWorld()->WorldType == EWorldType::PIE) && (!Itr->IsPendingKill()))
-        #endif
-		{
-               Itr->OnChallengeWithdrawnMessage.Broadcast(unreal_message);
-		}
+        return;
     }
 
-    // Also notify UGSMessageListenersObject instances
-    for (TObjectIterator<UGSMessageListenersObject> Itr; Itr; ++Itr)
-    {
-        #if GS_UE_VERSION < GS_MAKE_VERSION(4, 14) // since 4.14 auto-generated enums no longer use TEnumAsByte
-        if(Itr->GetWorld() != nullptr && (Itr->GetWorld()->WorldType.GetValue() == EWorldType::Game || Itr->GetWorld()->WorldType.GetValue() == EWorldType::PIE) && (!Itr->IsPendingKill()))
-        #else
-        if(Itr->GetWorld() != nullptr && (Itr->GetWorld()->WorldType == EWorldType::Game || Itr->GetWorld()->WorldType == EWorldType::PIE) && (!Itr->IsPendingKill()))
-        #endif
-        {
-            Itr->OnChallengeWithdrawnMessage.Broadcast(unreal_message);
-        }
-    }
+    FGSChallengeWithdrawnMessage unreal_message = ToUnrealStruct<FGSChallengeWithdrawnMessage>(message);
+    BroadcastToMessageListeners(unreal_message, &UGSMessageListeners::OnChallengeWithdrawnMessage, &UGSMessageListenersObject::OnChallengeWithdrawnMessage);
 }
 
 void UGSMessageListeners_OnChallengeWonMessage(GameSparks::Core::GS& gsInstance, const GameSparks::Api::Messages::ChallengeWonMessage& message)
 {
-    FGSChallengeWonMessage unreal_message(message.GetBaseData());
-    
-    for ( TObjectIterator<UGSMessageListeners> Itr; Itr; ++Itr )
+    if (!HasMessageListeners(&UGSMessageListeners::OnChallengeWonMessage, &UGSMessageListenersObject::OnChallengeWonMessage))
     {
-        #if GS_UE_VERSION < GS_MAKE_VERSION(4, 14) // since 4.14 auto-generated enums no longer use TEnumAsByte
-        if(Itr->GetWorld() != nullptr && (Itr->GetWorld()->WorldType.GetValue() == EWorldType::Game || Itr->GetWorld()->WorldType.GetValue() == EWorldType::PIE) && (!Itr->IsPendingKill()))
-        #else
-        if(Itr->GetWorld() != nullptr && (Itr->GetWorld()->WorldType == EWorldType::Game || Itr->GetWorld()->WorldType == EWorldType::PIE) && (!Itr->IsPendingKill()))
-        #endif
-		{
-               Itr->OnChallengeWonMessage.Broadcast(unreal_message);
-		}
+        return;
     }
 
-    // Also notify UGSMessageListenersObject instances
-    for (TObjectIterator<UGSMessageListenersObject> Itr; Itr; ++Itr)
-    {
-        #if GS_UE_VERSION < GS_MAKE_VERSION(4, 14) // since 4.14 auto-generated enums no longer use TEnumAsByte
-        if(Itr->GetWorld() != nullptr && (Itr->GetWorld()->WorldType.GetValue() == EWorldType::Game || Itr->GetWorld()->WorldType.GetValue() == EWorldType::PIE) && (!Itr->IsPendingKill()))
-        #else
-        if(Itr->GetWorld() != nullptr && (Itr->GetWorld()->WorldType == EWorldType::Game || Itr->GetWorld()->WorldType == EWorldType::PIE) && (!Itr->IsPendingKill()))
-        #endif
-        {
-            Itr->OnChallengeWonMessage.Broadcast(unreal_message);
-        }
-    }
+    FGSChallengeWonMessage unreal_message = ToUnrealStruct<FGSChallengeWonMessage>(message);
+    BroadcastToMessageListeners(unreal_message, &UGSMessageListeners::OnChallengeWonMessage, &UGSMessageListenersObject::OnChallengeWonMessage);
 }
 
 void UGSMessageListeners_OnFriendMessage(GameSparks::Core::GS& gsInstance, const GameSparks::Api::Messages::FriendMessage& message)
 {
-    FGSFriendMessage unreal_message(message.GetBaseData());
-    
-    for ( TObjectIterator<UGSMessageListeners> Itr; Itr; ++Itr )
+    if (!HasMessageListeners(&UGSMessageListeners::OnFriendMessage, &UGSMessageListenersObject::OnFriendMessage))
     {
-        #if GS_UE_VERSION < GS_MAKE_VERSION(4, 14) // since 4.14 auto-generated enums no longer use TEnumAsByte
-        if(Itr->GetWorld() != nullptr && (Itr->GetWorld()->WorldType.GetValue() == EWorldType::Game || Itr->GetWorld()->WorldType.GetValue() == EWorldType::PIE) && (!Itr->IsPendingKill()))
-        #else
-        if(Itr->GetWorld() != nullptr && (Itr->GetWorld()->WorldType == EWorldType::Game || Itr->GetWorld()->WorldType == EWorldType::PIE) && (!Itr->IsPendingKill()))
-        #endif
-		{
-               Itr->OnFriendMessage.Broadcast(unreal_message);
-		}
+        return;
     }
 
-    // Also notify UGSMessageListenersObject instances
-    for (TObjectIterator<UGSMessageListenersObject> Itr; Itr; ++Itr)
-    {
-        #if GS_UE_VERSION < GS_MAKE_VERSION(4, 14) // since 4.14 auto-generated enums no longer use TEnumAsByte
-        if(Itr->GetWorld() != nullptr && (Itr->GetWorld()->WorldType.GetValue() == EWorldType::Game || Itr->GetWorld()->WorldType.GetValue() == EWorldType::PIE) && (!Itr->IsPendingKill()))
-        #else
-        if(Itr->GetWorld() != nullptr && (Itr->GetWorld()->WorldType == EWorldType::Game || Itr->GetWorld()->WorldType == EWorldType::PIE) && (!Itr->IsPendingKill()))
-        #endif
-        {
-            Itr->OnFriendMessage.Broadcast(unreal_message);
-        }
-    }
+    FGSFriendMessage unreal_message = ToUnrealStruct<FGSFriendMessage>(message);
+    BroadcastToMessageListeners(unreal_message, &UGSMessageListeners::OnFriendMessage, &UGSMessageListenersObject::OnFriendMessage);
 }
 
 void UGSMessageListeners_OnGlobalRankChangedMessage(GameSparks::Core::GS& gsInstance, const GameSparks::Api::Messages::GlobalRankChangedMessage& message)
 {
-    FGSGlobalRankChangedMessage unreal_message(message.GetBaseData());
-    
-    for ( TObjectIterator<UGSMessageListeners> Itr; Itr; ++Itr )
+    if (!HasMessageListeners(&UGSMessageListeners::OnGlobalRankChangedMessage, &UGSMessageListenersObject::OnGlobalRankChangedMessage))
     {
-        #if GS_UE_VERSION < GS_MAKE_VERSION(4, 14) // since 4.14 auto-generated enums no longer use TEnumAsByte
-        if(Itr->GetWorld() != nullptr && (Itr->GetWorld()->WorldType.GetValue() == EWorldType::Game || Itr->GetWorld()->WorldType.GetValue() == EWorldType::PIE) && (!Itr->IsPendingKill()))
-        #else
-        if(Itr->GetWorld() != nullptr && (Itr->GetWorld()->WorldType == EWorldType::Game || Itr->GetWorld()->WorldType == EWorldType::PIE) && (!Itr->IsPendingKill()))
-        #endif
-		{
-               Itr->OnGlobalRankChangedMessage.Broadcast(unreal_message);
-		}
+        return;
     }
 
-    // Also notify UGSMessageListenersObject instances
-    for (TObjectIterator<UGSMessageListenersObject> Itr; Itr; ++Itr)
-    {
-        #if GS_UE_VERSION < GS_MAKE_VERSION(4, 14) // since 4.14 auto-generated enums no longer use TEnumAsByte
-        if(Itr->GetWorld() != nullptr && (Itr->GetWorld()->WorldType.GetValue() == EWorldType::Game || Itr->GetWorld()->WorldType.GetValue() == EWorldType::PIE) && (!Itr->IsPendingKill()))
-        #else
-        if(Itr->GetWorld() != nullptr && (Itr->GetWorld()->WorldType == EWorldType::Game || Itr->GetWorld()->WorldType == EWorldType::PIE) && (!Itr->IsPendingKill()))
-        #endif
-        {
-            Itr->OnGlobalRankChangedMessage.Broadcast(unreal_message);
-        }
-    }
+    FGSGlobalRankChangedMessage unreal_message = ToUnrealStruct<FGSGlobalRankChangedMessage>(message);
+    BroadcastToMessageListeners(unreal_message, &UGSMessageListeners::OnGlobalRankChangedMessage, &UGSMessageListenersObject::OnGlobalRankChangedMessage);
 }
 
 void UGSMessageListeners_OnMatchFoundMessage(GameSparks::Core::GS& gsInstance, const GameSparks::Api::Messages::MatchFoundMessage& message)
 {
-    FGSMatchFoundMessage unreal_message(message.GetBaseData());
-    
-    for ( TObjectIterator<UGSMessageListeners> Itr; Itr; ++Itr )
+    if (!HasMessageListeners(&UGSMessageListeners::OnMatchFoundMessage, &UGSMessageListenersObject::OnMatchFoundMessage))
     {
-        #if GS_UE_VERSION < GS_MAKE_VERSION(4, 14) // since 4.14 auto-generated enums no longer use TEnumAsByte
-        if(Itr->GetWorld() != nullptr && (Itr->GetWorld()->WorldType.GetValue() == EWorldType::Game || Itr->GetWorld()->WorldType.GetValue() == EWorldType::PIE) && (!Itr->IsPendingKill()))
-        #else
-        if(Itr->GetWorld() != nullptr && (Itr->GetWorld()->WorldType == EWorldType::Game || Itr->GetWorld()->WorldType == EWorldType::PIE) && (!Itr->IsPendingKill()))
-        #endif
-		{
-               Itr->OnMatchFoundMessage.Broadcast(unreal_message);
-		}
+        return;
     }
 
-    // Also notify UGSMessageListenersObject instances
-    for (TObjectIterator<UGSMessageListenersObject> Itr; Itr; ++Itr)
-    {
-        #if GS_UE_VERSION < GS_MAKE_VERSION(4, 14) // since 4.14 auto-generated enums no longer use TEnumAsByte
-        if(Itr->GetWorld() != nullptr && (Itr->GetWorld()->WorldType.GetValue() == EWorldType::Game || Itr->GetWorld()->WorldType.GetValue() == EWorldType::PIE) && (!Itr->IsPendingKill()))
-        #else
-        if(Itr->GetWorld() != nullptr && (Itr->GetWorld()->WorldType == EWorldType::Game || Itr->GetWorld()->WorldType == EWorldType::PIE) && (!Itr->IsPendingKill()))
-        #endif
-        {
-            Itr->OnMatchFoundMessage.Broadcast(unreal_message);
-        }
-    }
+    FGSMatchFoundMessage unreal_message = ToUnrealStruct<FGSMatchFoundMessage>(message);
+    BroadcastToMessageListeners(unreal_message, &UGSMessageListeners::OnMatchFoundMessage, &UGSMessageListenersObject::OnMatchFoundMessage);
 }
 
 void UGSMessageListeners_OnMatchNotFoundMessage(GameSparks::Core::GS& gsInstance, const GameSparks::Api::Messages::MatchNotFoundMessage& message)
 {
-    FGSMatchNotFoundMessage unreal_message(message.GetBaseData());
-    
-    for ( TObjectIterator<UGSMessageListeners> Itr; Itr; ++Itr )
+    if (!HasMessageListeners(&UGSMessageListeners::OnMatchNotFoundMessage, &UGSMessageListenersObject::OnMatchNotFoundMessage))
     {
-        #if GS_UE_VERSION < GS_MAKE_VERSION(4, 14) // since 4.14 auto-generated enums no longer use TEnumAsByte
-        if(Itr->GetWorld() != nullptr && (Itr->GetWorld()->WorldType.GetValue() == EWorldType::Game || Itr->GetWorld()->WorldType.GetValue() == EWorldType::PIE) && (!Itr->IsPendingKill()))
-        #else
-        if(Itr->GetWorld() != nullptr && (Itr->GetWorld()->WorldType == EWorldType::Game || Itr->GetWorld()->WorldType == EWorldType::PIE) && (!Itr->IsPendingKill()))
-        #endif
-		{
-               Itr->OnMatchNotFoundMessage.Broadcast(unreal_message);
-		}
+        return;
     }
 
-    // Also notify UGSMessageListenersObject instances
-    for (TObjectIterator<UGSMessageListenersObject> Itr; Itr; ++Itr)
-    {
-        #if GS_UE_VERSION < GS_MAKE_VERSION(4, 14) // since 4.14 auto-generated enums no longer use TEnumAsByte
-        if(Itr->GetWorld() != nullptr && (Itr->GetWorld()->WorldType.GetValue() == EWorldType::Game || Itr->GetWorld()->WorldType.GetValue() == EWorldType::PIE) && (!Itr->IsPendingKill()))
-        #else
-        if(Itr->GetWorld() != nullptr && (Itr->GetWorld()->WorldType == EWorldType::Game || Itr->GetWorld()->WorldType == EWorldType::PIE) && (!Itr->IsPendingKill()))
-        #endif
-        {
-            Itr->OnMatchNotFoundMessage.Broadcast(unreal_message);
-        }
-    }
+    FGSMatchNotFoundMessage unreal_message = ToUnrealStruct<FGSMatchNotFoundMessage>(message);
+    BroadcastToMessageListeners(unreal_message, &UGSMessageListeners::OnMatchNotFoundMessage, &UGSMessageListenersObject::OnMatchNotFoundMessage);
 }
 
 void UGSMessageListeners_OnMatchUpdatedMessage(GameSparks::Core::GS& gsInstance, const GameSparks::Api::Messages::MatchUpdatedMessage& message)
 {
-    FGSMatchUpdatedMessage unreal_message(message.GetBaseData());
-    
-    for ( TObjectIterator<UGSMessageListeners> Itr; Itr; ++Itr )
+    if (!HasMessageListeners(&UGSMessageListeners::OnMatchUpdatedMessage, &UGSMessageListenersObject::OnMatchUpdatedMessage))
     {
-        #if GS_UE_VERSION < GS_MAKE_VERSION(4, 14) // since 4.14 auto-generated enums no longer use TEnumAsByte
-        if(Itr->GetWorld() != nullptr && (Itr->GetWorld()->WorldType.GetValue() == EWorldType::Game || Itr->GetWorld()->WorldType.GetValue() == EWorldType::PIE) && (!Itr->IsPendingKill()))
-        #else
-        if(Itr->GetWorld() != nullptr && (Itr->GetWorld()->WorldType == EWorldType::Game || Itr->GetWorld()->WorldType == EWorldType::PIE) && (!Itr->IsPendingKill()))
-        #endif
-		{
-               Itr->OnMatchUpdatedMessage.Broadcast(unreal_message);
-		}
+        return;
     }
 
-    // Also notify UGSMessageListenersObject instances
-    for (TObjectIterator<UGSMessageListenersObject> Itr; Itr; ++Itr)
-    {
-        #if GS_UE_VERSION < GS_MAKE_VERSION(4, 14) // since 4.14 auto-generated enums no longer use TEnumAsByte
-        if(Itr->GetWorld() != nullptr && (Itr->GetWorld()->WorldType.GetValue() == EWorldType::Game || Itr->GetWorld()->WorldType.GetValue() == EWorldType::PIE) && (!Itr->IsPendingKill()))
-        #else
-        if(Itr->GetWorld() != nullptr && (Itr->GetWorld()->WorldType == EWorldType::Game || Itr->GetWorld()->WorldType == EWorldType::PIE) && (!Itr->IsPendingKill()))
-        #endif
-        {
-            Itr->OnMatchUpdatedMessage.Broadcast(unreal_message);
-        }
-    }
+    FGSMatchUpdatedMessage unreal_message = ToUnrealStruct<FGSMatchUpdatedMessage>(message);
+    BroadcastToMessageListeners(unreal_message, &UGSMessageListeners::OnMatchUpdatedMessage, &UGSMessageListenersObject::OnMatchUpdatedMessage);
 }
 
 void UGSMessageListeners_OnNewHighScoreMessage(GameSparks::Core::GS& gsInstance, const GameSparks::Api::Messages::NewHighScoreMessage& message)
 {
-    FGSNewHighScoreMessage unreal_message(message.GetBaseData());
-    
-    for ( TObjectIterator<UGSMessageListeners> Itr; Itr; ++Itr )
+    if (!HasMessageListeners(&UGSMessageListeners::OnNewHighScoreMessage, &UGSMessageListenersObject::OnNewHighScoreMessage))
     {
-        #if GS_UE_VERSION < GS_MAKE_VERSION(4, 14) // since 4.14 auto-generated enums no longer use TEnumAsByte
-        if(Itr->GetWorld() != nullptr && (Itr->GetWorld()->WorldType.GetValue() == EWorldType::Game || Itr->GetWorld()->WorldType.GetValue() == EWorldType::PIE) && (!Itr->IsPendingKill()))
-        #else
-        if(Itr->GetWorld() != nullptr && (Itr->GetWorld()->WorldType == EWorldType::Game || Itr->GetWorld()->WorldType == EWorldType::PIE) && (!Itr->IsPendingKill()))
-        #endif
-		{
-               Itr->OnNewHighScoreMessage.Broadcast(unreal_message);
-		}
+        return;
     }
 
-    // Also notify UGSMessageListenersObject instances
-    for (TObjectIterator<UGSMessageListenersObject> Itr; Itr; ++Itr)
-    {
-        #if GS_UE_VERSION < GS_MAKE_VERSION(4, 14) // since 4.14 auto-generated enums no longer use TEnumAsByte
-        if(Itr->GetWorld() != nullptr && (Itr->GetWorld()->WorldType.GetValue() == EWorldType::Game || Itr->GetWorld()->WorldType.GetValue() == EWorldType::PIE) && (!Itr->IsPendingKill()))
-        #else
-        if(Itr->GetWorld() != nullptr && (Itr->GetWorld()->WorldType == EWorldType::Game || Itr->GetWorld()->WorldType == EWorldType::PIE) && (!Itr->IsPendingKill()))
-        #endif
-        {
-            Itr->OnNewHighScoreMessage.Broadcast(unreal_message);
-        }
-    }
+    FGSNewHighScoreMessage unreal_message = ToUnrealStruct<FGSNewHighScoreMessage>(message);
+    BroadcastToMessageListeners(unreal_message, &UGSMessageListeners::OnNewHighScoreMessage, &UGSMessageListenersObject::OnNewHighScoreMessage);
 }
 
 void UGSMessageListeners_OnNewTeamScoreMessage(GameSparks::Core::GS& gsInstance, const GameSparks::Api::Messages::NewTeamScoreMessage& message)
 {
-    FGSNewTeamScoreMessage unreal_message(message.GetBaseData());
-    
-    for ( TObjectIterator<UGSMessageListeners> Itr; Itr; ++Itr )
+    if (!HasMessageListeners(&UGSMessageListeners::OnNewTeamScoreMessage, &UGSMessageListenersObject::OnNewTeamScoreMessage))
     {
-        #if GS_UE_VERSION < GS_MAKE_VERSION(4, 14) // since 4.14 auto-generated enums no longer use TEnumAsByte
-        if(Itr->GetWorld() != nullptr && (Itr->GetWorld()->WorldType.GetValue() == EWorldType::Game || Itr->GetWorld()->WorldType.GetValue() == EWorldType::PIE) && (!Itr->IsPendingKill()))
-        #else
-        if(Itr->GetWorld() != nullptr && (Itr->GetWorld()->WorldType == EWorldType::Game || Itr->GetWorld()->WorldType == EWorldType::PIE) && (!Itr->IsPendingKill()))
-        #endif
-		{
-               Itr->OnNewTeamScoreMessage.Broadcast(unreal_message);
-		}
+        return;
     }
 
-    // Also notify UGSMessageListenersObject instances
-    for (TObjectIterator<UGSMessageListenersObject> Itr; Itr; ++Itr)
-    {
-        #if GS_UE_VERSION < GS_MAKE_VERSION(4, 14) // since 4.14 auto-generated enums no longer use TEnumAsByte
-        if(Itr->GetWorld() != nullptr && (Itr->GetWorld()->WorldType.GetValue() == EWorldType::Game || Itr->GetWorld()->WorldType.GetValue() == EWorldType::PIE) && (!Itr->IsPendingKill()))
-        #else
-        if(Itr->GetWorld() != nullptr && (Itr->GetWorld()->WorldType == EWorldType::Game || Itr->GetWorld()->WorldType == EWorldType::PIE) && (!Itr->IsPendingKill()))
-        #endif
-        {
-            Itr->OnNewTeamScoreMessage.Broadcast(unreal_message);
-        }
-    }
+    FGSNewTeamScoreMessage unreal_message = ToUnrealStruct<FGSNewTeamScoreMessage>(message);
+    BroadcastToMessageListeners(unreal_message, &UGSMessageListeners::OnNewTeamScoreMessage, &UGSMessageListenersObject::OnNewTeamScoreMessage);
 }
 
 void UGSMessageListeners_OnScriptMessage(GameSparks::Core::GS& gsInstance, const GameSparks::Api::Messages::ScriptMessage& message)
 {
-    FGSScriptMessage unreal_message(message.GetBaseData());
-    
-    for ( TObjectIterator<UGSMessageListeners> Itr; Itr; ++Itr )
+    if (!HasMessageListeners(&UGSMessageListeners::OnScriptMessage, &UGSMessageListenersObject::OnScriptMessage))
     {
-        #if GS_UE_VERSION < GS_MAKE_VERSION(4, 14) // since 4.14 auto-generated enums no longer use TEnumAsByte
-        if(Itr->GetWorld() != nullptr && (Itr->GetWorld()->WorldType.GetValue() == EWorldType::Game || Itr->GetWorld()->WorldType.GetValue() == EWorldType::PIE) && (!Itr->IsPendingKill()))
-        #else
-        if(Itr->GetWorld() != nullptr && (Itr->GetWorld()->WorldType == EWorldType::Game || Itr->GetWorld()->WorldType == EWorldType::PIE) && (!Itr->IsPendingKill()))
-        #endif
-		{
-               Itr->OnScriptMessage.Broadcast(unreal_message);
-		}
+        return;
     }
 
-    // Also notify UGSMessageListenersObject instances
-    for (TObjectIterator<UGSMessageListenersObject> Itr; Itr; ++Itr)
-    {
-        #if GS_UE_VERSION < GS_MAKE_VERSION(4, 14) // since 4.14 auto-generated enums no longer use TEnumAsByte
-        if(Itr->GetWorld() != nullptr && (Itr->GetWorld()->WorldType.GetValue() == EWorldType::Game || Itr->GetWorld()->WorldType.GetValue() == EWorldType::PIE) && (!Itr->IsPendingKill()))
-        #else
-        if(Itr->GetWorld() != nullptr && (Itr->GetWorld()->WorldType == EWorldType::Game || Itr->GetWorld()->WorldType == EWorldType::PIE) && (!Itr->IsPendingKill()))
-        #endif
-        {
-            Itr->OnScriptMessage.Broadcast(unreal_message);
-        }
-    }
+    FGSScriptMessage unreal_message = ToUnrealStruct<FGSScriptMessage>(message);
+    BroadcastToMessageListeners(unreal_message, &UGSMessageListeners::OnScriptMessage, &UGSMessageListenersObject::OnScriptMessage);
 }
 
 void UGSMessageListeners_OnSessionTerminatedMessage(GameSparks::Core::GS& gsInstance, const GameSparks::Api::Messages::SessionTerminatedMessage& message)
 {
-    FGSSessionTerminatedMessage unreal_message(message.GetBaseData());
-    
-    for ( TObjectIterator<UGSMessageListeners> Itr; Itr; ++Itr )
+    if (!HasMessageListeners(&UGSMessageListeners::OnSessionTerminatedMessage, &UGSMessageListenersObject::OnSessionTerminatedMessage))
     {
-        #if GS_UE_VERSION < GS_MAKE_VERSION(4, 14) // since 4.14 auto-generated enums no longer use TEnumAsByte
-        if(Itr->GetWorld() != nullptr && (Itr->GetWorld()->WorldType.GetValue() == EWorldType::Game || Itr->GetWorld()->WorldType.GetValue() == EWorldType::PIE) && (!Itr->IsPendingKill()))
-        #else
-        if(Itr->GetWorld() != nullptr && (Itr->GetWorld()->WorldType == EWorldType::Game || Itr->GetWorld()->WorldType == EWorldType::PIE) && (!Itr->IsPendingKill()))
-        #endif
-		{
-               Itr->OnSessionTerminatedMessage.Broadcast(unreal_message);
-		}
+        return;
     }
 
-    // Also notify UGSMessageListenersObject instances
-    for (TObjectIterator<UGSMessageListenersObject> Itr; Itr; ++Itr)
-    {
-        #if GS_UE_VERSION < GS_MAKE_VERSION(4, 14) // since 4.14 auto-generated enums no longer use TEnumAsByte
-        if(Itr->GetWorld() != nullptr && (Itr->GetWorld()->WorldType.GetValue() == EWorldType::Game || Itr->GetWorld()->WorldType.GetValue() == EWorldType::PIE) && (!Itr->IsPendingKill()))
-        #else
-        if(Itr->GetWorld() != nullptr && (Itr->GetWorld()->WorldType == EWorldType::Game || Itr->GetWorld()->WorldType == EWorldType::PIE) && (!Itr->IsPendingKill()))
-        #endif
-        {
-            Itr->OnSessionTerminatedMessage.Broadcast(unreal_message);
-        }
-    }
+    FGSSessionTerminatedMessage unreal_message = ToUnrealStruct<FGSSessionTerminatedMessage>(message);
+    BroadcastToMessageListeners(unreal_message, &UGSMessageListeners::OnSessionTerminatedMessage, &UGSMessageListenersObject::OnSessionTerminatedMessage);
 }
 
 void UGSMessageListeners_OnSocialRankChangedMessage(GameSparks::Core::GS& gsInstance, const GameSparks::Api::Messages::SocialRankChangedMessage& message)
 {
-    FGSSocialRankChangedMessage unreal_message(message.GetBaseData());
-    
-    for ( TObjectIterator<UGSMessageListeners> Itr; Itr; ++Itr )
+    if (!HasMessageListeners(&UGSMessageListeners::OnSocialRankChangedMessage, &UGSMessageListenersObject::OnSocialRankChangedMessage))
     {
-        #if GS_UE_VERSION < GS_MAKE_VERSION(4, 14) // since 4.14 auto-generated enums no longer use TEnumAsByte
-        if(Itr->GetWorld() != nullptr && (Itr->GetWorld()->WorldType.GetValue() == EWorldType::Game || Itr->GetWorld()->WorldType.GetValue() == EWorldType::PIE) && (!Itr->IsPendingKill()))
-        #else
-        if(Itr->GetWorld() != nullptr && (Itr->GetWorld()->WorldType == EWorldType::Game || Itr->GetWorld()->WorldType == EWorldType::PIE) && (!Itr->IsPendingKill()))
-        #endif
-		{
-               Itr->OnSocialRankChangedMessage.Broadcast(unreal_message);
-		}
+        return;
     }
 
-    // Also notify UGSMessageListenersObject instances
-    for (TObjectIterator<UGSMessageListenersObject> Itr; Itr; ++Itr)
-    {
-        #if GS_UE_VERSION < GS_MAKE_VERSION(4, 14) // since 4.14 auto-generated enums no longer use TEnumAsByte
-        if(Itr->GetWorld() != nullptr && (Itr->GetWorld()->WorldType.GetValue() == EWorldType::Game || Itr->GetWorld()->WorldType.GetValue() == EWorldType::PIE) && (!Itr->IsPendingKill()))
-        #else
-        if(Itr->GetWorld() != nullptr && (Itr->GetWorld()->WorldType == EWorldType::Game || Itr->GetWorld()->WorldType == EWorldType::PIE) && (!Itr->IsPendingKill()))
-        #endif
-        {
-            Itr->OnSocialRankChangedMessage.Broadcast(unreal_message);
-        }
-    }
+    FGSSocialRankChangedMessage unreal_message = ToUnrealStruct<FGSSocialRankChangedMessage>(message);
+    BroadcastToMessageListeners(unreal_message, &UGSMessageListeners::OnSocialRankChangedMessage, &UGSMessageListenersObject::OnSocialRankChangedMessage);
 }
 
 void UGSMessageListeners_OnTeamChatMessage(GameSparks::Core::GS& gsInstance, const GameSparks::Api::Messages::TeamChatMessage& message)
 {
-    FGSTeamChatMessage unreal_message(message.GetBaseData());
-    
-    for ( TObjectIterator<UGSMessageListeners> Itr; Itr; ++Itr )
+    if (!HasMessageListeners(&UGSMessageListeners::OnTeamChatMessage, &UGSMessageListenersObject::OnTeamChatMessage))
     {
-        #if GS_UE_VERSION < GS_MAKE_VERSION(4, 14) // since 4.14 auto-generated enums no longer use TEnumAsByte
-        if(Itr->GetWorld() != nullptr && (Itr->GetWorld()->WorldType.GetValue() == EWorldType::Game || Itr->GetWorld()->WorldType.GetValue() == EWorldType::PIE) && (!Itr->IsPendingKill()))
-        #else
-        if(Itr->GetWorld() != nullptr && (Itr->GetWorld()->WorldType == EWorldType::Game || Itr->GetWorld()->WorldType == EWorldType::PIE) && (!Itr->IsPendingKill()))
-        #endif
-		{
-               Itr->OnTeamChatMessage.Broadcast(unreal_message);
-		}
+        return;
     }
 
-    // Also notify UGSMessageListenersObject instances
-    for (TObjectIterator<UGSMessageListenersObject> Itr; Itr; ++Itr)
-    {
-        #if GS_UE_VERSION < GS_MAKE_VERSION(4, 14) // since 4.14 auto-generated enums no longer use TEnumAsByte
-        if(Itr->GetWorld() != nullptr && (Itr->GetWorld()->WorldType.GetValue() == EWorldType::Game || Itr->GetWorld()->WorldType.GetValue() == EWorldType::PIE) && (!Itr->IsPendingKill()))
-        #else
-        if(Itr->GetWorld() != nullptr && (Itr->GetWorld()->WorldType == EWorldType::Game || Itr->GetWorld()->WorldType == EWorldType::PIE) && (!Itr->IsPendingKill()))
-        #endif
-        {
-            Itr->OnTeamChatMessage.Broadcast(unreal_message);
-        }
-    }
+    FGSTeamChatMessage unreal_message = ToUnrealStruct<FGSTeamChatMessage>(message);
+    BroadcastToMessageListeners(unreal_message, &UGSMessageListeners::OnTeamChatMessage, &UGSMessageListenersObject::OnTeamChatMessage);
 }
 
 void UGSMessageListeners_OnTeamRankChangedMessage(GameSparks::Core::GS& gsInstance, const GameSparks::Api::Messages::TeamRankChangedMessage& message)
 {
-    FGSTeamRankChangedMessage unreal_message(message.GetBaseData());
-    
-    for ( TObjectIterator<UGSMessageListeners> Itr; Itr; ++Itr )
+    if (!HasMessageListeners(&UGSMessageListeners::OnTeamRankChangedMessage, &UGSMessageListenersObject::OnTeamRankChangedMessage))
     {
-        #if GS_UE_VERSION < GS_MAKE_VERSION(4, 14) // since 4.14 auto-generated enums no longer use TEnumAsByte
-        if(Itr->GetWorld() != nullptr && (Itr->GetWorld()->WorldType.GetValue() == EWorldType::Game || Itr->GetWorld()->WorldType.GetValue() == EWorldType::PIE) && (!Itr->IsPendingKill()))
-        #else
-        if(Itr->GetWorld() != nullptr && (Itr->GetWorld()->WorldType == EWorldType::Game || Itr->GetWorld()->WorldType == EWorldType::PIE) && (!Itr->IsPendingKill()))
-        #endif
-		{
-               Itr->OnTeamRankChangedMessage.Broadcast(unreal_message);
-		}
+        return;
     }
 
-    // Also notify UGSMessageListenersObject instances
-    for (TObjectIterator<UGSMessageListenersObject> Itr; Itr; ++Itr)
-    {
-        #if GS_UE_VERSION < GS_MAKE_VERSION(4, 14) // since 4.14 auto-generated enums no longer use TEnumAsByte
-        if(Itr->GetWorld() != nullptr && (Itr->GetWorld()->WorldType.GetValue() == EWorldType::Game || Itr->GetWorld()->WorldType.GetValue() == EWorldType::PIE) && (!Itr->IsPendingKill()))
-        #else
-        if(Itr->GetWorld() != nullptr && (Itr->GetWorld()->WorldType == EWorldType::Game || Itr->GetWorld()->WorldType == EWorldType::PIE) && (!Itr->IsPendingKill()))
-        #endif
-        {
-            Itr->OnTeamRankChangedMessage.Broadcast(unreal_message);
-        }
-    }
+    FGSTeamRankChangedMessage unreal_message = ToUnrealStruct<FGSTeamRankChangedMessage>(message);
+    BroadcastToMessageListeners(unreal_message, &UGSMessageListeners::OnTeamRankChangedMessage, &UGSMessageListenersObject::OnTeamRankChangedMessage);
 }
 
 void UGSMessageListeners_OnUploadCompleteMessage(GameSparks::Core::GS& gsInstance, const GameSparks::Api::Messages::UploadCompleteMessage& message)
 {
-    FGSUploadCompleteMessage unreal_message(message.GetBaseData());
-    
-    for ( TObjectIterator<UGSMessageListeners> Itr; Itr; ++Itr )
+    if (!HasMessageListeners(&UGSMessageListeners::OnUploadCompleteMessage, &UGSMessageListenersObject::OnUploadCompleteMessage))
     {
-        #if GS_UE_VERSION < GS_MAKE_VERSION(4, 14) // since 4.14 auto-generated enums no longer use TEnumAsByte
-        if(Itr->GetWorld() != nullptr && (Itr->GetWorld()->WorldType.GetValue() == EWorldType::Game || Itr->GetWorld()->WorldType.GetValue() == EWorldType::PIE) && (!Itr->IsPendingKill()))
-        #else
-        if(Itr->GetWorld() != nullptr && (Itr->GetWorld()->WorldType == EWorldType::Game || Itr->GetWorld()->WorldType == EWorldType::PIE) && (!Itr->IsPendingKill()))
-        #endif
-		{
-               Itr->OnUploadCompleteMessage.Broadcast(unreal_message);
-		}
+        return;
     }
 
-    // Also notify UGSMessageListenersObject instances
-    for (TObjectIterator<UGSMessageListenersObject> Itr; Itr; ++Itr)
+    FGSUploadCompleteMessage unreal_message = ToUnrealStruct<FGSUploadCompleteMessage>(message);
+    BroadcastToMessageListeners(unreal_message, &UGSMessageListeners::OnUploadCompleteMessage, &UGSMessageListenersObject::OnUploadCompleteMessage);
+}
+
+
+UGSMessageListeners::UGSMessageListeners()
+{
+    #if GS_UE_VERSION < GS_MAKE_VERSION(4, 14) // since 4.14 BeginPlay() is called for every component
+    bWantsBeginPlay = true;
+    #endif
+}
+
+void UGSMessageListeners::BeginPlay()
+{
+    Super::BeginPlay();
+
+    if (UGameSparksModule* Module = UGameSparksModule::GetModulePtr())
     {
-        #if GS_UE_VERSION < GS_MAKE_VERSION(4, 14) // since 4.14 auto-generated enums no longer use TEnumAsByte
-        if(Itr->GetWorld() != nullptr && (Itr->GetWorld()->WorldType.GetValue() == EWorldType::Game || Itr->GetWorld()->WorldType.GetValue() == EWorldType::PIE) && (!Itr->IsPendingKill()))
-        #else
-        if(Itr->GetWorld() != nullptr && (Itr->GetWorld()->WorldType == EWorldType::Game || Itr->GetWorld()->WorldType == EWorldType::PIE) && (!Itr->IsPendingKill()))
-        #endif
-        {
-            Itr->OnUploadCompleteMessage.Broadcast(unreal_message);
-        }
+        Module->AddMessageListener(this);
     }
 }
 
+void UGSMessageListeners::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (UGameSparksModule* Module = UGameSparksModule::GetModulePtr())
+    {
+        Module->RemoveMessageListener(this);
+    }
 
-UGSMessageListeners::UGSMessageListeners(){}
+    Super::EndPlay(EndPlayReason);
+}
 
 void UGSMessageListeners::RegisterListeners(GS& GS)
 {
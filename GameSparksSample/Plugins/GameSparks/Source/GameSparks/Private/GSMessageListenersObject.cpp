@@ -11,3 +11,26 @@ class UWorld* UGSMessageListenersObject::GetWorld() const
 {
     return GetOuter()->GetWorld();
 }
+
+void UGSMessageListenersObject::PostInitProperties()
+{
+    Super::PostInitProperties();
+
+    if (!HasAnyFlags(RF_ClassDefaultObject | RF_ArchetypeObject))
+    {
+        if (UGameSparksModule* Module = UGameSparksModule::GetModulePtr())
+        {
+            Module->AddMessageListener(this);
+        }
+    }
+}
+
+void UGSMessageListenersObject::BeginDestroy()
+{
+    if (UGameSparksModule* Module = UGameSparksModule::GetModulePtr())
+    {
+        Module->RemoveMessageListener(this);
+    }
+
+    Super::BeginDestroy();
+}
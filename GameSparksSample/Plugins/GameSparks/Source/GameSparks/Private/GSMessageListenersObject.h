@@ -16,6 +16,10 @@ public:
     UGSMessageListenersObject();
     virtual class UWorld* GetWorld() const override;
 
+    /// registers this object with the module, so that messages are dispatched to it
+    virtual void PostInitProperties() override;
+    virtual void BeginDestroy() override;
+
 	DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnAchievementEarnedMessage, FGSAchievementEarnedMessage, AchievementEarnedMessage);
 	UPROPERTY(BlueprintAssignable, Category = GameSparks)
 	FOnAchievementEarnedMessage OnAchievementEarnedMessage;
@@ -493,9 +493,10 @@ struct FGSVirtualGood
 	
 	if(wrappedData.ContainsKey("bundledGoods")){
 		HasBundledGoods = true;
-			for(std::size_t i=0; i < wrappedData.GetGSDataObjectList("bundledGoods").size(); i++){
-				FGSBundledGood BundledGoods_tmp = FGSBundledGood(wrappedData.GetGSDataObjectList("bundledGoods")[i]);
-				BundledGoods.Add(BundledGoods_tmp);
+			const gsstl::vector<GameSparks::Core::GSData> BundledGoods_list = wrappedData.GetGSDataObjectList("bundledGoods");
+			BundledGoods.Reserve(BundledGoods_list.size());
+			for(std::size_t i=0; i < BundledGoods_list.size(); i++){
+				BundledGoods.Add(FGSBundledGood(BundledGoods_list[i]));
             }
 		}
 		
@@ -923,9 +924,10 @@ struct FGSPlayer
 	
 	if(wrappedData.ContainsKey("achievements")){
 		HasAchievements = true;
-			for(std::size_t i=0; i < wrappedData.GetStringList("achievements").size(); i++){
-				FString Achievements_tmp = FString(UTF8_TO_TCHAR(wrappedData.GetStringList("achievements")[i].c_str()));
-				Achievements.Add(Achievements_tmp);
+			const gsstl::vector<gsstl::string> Achievements_list = wrappedData.GetStringList("achievements");
+			Achievements.Reserve(Achievements_list.size());
+			for(std::size_t i=0; i < Achievements_list.size(); i++){
+				Achievements.Add(FString(UTF8_TO_TCHAR(Achievements_list[i].c_str())));
             }
 		}
 		
@@ -962,9 +964,10 @@ struct FGSPlayer
 	
 	if(wrappedData.ContainsKey("virtualGoods")){
 		HasVirtualGoods = true;
-			for(std::size_t i=0; i < wrappedData.GetStringList("virtualGoods").size(); i++){
-				FString VirtualGoods_tmp = FString(UTF8_TO_TCHAR(wrappedData.GetStringList("virtualGoods")[i].c_str()));
-				VirtualGoods.Add(VirtualGoods_tmp);
+			const gsstl::vector<gsstl::string> VirtualGoods_list = wrappedData.GetStringList("virtualGoods");
+			VirtualGoods.Reserve(VirtualGoods_list.size());
+			for(std::size_t i=0; i < VirtualGoods_list.size(); i++){
+				VirtualGoods.Add(FString(UTF8_TO_TCHAR(VirtualGoods_list[i].c_str())));
             }
 		}
 		
@@ -1049,9 +1052,10 @@ struct FGSTeam
 	
 	if(wrappedData.ContainsKey("members")){
 		HasMembers = true;
-			for(std::size_t i=0; i < wrappedData.GetGSDataObjectList("members").size(); i++){
-				FGSPlayer Members_tmp = FGSPlayer(wrappedData.GetGSDataObjectList("members")[i]);
-				Members.Add(Members_tmp);
+			const gsstl::vector<GameSparks::Core::GSData> Members_list = wrappedData.GetGSDataObjectList("members");
+			Members.Reserve(Members_list.size());
+			for(std::size_t i=0; i < Members_list.size(); i++){
+				Members.Add(FGSPlayer(Members_list[i]));
             }
 		}
 		
@@ -1790,9 +1794,10 @@ struct FGSPendingMatch
 	
 	if(wrappedData.ContainsKey("matchedPlayers")){
 		HasMatchedPlayers = true;
-			for(std::size_t i=0; i < wrappedData.GetGSDataObjectList("matchedPlayers").size(); i++){
-				FGSMatchedPlayer MatchedPlayers_tmp = FGSMatchedPlayer(wrappedData.GetGSDataObjectList("matchedPlayers")[i]);
-				MatchedPlayers.Add(MatchedPlayers_tmp);
+			const gsstl::vector<GameSparks::Core::GSData> MatchedPlayers_list = wrappedData.GetGSDataObjectList("matchedPlayers");
+			MatchedPlayers.Reserve(MatchedPlayers_list.size());
+			for(std::size_t i=0; i < MatchedPlayers_list.size(); i++){
+				MatchedPlayers.Add(FGSMatchedPlayer(MatchedPlayers_list[i]));
             }
 		}
 		
@@ -1875,9 +1880,10 @@ struct FGSParticipant
 	
 	if(wrappedData.ContainsKey("achievements")){
 		HasAchievements = true;
-			for(std::size_t i=0; i < wrappedData.GetStringList("achievements").size(); i++){
-				FString Achievements_tmp = FString(UTF8_TO_TCHAR(wrappedData.GetStringList("achievements")[i].c_str()));
-				Achievements.Add(Achievements_tmp);
+			const gsstl::vector<gsstl::string> Achievements_list = wrappedData.GetStringList("achievements");
+			Achievements.Reserve(Achievements_list.size());
+			for(std::size_t i=0; i < Achievements_list.size(); i++){
+				Achievements.Add(FString(UTF8_TO_TCHAR(Achievements_list[i].c_str())));
             }
 		}
 		
@@ -1926,9 +1932,10 @@ struct FGSParticipant
 	
 	if(wrappedData.ContainsKey("virtualGoods")){
 		HasVirtualGoods = true;
-			for(std::size_t i=0; i < wrappedData.GetStringList("virtualGoods").size(); i++){
-				FString VirtualGoods_tmp = FString(UTF8_TO_TCHAR(wrappedData.GetStringList("virtualGoods")[i].c_str()));
-				VirtualGoods.Add(VirtualGoods_tmp);
+			const gsstl::vector<gsstl::string> VirtualGoods_list = wrappedData.GetStringList("virtualGoods");
+			VirtualGoods.Reserve(VirtualGoods_list.size());
+			for(std::size_t i=0; i < VirtualGoods_list.size(); i++){
+				VirtualGoods.Add(FString(UTF8_TO_TCHAR(VirtualGoods_list[i].c_str())));
             }
 		}
 		
@@ -2094,9 +2101,10 @@ struct FGSPlayerTransaction
 	
 	if(wrappedData.ContainsKey("items")){
 		HasItems = true;
-			for(std::size_t i=0; i < wrappedData.GetGSDataObjectList("items").size(); i++){
-				FGSPlayerTransactionItem Items_tmp = FGSPlayerTransactionItem(wrappedData.GetGSDataObjectList("items")[i]);
-				Items.Add(Items_tmp);
+			const gsstl::vector<GameSparks::Core::GSData> Items_list = wrappedData.GetGSDataObjectList("items");
+			Items.Reserve(Items_list.size());
+			for(std::size_t i=0; i < Items_list.size(); i++){
+				Items.Add(FGSPlayerTransactionItem(Items_list[i]));
             }
 		}
 		
@@ -2306,9 +2314,10 @@ struct FGSChallenge
 	
 	if(wrappedData.ContainsKey("accepted")){
 		HasAccepted = true;
-			for(std::size_t i=0; i < wrappedData.GetGSDataObjectList("accepted").size(); i++){
-				FGSPlayerDetail Accepted_tmp = FGSPlayerDetail(wrappedData.GetGSDataObjectList("accepted")[i]);
-				Accepted.Add(Accepted_tmp);
+			const gsstl::vector<GameSparks::Core::GSData> Accepted_list = wrappedData.GetGSDataObjectList("accepted");
+			Accepted.Reserve(Accepted_list.size());
+			for(std::size_t i=0; i < Accepted_list.size(); i++){
+				Accepted.Add(FGSPlayerDetail(Accepted_list[i]));
             }
 		}
 		
@@ -2333,9 +2342,10 @@ struct FGSChallenge
 	
 	if(wrappedData.ContainsKey("challenged")){
 		HasChallenged = true;
-			for(std::size_t i=0; i < wrappedData.GetGSDataObjectList("challenged").size(); i++){
-				FGSPlayerDetail Challenged_tmp = FGSPlayerDetail(wrappedData.GetGSDataObjectList("challenged")[i]);
-				Challenged.Add(Challenged_tmp);
+			const gsstl::vector<GameSparks::Core::GSData> Challenged_list = wrappedData.GetGSDataObjectList("challenged");
+			Challenged.Reserve(Challenged_list.size());
+			for(std::size_t i=0; i < Challenged_list.size(); i++){
+				Challenged.Add(FGSPlayerDetail(Challenged_list[i]));
             }
 		}
 		
@@ -2390,9 +2400,10 @@ struct FGSChallenge
 	
 	if(wrappedData.ContainsKey("declined")){
 		HasDeclined = true;
-			for(std::size_t i=0; i < wrappedData.GetGSDataObjectList("declined").size(); i++){
-				FGSPlayerDetail Declined_tmp = FGSPlayerDetail(wrappedData.GetGSDataObjectList("declined")[i]);
-				Declined.Add(Declined_tmp);
+			const gsstl::vector<GameSparks::Core::GSData> Declined_list = wrappedData.GetGSDataObjectList("declined");
+			Declined.Reserve(Declined_list.size());
+			for(std::size_t i=0; i < Declined_list.size(); i++){
+				Declined.Add(FGSPlayerDetail(Declined_list[i]));
             }
 		}
 		
@@ -2447,9 +2458,10 @@ struct FGSChallenge
 	
 	if(wrappedData.ContainsKey("turnCount")){
 		HasTurnCount = true;
-			for(std::size_t i=0; i < wrappedData.GetGSDataObjectList("turnCount").size(); i++){
-				FGSPlayerTurnCount TurnCount_tmp = FGSPlayerTurnCount(wrappedData.GetGSDataObjectList("turnCount")[i]);
-				TurnCount.Add(TurnCount_tmp);
+			const gsstl::vector<GameSparks::Core::GSData> TurnCount_list = wrappedData.GetGSDataObjectList("turnCount");
+			TurnCount.Reserve(TurnCount_list.size());
+			for(std::size_t i=0; i < TurnCount_list.size(); i++){
+				TurnCount.Add(FGSPlayerTurnCount(TurnCount_list[i]));
             }
 		}
 		
@@ -2816,9 +2828,10 @@ struct FGSLeaderboardRankDetails
 	
 	if(wrappedData.ContainsKey("friendsPassed")){
 		HasFriendsPassed = true;
-			for(std::size_t i=0; i < wrappedData.GetGSDataObjectList("friendsPassed").size(); i++){
-				FGSLeaderboardData FriendsPassed_tmp = FGSLeaderboardData(wrappedData.GetGSDataObjectList("friendsPassed")[i]);
-				FriendsPassed.Add(FriendsPassed_tmp);
+			const gsstl::vector<GameSparks::Core::GSData> FriendsPassed_list = wrappedData.GetGSDataObjectList("friendsPassed");
+			FriendsPassed.Reserve(FriendsPassed_list.size());
+			for(std::size_t i=0; i < FriendsPassed_list.size(); i++){
+				FriendsPassed.Add(FGSLeaderboardData(FriendsPassed_list[i]));
             }
 		}
 		
@@ -2885,9 +2898,10 @@ struct FGSLeaderboardRankDetails
 	
 	if(wrappedData.ContainsKey("topNPassed")){
 		HasTopNPassed = true;
-			for(std::size_t i=0; i < wrappedData.GetGSDataObjectList("topNPassed").size(); i++){
-				FGSLeaderboardData TopNPassed_tmp = FGSLeaderboardData(wrappedData.GetGSDataObjectList("topNPassed")[i]);
-				TopNPassed.Add(TopNPassed_tmp);
+			const gsstl::vector<GameSparks::Core::GSData> TopNPassed_list = wrappedData.GetGSDataObjectList("topNPassed");
+			TopNPassed.Reserve(TopNPassed_list.size());
+			for(std::size_t i=0; i < TopNPassed_list.size(); i++){
+				TopNPassed.Add(FGSLeaderboardData(TopNPassed_list[i]));
             }
 		}
 		
@@ -3156,9 +3170,10 @@ struct FGSAccountDetailsResponse
 	
 	if(wrappedData.ContainsKey("achievements")){
 		HasAchievements = true;
-			for(std::size_t i=0; i < wrappedData.GetStringList("achievements").size(); i++){
-				FString Achievements_tmp = FString(UTF8_TO_TCHAR(wrappedData.GetStringList("achievements")[i].c_str()));
-				Achievements.Add(Achievements_tmp);
+			const gsstl::vector<gsstl::string> Achievements_list = wrappedData.GetStringList("achievements");
+			Achievements.Reserve(Achievements_list.size());
+			for(std::size_t i=0; i < Achievements_list.size(); i++){
+				Achievements.Add(FString(UTF8_TO_TCHAR(Achievements_list[i].c_str())));
             }
 		}
 		
@@ -3530,27 +3545,30 @@ struct FGSAroundMeLeaderboardResponse
 	
 	if(wrappedData.ContainsKey("data")){
 		HasData = true;
-			for(std::size_t i=0; i < wrappedData.GetGSDataObjectList("data").size(); i++){
-				FGSLeaderboardData Data_tmp = FGSLeaderboardData(wrappedData.GetGSDataObjectList("data")[i]);
-				Data.Add(Data_tmp);
+			const gsstl::vector<GameSparks::Core::GSData> Data_list = wrappedData.GetGSDataObjectList("data");
+			Data.Reserve(Data_list.size());
+			for(std::size_t i=0; i < Data_list.size(); i++){
+				Data.Add(FGSLeaderboardData(Data_list[i]));
             }
 		}
 		
 	
 	if(wrappedData.ContainsKey("first")){
 		HasFirst = true;
-			for(std::size_t i=0; i < wrappedData.GetGSDataObjectList("first").size(); i++){
-				FGSLeaderboardData First_tmp = FGSLeaderboardData(wrappedData.GetGSDataObjectList("first")[i]);
-				First.Add(First_tmp);
+			const gsstl::vector<GameSparks::Core::GSData> First_list = wrappedData.GetGSDataObjectList("first");
+			First.Reserve(First_list.size());
+			for(std::size_t i=0; i < First_list.size(); i++){
+				First.Add(FGSLeaderboardData(First_list[i]));
             }
 		}
 		
 	
 	if(wrappedData.ContainsKey("last")){
 		HasLast = true;
-			for(std::size_t i=0; i < wrappedData.GetGSDataObjectList("last").size(); i++){
-				FGSLeaderboardData Last_tmp = FGSLeaderboardData(wrappedData.GetGSDataObjectList("last")[i]);
-				Last.Add(Last_tmp);
+			const gsstl::vector<GameSparks::Core::GSData> Last_list = wrappedData.GetGSDataObjectList("last");
+			Last.Reserve(Last_list.size());
+			for(std::size_t i=0; i < Last_list.size(); i++){
+				Last.Add(FGSLeaderboardData(Last_list[i]));
             }
 		}
 		
@@ -3870,9 +3888,10 @@ struct FGSBuyVirtualGoodResponse
 	
 	if(wrappedData.ContainsKey("boughtItems")){
 		HasBoughtItems = true;
-			for(std::size_t i=0; i < wrappedData.GetGSDataObjectList("boughtItems").size(); i++){
-				FGSBoughtitem BoughtItems_tmp = FGSBoughtitem(wrappedData.GetGSDataObjectList("boughtItems")[i]);
-				BoughtItems.Add(BoughtItems_tmp);
+			const gsstl::vector<GameSparks::Core::GSData> BoughtItems_list = wrappedData.GetGSDataObjectList("boughtItems");
+			BoughtItems.Reserve(BoughtItems_list.size());
+			for(std::size_t i=0; i < BoughtItems_list.size(); i++){
+				BoughtItems.Add(FGSBoughtitem(BoughtItems_list[i]));
             }
 		}
 		
@@ -3939,9 +3958,10 @@ struct FGSBuyVirtualGoodResponse
 	
 	if(wrappedData.ContainsKey("invalidItems")){
 		HasInvalidItems = true;
-			for(std::size_t i=0; i < wrappedData.GetStringList("invalidItems").size(); i++){
-				FString InvalidItems_tmp = FString(UTF8_TO_TCHAR(wrappedData.GetStringList("invalidItems")[i].c_str()));
-				InvalidItems.Add(InvalidItems_tmp);
+			const gsstl::vector<gsstl::string> InvalidItems_list = wrappedData.GetStringList("invalidItems");
+			InvalidItems.Reserve(InvalidItems_list.size());
+			for(std::size_t i=0; i < InvalidItems_list.size(); i++){
+				InvalidItems.Add(FString(UTF8_TO_TCHAR(InvalidItems_list[i].c_str())));
             }
 		}
 		
@@ -3960,9 +3980,10 @@ struct FGSBuyVirtualGoodResponse
 	
 	if(wrappedData.ContainsKey("transactionIds")){
 		HasTransactionIds = true;
-			for(std::size_t i=0; i < wrappedData.GetStringList("transactionIds").size(); i++){
-				FString TransactionIds_tmp = FString(UTF8_TO_TCHAR(wrappedData.GetStringList("transactionIds")[i].c_str()));
-				TransactionIds.Add(TransactionIds_tmp);
+			const gsstl::vector<gsstl::string> TransactionIds_list = wrappedData.GetStringList("transactionIds");
+			TransactionIds.Reserve(TransactionIds_list.size());
+			for(std::size_t i=0; i < TransactionIds_list.size(); i++){
+				TransactionIds.Add(FString(UTF8_TO_TCHAR(TransactionIds_list[i].c_str())));
             }
 		}
 		
@@ -4102,9 +4123,10 @@ struct FGSCancelBulkJobAdminResponse
 	
 	if(wrappedData.ContainsKey("bulkJobs")){
 		HasBulkJobs = true;
-			for(std::size_t i=0; i < wrappedData.GetGSDataObjectList("bulkJobs").size(); i++){
-				FGSBulkJob BulkJobs_tmp = FGSBulkJob(wrappedData.GetGSDataObjectList("bulkJobs")[i]);
-				BulkJobs.Add(BulkJobs_tmp);
+			const gsstl::vector<GameSparks::Core::GSData> BulkJobs_list = wrappedData.GetGSDataObjectList("bulkJobs");
+			BulkJobs.Reserve(BulkJobs_list.size());
+			for(std::size_t i=0; i < BulkJobs_list.size(); i++){
+				BulkJobs.Add(FGSBulkJob(BulkJobs_list[i]));
             }
 		}
 		
@@ -4457,9 +4479,10 @@ struct FGSCreateTeamResponse
 	
 	if(wrappedData.ContainsKey("members")){
 		HasMembers = true;
-			for(std::size_t i=0; i < wrappedData.GetGSDataObjectList("members").size(); i++){
-				FGSPlayer Members_tmp = FGSPlayer(wrappedData.GetGSDataObjectList("members")[i]);
-				Members.Add(Members_tmp);
+			const gsstl::vector<GameSparks::Core::GSData> Members_list = wrappedData.GetGSDataObjectList("members");
+			Members.Reserve(Members_list.size());
+			for(std::size_t i=0; i < Members_list.size(); i++){
+				Members.Add(FGSPlayer(Members_list[i]));
             }
 		}
 		
@@ -4722,9 +4745,10 @@ struct FGSDismissMultipleMessagesResponse
 	
 	if(wrappedData.ContainsKey("failedDismissals")){
 		HasFailedDismissals = true;
-			for(std::size_t i=0; i < wrappedData.GetStringList("failedDismissals").size(); i++){
-				FString FailedDismissals_tmp = FString(UTF8_TO_TCHAR(wrappedData.GetStringList("failedDismissals")[i].c_str()));
-				FailedDismissals.Add(FailedDismissals_tmp);
+			const gsstl::vector<gsstl::string> FailedDismissals_list = wrappedData.GetStringList("failedDismissals");
+			FailedDismissals.Reserve(FailedDismissals_list.size());
+			for(std::size_t i=0; i < FailedDismissals_list.size(); i++){
+				FailedDismissals.Add(FString(UTF8_TO_TCHAR(FailedDismissals_list[i].c_str())));
             }
 		}
 		
@@ -4951,9 +4975,10 @@ struct FGSFindChallengeResponse
 	
 	if(wrappedData.ContainsKey("challengeInstances")){
 		HasChallengeInstances = true;
-			for(std::size_t i=0; i < wrappedData.GetGSDataObjectList("challengeInstances").size(); i++){
-				FGSChallenge ChallengeInstances_tmp = FGSChallenge(wrappedData.GetGSDataObjectList("challengeInstances")[i]);
-				ChallengeInstances.Add(ChallengeInstances_tmp);
+			const gsstl::vector<GameSparks::Core::GSData> ChallengeInstances_list = wrappedData.GetGSDataObjectList("challengeInstances");
+			ChallengeInstances.Reserve(ChallengeInstances_list.size());
+			for(std::size_t i=0; i < ChallengeInstances_list.size(); i++){
+				ChallengeInstances.Add(FGSChallenge(ChallengeInstances_list[i]));
             }
 		}
 		
@@ -5054,9 +5079,10 @@ struct FGSFindMatchResponse
 	
 	if(wrappedData.ContainsKey("opponents")){
 		HasOpponents = true;
-			for(std::size_t i=0; i < wrappedData.GetGSDataObjectList("opponents").size(); i++){
-				FGSPlayer Opponents_tmp = FGSPlayer(wrappedData.GetGSDataObjectList("opponents")[i]);
-				Opponents.Add(Opponents_tmp);
+			const gsstl::vector<GameSparks::Core::GSData> Opponents_list = wrappedData.GetGSDataObjectList("opponents");
+			Opponents.Reserve(Opponents_list.size());
+			for(std::size_t i=0; i < Opponents_list.size(); i++){
+				Opponents.Add(FGSPlayer(Opponents_list[i]));
             }
 		}
 		
@@ -5194,9 +5220,10 @@ struct FGSFindPendingMatchesResponse
 	
 	if(wrappedData.ContainsKey("pendingMatches")){
 		HasPendingMatches = true;
-			for(std::size_t i=0; i < wrappedData.GetGSDataObjectList("pendingMatches").size(); i++){
-				FGSPendingMatch PendingMatches_tmp = FGSPendingMatch(wrappedData.GetGSDataObjectList("pendingMatches")[i]);
-				PendingMatches.Add(PendingMatches_tmp);
+			const gsstl::vector<GameSparks::Core::GSData> PendingMatches_list = wrappedData.GetGSDataObjectList("pendingMatches");
+			PendingMatches.Reserve(PendingMatches_list.size());
+			for(std::size_t i=0; i < PendingMatches_list.size(); i++){
+				PendingMatches.Add(FGSPendingMatch(PendingMatches_list[i]));
             }
 		}
 		
@@ -5685,9 +5712,10 @@ struct FGSGetMyTeamsResponse
 	
 	if(wrappedData.ContainsKey("teams")){
 		HasTeams = true;
-			for(std::size_t i=0; i < wrappedData.GetGSDataObjectList("teams").size(); i++){
-				FGSTeam Teams_tmp = FGSTeam(wrappedData.GetGSDataObjectList("teams")[i]);
-				Teams.Add(Teams_tmp);
+			const gsstl::vector<GameSparks::Core::GSData> Teams_list = wrappedData.GetGSDataObjectList("teams");
+			Teams.Reserve(Teams_list.size());
+			for(std::size_t i=0; i < Teams_list.size(); i++){
+				Teams.Add(FGSTeam(Teams_list[i]));
             }
 		}
 		
@@ -5904,9 +5932,10 @@ struct FGSGetTeamResponse
 	
 	if(wrappedData.ContainsKey("members")){
 		HasMembers = true;
-			for(std::size_t i=0; i < wrappedData.GetGSDataObjectList("members").size(); i++){
-				FGSPlayer Members_tmp = FGSPlayer(wrappedData.GetGSDataObjectList("members")[i]);
-				Members.Add(Members_tmp);
+			const gsstl::vector<GameSparks::Core::GSData> Members_list = wrappedData.GetGSDataObjectList("members");
+			Members.Reserve(Members_list.size());
+			for(std::size_t i=0; i < Members_list.size(); i++){
+				Members.Add(FGSPlayer(Members_list[i]));
             }
 		}
 		
@@ -5949,9 +5978,10 @@ struct FGSGetTeamResponse
 	
 	if(wrappedData.ContainsKey("teams")){
 		HasTeams = true;
-			for(std::size_t i=0; i < wrappedData.GetGSDataObjectList("teams").size(); i++){
-				FGSTeam Teams_tmp = FGSTeam(wrappedData.GetGSDataObjectList("teams")[i]);
-				Teams.Add(Teams_tmp);
+			const gsstl::vector<GameSparks::Core::GSData> Teams_list = wrappedData.GetGSDataObjectList("teams");
+			Teams.Reserve(Teams_list.size());
+			for(std::size_t i=0; i < Teams_list.size(); i++){
+				Teams.Add(FGSTeam(Teams_list[i]));
             }
 		}
 		
@@ -6359,9 +6389,10 @@ struct FGSJoinTeamResponse
 	
 	if(wrappedData.ContainsKey("members")){
 		HasMembers = true;
-			for(std::size_t i=0; i < wrappedData.GetGSDataObjectList("members").size(); i++){
-				FGSPlayer Members_tmp = FGSPlayer(wrappedData.GetGSDataObjectList("members")[i]);
-				Members.Add(Members_tmp);
+			const gsstl::vector<GameSparks::Core::GSData> Members_list = wrappedData.GetGSDataObjectList("members");
+			Members.Reserve(Members_list.size());
+			for(std::size_t i=0; i < Members_list.size(); i++){
+				Members.Add(FGSPlayer(Members_list[i]));
             }
 		}
 		
@@ -6492,27 +6523,30 @@ struct FGSLeaderboardDataResponse
 	
 	if(wrappedData.ContainsKey("data")){
 		HasData = true;
-			for(std::size_t i=0; i < wrappedData.GetGSDataObjectList("data").size(); i++){
-				FGSLeaderboardData Data_tmp = FGSLeaderboardData(wrappedData.GetGSDataObjectList("data")[i]);
-				Data.Add(Data_tmp);
+			const gsstl::vector<GameSparks::Core::GSData> Data_list = wrappedData.GetGSDataObjectList("data");
+			Data.Reserve(Data_list.size());
+			for(std::size_t i=0; i < Data_list.size(); i++){
+				Data.Add(FGSLeaderboardData(Data_list[i]));
             }
 		}
 		
 	
 	if(wrappedData.ContainsKey("first")){
 		HasFirst = true;
-			for(std::size_t i=0; i < wrappedData.GetGSDataObjectList("first").size(); i++){
-				FGSLeaderboardData First_tmp = FGSLeaderboardData(wrappedData.GetGSDataObjectList("first")[i]);
-				First.Add(First_tmp);
+			const gsstl::vector<GameSparks::Core::GSData> First_list = wrappedData.GetGSDataObjectList("first");
+			First.Reserve(First_list.size());
+			for(std::size_t i=0; i < First_list.size(); i++){
+				First.Add(FGSLeaderboardData(First_list[i]));
             }
 		}
 		
 	
 	if(wrappedData.ContainsKey("last")){
 		HasLast = true;
-			for(std::size_t i=0; i < wrappedData.GetGSDataObjectList("last").size(); i++){
-				FGSLeaderboardData Last_tmp = FGSLeaderboardData(wrappedData.GetGSDataObjectList("last")[i]);
-				Last.Add(Last_tmp);
+			const gsstl::vector<GameSparks::Core::GSData> Last_list = wrappedData.GetGSDataObjectList("last");
+			Last.Reserve(Last_list.size());
+			for(std::size_t i=0; i < Last_list.size(); i++){
+				Last.Add(FGSLeaderboardData(Last_list[i]));
             }
 		}
 		
@@ -6684,9 +6718,10 @@ struct FGSLeaveTeamResponse
 	
 	if(wrappedData.ContainsKey("members")){
 		HasMembers = true;
-			for(std::size_t i=0; i < wrappedData.GetGSDataObjectList("members").size(); i++){
-				FGSPlayer Members_tmp = FGSPlayer(wrappedData.GetGSDataObjectList("members")[i]);
-				Members.Add(Members_tmp);
+			const gsstl::vector<GameSparks::Core::GSData> Members_list = wrappedData.GetGSDataObjectList("members");
+			Members.Reserve(Members_list.size());
+			for(std::size_t i=0; i < Members_list.size(); i++){
+				Members.Add(FGSPlayer(Members_list[i]));
             }
 		}
 		
@@ -6811,9 +6846,10 @@ struct FGSListAchievementsResponse
 	
 	if(wrappedData.ContainsKey("achievements")){
 		HasAchievements = true;
-			for(std::size_t i=0; i < wrappedData.GetGSDataObjectList("achievements").size(); i++){
-				FGSAchievement Achievements_tmp = FGSAchievement(wrappedData.GetGSDataObjectList("achievements")[i]);
-				Achievements.Add(Achievements_tmp);
+			const gsstl::vector<GameSparks::Core::GSData> Achievements_list = wrappedData.GetGSDataObjectList("achievements");
+			Achievements.Reserve(Achievements_list.size());
+			for(std::size_t i=0; i < Achievements_list.size(); i++){
+				Achievements.Add(FGSAchievement(Achievements_list[i]));
             }
 		}
 		
@@ -6890,9 +6926,10 @@ struct FGSListBulkJobsAdminResponse
 	
 	if(wrappedData.ContainsKey("bulkJobs")){
 		HasBulkJobs = true;
-			for(std::size_t i=0; i < wrappedData.GetGSDataObjectList("bulkJobs").size(); i++){
-				FGSBulkJob BulkJobs_tmp = FGSBulkJob(wrappedData.GetGSDataObjectList("bulkJobs")[i]);
-				BulkJobs.Add(BulkJobs_tmp);
+			const gsstl::vector<GameSparks::Core::GSData> BulkJobs_list = wrappedData.GetGSDataObjectList("bulkJobs");
+			BulkJobs.Reserve(BulkJobs_list.size());
+			for(std::size_t i=0; i < BulkJobs_list.size(); i++){
+				BulkJobs.Add(FGSBulkJob(BulkJobs_list[i]));
             }
 		}
 		
@@ -6969,9 +7006,10 @@ struct FGSListChallengeResponse
 	
 	if(wrappedData.ContainsKey("challengeInstances")){
 		HasChallengeInstances = true;
-			for(std::size_t i=0; i < wrappedData.GetGSDataObjectList("challengeInstances").size(); i++){
-				FGSChallenge ChallengeInstances_tmp = FGSChallenge(wrappedData.GetGSDataObjectList("challengeInstances")[i]);
-				ChallengeInstances.Add(ChallengeInstances_tmp);
+			const gsstl::vector<GameSparks::Core::GSData> ChallengeInstances_list = wrappedData.GetGSDataObjectList("challengeInstances");
+			ChallengeInstances.Reserve(ChallengeInstances_list.size());
+			for(std::size_t i=0; i < ChallengeInstances_list.size(); i++){
+				ChallengeInstances.Add(FGSChallenge(ChallengeInstances_list[i]));
             }
 		}
 		
@@ -7048,9 +7086,10 @@ struct FGSListChallengeTypeResponse
 	
 	if(wrappedData.ContainsKey("challengeTemplates")){
 		HasChallengeTemplates = true;
-			for(std::size_t i=0; i < wrappedData.GetGSDataObjectList("challengeTemplates").size(); i++){
-				FGSChallengeType ChallengeTemplates_tmp = FGSChallengeType(wrappedData.GetGSDataObjectList("challengeTemplates")[i]);
-				ChallengeTemplates.Add(ChallengeTemplates_tmp);
+			const gsstl::vector<GameSparks::Core::GSData> ChallengeTemplates_list = wrappedData.GetGSDataObjectList("challengeTemplates");
+			ChallengeTemplates.Reserve(ChallengeTemplates_list.size());
+			for(std::size_t i=0; i < ChallengeTemplates_list.size(); i++){
+				ChallengeTemplates.Add(FGSChallengeType(ChallengeTemplates_list[i]));
             }
 		}
 		
@@ -7127,9 +7166,10 @@ struct FGSListGameFriendsResponse
 	
 	if(wrappedData.ContainsKey("friends")){
 		HasFriends = true;
-			for(std::size_t i=0; i < wrappedData.GetGSDataObjectList("friends").size(); i++){
-				FGSPlayer Friends_tmp = FGSPlayer(wrappedData.GetGSDataObjectList("friends")[i]);
-				Friends.Add(Friends_tmp);
+			const gsstl::vector<GameSparks::Core::GSData> Friends_list = wrappedData.GetGSDataObjectList("friends");
+			Friends.Reserve(Friends_list.size());
+			for(std::size_t i=0; i < Friends_list.size(); i++){
+				Friends.Add(FGSPlayer(Friends_list[i]));
             }
 		}
 		
@@ -7206,9 +7246,10 @@ struct FGSListInviteFriendsResponse
 	
 	if(wrappedData.ContainsKey("friends")){
 		HasFriends = true;
-			for(std::size_t i=0; i < wrappedData.GetGSDataObjectList("friends").size(); i++){
-				FGSInvitableFriend Friends_tmp = FGSInvitableFriend(wrappedData.GetGSDataObjectList("friends")[i]);
-				Friends.Add(Friends_tmp);
+			const gsstl::vector<GameSparks::Core::GSData> Friends_list = wrappedData.GetGSDataObjectList("friends");
+			Friends.Reserve(Friends_list.size());
+			for(std::size_t i=0; i < Friends_list.size(); i++){
+				Friends.Add(FGSInvitableFriend(Friends_list[i]));
             }
 		}
 		
@@ -7285,9 +7326,10 @@ struct FGSListLeaderboardsResponse
 	
 	if(wrappedData.ContainsKey("leaderboards")){
 		HasLeaderboards = true;
-			for(std::size_t i=0; i < wrappedData.GetGSDataObjectList("leaderboards").size(); i++){
-				FGSLeaderboard Leaderboards_tmp = FGSLeaderboard(wrappedData.GetGSDataObjectList("leaderboards")[i]);
-				Leaderboards.Add(Leaderboards_tmp);
+			const gsstl::vector<GameSparks::Core::GSData> Leaderboards_list = wrappedData.GetGSDataObjectList("leaderboards");
+			Leaderboards.Reserve(Leaderboards_list.size());
+			for(std::size_t i=0; i < Leaderboards_list.size(); i++){
+				Leaderboards.Add(FGSLeaderboard(Leaderboards_list[i]));
             }
 		}
 		
@@ -7364,9 +7406,10 @@ struct FGSListMessageDetailResponse
 	
 	if(wrappedData.ContainsKey("messageList")){
 		HasMessageList = true;
-			for(std::size_t i=0; i < wrappedData.GetGSDataObjectList("messageList").size(); i++){
-				FGSPlayerMessage MessageList_tmp = FGSPlayerMessage(wrappedData.GetGSDataObjectList("messageList")[i]);
-				MessageList.Add(MessageList_tmp);
+			const gsstl::vector<GameSparks::Core::GSData> MessageList_list = wrappedData.GetGSDataObjectList("messageList");
+			MessageList.Reserve(MessageList_list.size());
+			for(std::size_t i=0; i < MessageList_list.size(); i++){
+				MessageList.Add(FGSPlayerMessage(MessageList_list[i]));
             }
 		}
 		
@@ -7443,8 +7486,10 @@ struct FGSListMessageResponse
 	
 	if(wrappedData.ContainsKey("messageList")){
 		HasMessageList = true;
-			for(std::size_t i=0; i < wrappedData.GetGSDataObjectList("messageList").size(); i++){
-				UGameSparksScriptData* MessageList_tmp = NewObject<UGameSparksScriptData>();MessageList_tmp->SetGSData(wrappedData.GetGSDataObjectList("messageList")[i]);
+			const gsstl::vector<GameSparks::Core::GSData> MessageList_list = wrappedData.GetGSDataObjectList("messageList");
+			MessageList.Reserve(MessageList_list.size());
+			for(std::size_t i=0; i < MessageList_list.size(); i++){
+				UGameSparksScriptData* MessageList_tmp = NewObject<UGameSparksScriptData>();MessageList_tmp->SetGSData(MessageList_list[i]);
 				MessageList.Add(MessageList_tmp);
             }
 		}
@@ -7522,8 +7567,10 @@ struct FGSListMessageSummaryResponse
 	
 	if(wrappedData.ContainsKey("messageList")){
 		HasMessageList = true;
-			for(std::size_t i=0; i < wrappedData.GetGSDataObjectList("messageList").size(); i++){
-				UGameSparksScriptData* MessageList_tmp = NewObject<UGameSparksScriptData>();MessageList_tmp->SetGSData(wrappedData.GetGSDataObjectList("messageList")[i]);
+			const gsstl::vector<GameSparks::Core::GSData> MessageList_list = wrappedData.GetGSDataObjectList("messageList");
+			MessageList.Reserve(MessageList_list.size());
+			for(std::size_t i=0; i < MessageList_list.size(); i++){
+				UGameSparksScriptData* MessageList_tmp = NewObject<UGameSparksScriptData>();MessageList_tmp->SetGSData(MessageList_list[i]);
 				MessageList.Add(MessageList_tmp);
             }
 		}
@@ -7601,9 +7648,10 @@ struct FGSListTeamChatResponse
 	
 	if(wrappedData.ContainsKey("messages")){
 		HasMessages = true;
-			for(std::size_t i=0; i < wrappedData.GetGSDataObjectList("messages").size(); i++){
-				FGSChatMessage Messages_tmp = FGSChatMessage(wrappedData.GetGSDataObjectList("messages")[i]);
-				Messages.Add(Messages_tmp);
+			const gsstl::vector<GameSparks::Core::GSData> Messages_list = wrappedData.GetGSDataObjectList("messages");
+			Messages.Reserve(Messages_list.size());
+			for(std::size_t i=0; i < Messages_list.size(); i++){
+				Messages.Add(FGSChatMessage(Messages_list[i]));
             }
 		}
 		
@@ -7692,9 +7740,10 @@ struct FGSListTeamsResponse
 	
 	if(wrappedData.ContainsKey("teams")){
 		HasTeams = true;
-			for(std::size_t i=0; i < wrappedData.GetGSDataObjectList("teams").size(); i++){
-				FGSTeam Teams_tmp = FGSTeam(wrappedData.GetGSDataObjectList("teams")[i]);
-				Teams.Add(Teams_tmp);
+			const gsstl::vector<GameSparks::Core::GSData> Teams_list = wrappedData.GetGSDataObjectList("teams");
+			Teams.Reserve(Teams_list.size());
+			for(std::size_t i=0; i < Teams_list.size(); i++){
+				Teams.Add(FGSTeam(Teams_list[i]));
             }
 		}
 		
@@ -7771,9 +7820,10 @@ struct FGSListTransactionsResponse
 	
 	if(wrappedData.ContainsKey("transactionList")){
 		HasTransactionList = true;
-			for(std::size_t i=0; i < wrappedData.GetGSDataObjectList("transactionList").size(); i++){
-				FGSPlayerTransaction TransactionList_tmp = FGSPlayerTransaction(wrappedData.GetGSDataObjectList("transactionList")[i]);
-				TransactionList.Add(TransactionList_tmp);
+			const gsstl::vector<GameSparks::Core::GSData> TransactionList_list = wrappedData.GetGSDataObjectList("transactionList");
+			TransactionList.Reserve(TransactionList_list.size());
+			for(std::size_t i=0; i < TransactionList_list.size(); i++){
+				TransactionList.Add(FGSPlayerTransaction(TransactionList_list[i]));
             }
 		}
 		
@@ -7850,9 +7900,10 @@ struct FGSListVirtualGoodsResponse
 	
 	if(wrappedData.ContainsKey("virtualGoods")){
 		HasVirtualGoods = true;
-			for(std::size_t i=0; i < wrappedData.GetGSDataObjectList("virtualGoods").size(); i++){
-				FGSVirtualGood VirtualGoods_tmp = FGSVirtualGood(wrappedData.GetGSDataObjectList("virtualGoods")[i]);
-				VirtualGoods.Add(VirtualGoods_tmp);
+			const gsstl::vector<GameSparks::Core::GSData> VirtualGoods_list = wrappedData.GetGSDataObjectList("virtualGoods");
+			VirtualGoods.Reserve(VirtualGoods_list.size());
+			for(std::size_t i=0; i < VirtualGoods_list.size(); i++){
+				VirtualGoods.Add(FGSVirtualGood(VirtualGoods_list[i]));
             }
 		}
 		
@@ -8067,9 +8118,10 @@ struct FGSMatchDetailsResponse
 	
 	if(wrappedData.ContainsKey("opponents")){
 		HasOpponents = true;
-			for(std::size_t i=0; i < wrappedData.GetGSDataObjectList("opponents").size(); i++){
-				FGSPlayer Opponents_tmp = FGSPlayer(wrappedData.GetGSDataObjectList("opponents")[i]);
-				Opponents.Add(Opponents_tmp);
+			const gsstl::vector<GameSparks::Core::GSData> Opponents_list = wrappedData.GetGSDataObjectList("opponents");
+			Opponents.Reserve(Opponents_list.size());
+			for(std::size_t i=0; i < Opponents_list.size(); i++){
+				Opponents.Add(FGSPlayer(Opponents_list[i]));
             }
 		}
 		
@@ -8832,9 +8884,10 @@ struct FGSSocialStatusResponse
 	
 	if(wrappedData.ContainsKey("statuses")){
 		HasStatuses = true;
-			for(std::size_t i=0; i < wrappedData.GetGSDataObjectList("statuses").size(); i++){
-				FGSSocialStatus Statuses_tmp = FGSSocialStatus(wrappedData.GetGSDataObjectList("statuses")[i]);
-				Statuses.Add(Statuses_tmp);
+			const gsstl::vector<GameSparks::Core::GSData> Statuses_list = wrappedData.GetGSDataObjectList("statuses");
+			Statuses.Reserve(Statuses_list.size());
+			for(std::size_t i=0; i < Statuses_list.size(); i++){
+				Statuses.Add(FGSSocialStatus(Statuses_list[i]));
             }
 		}
 		
@@ -11680,9 +11733,10 @@ struct FGSMatchFoundMessage
 	
 	if(wrappedData.ContainsKey("participants")){
 		HasParticipants = true;
-			for(std::size_t i=0; i < wrappedData.GetGSDataObjectList("participants").size(); i++){
-				FGSParticipant Participants_tmp = FGSParticipant(wrappedData.GetGSDataObjectList("participants")[i]);
-				Participants.Add(Participants_tmp);
+			const gsstl::vector<GameSparks::Core::GSData> Participants_list = wrappedData.GetGSDataObjectList("participants");
+			Participants.Reserve(Participants_list.size());
+			for(std::size_t i=0; i < Participants_list.size(); i++){
+				Participants.Add(FGSParticipant(Participants_list[i]));
             }
 		}
 		
@@ -11886,9 +11940,10 @@ struct FGSMatchNotFoundMessage
 	
 	if(wrappedData.ContainsKey("participants")){
 		HasParticipants = true;
-			for(std::size_t i=0; i < wrappedData.GetGSDataObjectList("participants").size(); i++){
-				FGSParticipant Participants_tmp = FGSParticipant(wrappedData.GetGSDataObjectList("participants")[i]);
-				Participants.Add(Participants_tmp);
+			const gsstl::vector<GameSparks::Core::GSData> Participants_list = wrappedData.GetGSDataObjectList("participants");
+			Participants.Reserve(Participants_list.size());
+			for(std::size_t i=0; i < Participants_list.size(); i++){
+				Participants.Add(FGSParticipant(Participants_list[i]));
             }
 		}
 		
@@ -12020,9 +12075,10 @@ struct FGSMatchUpdatedMessage
 	
 	if(wrappedData.ContainsKey("addedPlayers")){
 		HasAddedPlayers = true;
-			for(std::size_t i=0; i < wrappedData.GetStringList("addedPlayers").size(); i++){
-				FString AddedPlayers_tmp = FString(UTF8_TO_TCHAR(wrappedData.GetStringList("addedPlayers")[i].c_str()));
-				AddedPlayers.Add(AddedPlayers_tmp);
+			const gsstl::vector<gsstl::string> AddedPlayers_list = wrappedData.GetStringList("addedPlayers");
+			AddedPlayers.Reserve(AddedPlayers_list.size());
+			for(std::size_t i=0; i < AddedPlayers_list.size(); i++){
+				AddedPlayers.Add(FString(UTF8_TO_TCHAR(AddedPlayers_list[i].c_str())));
             }
 		}
 		
@@ -12065,18 +12121,20 @@ struct FGSMatchUpdatedMessage
 	
 	if(wrappedData.ContainsKey("participants")){
 		HasParticipants = true;
-			for(std::size_t i=0; i < wrappedData.GetGSDataObjectList("participants").size(); i++){
-				FGSParticipant Participants_tmp = FGSParticipant(wrappedData.GetGSDataObjectList("participants")[i]);
-				Participants.Add(Participants_tmp);
+			const gsstl::vector<GameSparks::Core::GSData> Participants_list = wrappedData.GetGSDataObjectList("participants");
+			Participants.Reserve(Participants_list.size());
+			for(std::size_t i=0; i < Participants_list.size(); i++){
+				Participants.Add(FGSParticipant(Participants_list[i]));
             }
 		}
 		
 	
 	if(wrappedData.ContainsKey("removedPlayers")){
 		HasRemovedPlayers = true;
-			for(std::size_t i=0; i < wrappedData.GetStringList("removedPlayers").size(); i++){
-				FString RemovedPlayers_tmp = FString(UTF8_TO_TCHAR(wrappedData.GetStringList("removedPlayers")[i].c_str()));
-				RemovedPlayers.Add(RemovedPlayers_tmp);
+			const gsstl::vector<gsstl::string> RemovedPlayers_list = wrappedData.GetStringList("removedPlayers");
+			RemovedPlayers.Reserve(RemovedPlayers_list.size());
+			for(std::size_t i=0; i < RemovedPlayers_list.size(); i++){
+				RemovedPlayers.Add(FString(UTF8_TO_TCHAR(RemovedPlayers_list[i].c_str())));
             }
 		}
 		
@@ -0,0 +1,69 @@
+#include "GameSparksFireAndForget.h"
+#include "GameSparksPrivatePCH.h"
+#include "GameSparksModule.h"
+
+namespace
+{
+	GameSparks::Core::GS* GetInitializedGSInstance()
+	{
+		UGameSparksModule* Module = UGameSparksModule::GetModulePtr();
+		if (Module == nullptr || !Module->IsInitialized())
+		{
+			UE_LOG(UGameSparksModuleLog, Warning, TEXT("%s"), TEXT("GameSparks is not initialized, request dropped"));
+			return nullptr;
+		}
+		return &Module->GetGSInstance();
+	}
+}
+
+void UGameSparksFireAndForget::SendLogEvent(const FString& EventKey, UGameSparksLogEventData* LogEventData, bool Durable)
+{
+	GameSparks::Core::GS* GSInstance = GetInitializedGSInstance();
+	if (GSInstance == nullptr)
+	{
+		return;
+	}
+
+	GameSparks::Api::Requests::LogEventRequest gsRequest(*GSInstance);
+	gsRequest.SetEventKey(TCHAR_TO_UTF8(*EventKey));
+	if (LogEventData != nullptr)
+	{
+		LogEventData->AddToLogEvent(&gsRequest);
+	}
+	if (Durable)
+	{
+		gsRequest.SetDurable(Durable);
+	}
+	gsRequest.SetPriority(GameSparks::Core::GSRequest::PRIORITY_BACKGROUND);
+	gsRequest.Send();
+}
+
+void UGameSparksFireAndForget::SendAnalytics(const FString& Key, UGameSparksScriptData* Data, bool Start, bool End, bool Durable)
+{
+	GameSparks::Core::GS* GSInstance = GetInitializedGSInstance();
+	if (GSInstance == nullptr)
+	{
+		return;
+	}
+
+	GameSparks::Api::Requests::AnalyticsRequest gsRequest(*GSInstance);
+	gsRequest.SetKey(TCHAR_TO_UTF8(*Key));
+	if (Data != nullptr)
+	{
+		gsRequest.SetData(Data->ToRequestData());
+	}
+	if (Start)
+	{
+		gsRequest.SetStart(Start);
+	}
+	if (End)
+	{
+		gsRequest.SetEnd(End);
+	}
+	if (Durable)
+	{
+		gsRequest.SetDurable(Durable);
+	}
+	gsRequest.SetPriority(GameSparks::Core::GSRequest::PRIORITY_BACKGROUND);
+	gsRequest.Send();
+}
@@ -0,0 +1,84 @@
+#include "GameSparksProfiler.h"
+#include "GameSparksPrivatePCH.h"
+#include "Engine.h"
+#include "GameSparksStats.h"
+
+using namespace GameSparks::Core;
+
+namespace GameSparks
+{
+	namespace UnrealEngineSDK
+	{
+		#if STATS
+		static TStatId GetStatId(IGSProfiler::Scope scope)
+		{
+			switch (scope)
+			{
+				case IGSProfiler::SCOPE_WEBSOCKET_POLL: return GET_STATID(STAT_GameSparksWebSocketPoll);
+				case IGSProfiler::SCOPE_WEBSOCKET_DISPATCH: return GET_STATID(STAT_GameSparksWebSocketDispatch);
+				case IGSProfiler::SCOPE_JSON_PARSE: return GET_STATID(STAT_GameSparksJSONParse);
+				case IGSProfiler::SCOPE_CALLBACK_DISPATCH: return GET_STATID(STAT_GameSparksCallbackDispatch);
+				case IGSProfiler::SCOPE_RT_ACTION_DRAIN: return GET_STATID(STAT_GameSparksRTActionDrain);
+				case IGSProfiler::SCOPE_RT_PACKET_DECODE: return GET_STATID(STAT_GameSparksRTPacketDecode);
+				default: return TStatId();
+			}
+		}
+
+		// scopes of the same kind never nest on one thread, so one counter per kind and thread is enough
+		static thread_local FCycleCounter ScopeCounters[IGSProfiler::SCOPE_COUNT];
+		#elif defined(ENABLE_NAMED_EVENTS) && ENABLE_NAMED_EVENTS
+		static const TCHAR* GetScopeName(IGSProfiler::Scope scope)
+		{
+			switch (scope)
+			{
+				case IGSProfiler::SCOPE_WEBSOCKET_POLL: return TEXT("GameSparks WebSocket poll");
+				case IGSProfiler::SCOPE_WEBSOCKET_DISPATCH: return TEXT("GameSparks WebSocket dispatch");
+				case IGSProfiler::SCOPE_JSON_PARSE: return TEXT("GameSparks JSON parse");
+				case IGSProfiler::SCOPE_CALLBACK_DISPATCH: return TEXT("GameSparks callback dispatch");
+				case IGSProfiler::SCOPE_RT_ACTION_DRAIN: return TEXT("GameSparks RT action drain");
+				case IGSProfiler::SCOPE_RT_PACKET_DECODE: return TEXT("GameSparks RT packet decode");
+				default: return TEXT("GameSparks");
+			}
+		}
+		#endif
+
+		FGameSparksProfiler* FGameSparksProfiler::Get()
+		{
+			static FGameSparksProfiler Instance;
+			return &Instance;
+		}
+
+		void FGameSparksProfiler::BeginScope(Scope scope)
+		{
+			#if STATS
+			ScopeCounters[scope].Start(GetStatId(scope));
+			#elif defined(ENABLE_NAMED_EVENTS) && ENABLE_NAMED_EVENTS
+			FPlatformMisc::BeginNamedEvent(FColor::Orange, GetScopeName(scope));
+			#endif
+		}
+
+		void FGameSparksProfiler::EndScope(Scope scope)
+		{
+			#if STATS
+			ScopeCounters[scope].Stop();
+			#elif defined(ENABLE_NAMED_EVENTS) && ENABLE_NAMED_EVENTS
+			FPlatformMisc::EndNamedEvent();
+			#endif
+		}
+
+		void FGameSparksProfiler::SetCounter(Counter counter, long long value)
+		{
+			switch (counter)
+			{
+				case COUNTER_SEND_QUEUE: SET_DWORD_STAT(STAT_GameSparksSendQueue, value); break;
+				case COUNTER_PENDING_REQUESTS: SET_DWORD_STAT(STAT_GameSparksPendingRequests, value); break;
+				case COUNTER_DURABLE_QUEUE: SET_DWORD_STAT(STAT_GameSparksDurableQueue, value); break;
+				case COUNTER_RECEIVED_QUEUE: SET_DWORD_STAT(STAT_GameSparksReceivedQueue, value); break;
+				case COUNTER_SEND_LANES: SET_DWORD_STAT(STAT_GameSparksSendLanes, value); break;
+				case COUNTER_WEBSOCKET_TX_BYTES: SET_MEMORY_STAT(STAT_GameSparksWebSocketTxBytes, value); break;
+				case COUNTER_WEBSOCKET_RX_BYTES: SET_MEMORY_STAT(STAT_GameSparksWebSocketRxBytes, value); break;
+				default: break;
+			}
+		}
+	}
+}
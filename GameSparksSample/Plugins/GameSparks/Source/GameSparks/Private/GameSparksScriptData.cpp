@@ -3,6 +3,34 @@
 #include "Engine.h"
 #include "GameSparksClasses.h"
 
+namespace
+{
+    // the Has* checks look the member up without extracting (and copying) its value
+    bool HasMember(const GameSparks::Core::GSData& data, const FString& name, int type)
+    {
+        const GameSparks::cJSON* item = GameSparks::cJSON_GetObjectItem(data.GetBaseData(), TCHAR_TO_UTF8(*name));
+        return item != nullptr && (item->type == type || (type == cJSON_True && item->type == cJSON_False));
+    }
+
+    bool HasArrayOf(const GameSparks::Core::GSData& data, const FString& name, int type)
+    {
+        const GameSparks::cJSON* array = GameSparks::cJSON_GetObjectItem(data.GetBaseData(), TCHAR_TO_UTF8(*name));
+        if (array == nullptr || array->type != cJSON_Array)
+        {
+            return false;
+        }
+
+        for (const GameSparks::cJSON* item = array->child; item != nullptr; item = item->next)
+        {
+            if (item->type == type)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+}
+
 void UGameSparksScriptData::SetGSData(const GameSparks::Core::GSData& data)
 {
     m_Data = data;
@@ -26,7 +54,7 @@ FString UGameSparksScriptData::ToString() const
 
 bool UGameSparksScriptData::HasString(const FString& name) const
 {
-    return m_Data.ContainsKey(TCHAR_TO_UTF8(*name)) && m_Data.GetString(TCHAR_TO_UTF8(*name)).HasValue();
+    return HasMember(m_Data, name, cJSON_String);
 };
 
 FString UGameSparksScriptData::GetString(const FString& name) const
@@ -48,13 +76,14 @@ UGameSparksScriptData* UGameSparksScriptData::SetString(const FString& name, con
 
 bool UGameSparksScriptData::HasStringArray(const FString& name) const
 {
-    return m_Data.ContainsKey(TCHAR_TO_UTF8(*name)) && m_Data.GetStringList(TCHAR_TO_UTF8(*name)).size() > 0;
+    return HasArrayOf(m_Data, name, cJSON_String);
 };
 
 TArray<FString> UGameSparksScriptData::GetStringArray(const FString& name) const
 {
     TArray<FString> newArray;
     gsstl::vector<gsstl::string> data = m_Data.GetStringList(TCHAR_TO_UTF8(*name));
+    newArray.Reserve(data.size());
     for(gsstl::vector<gsstl::string>::iterator it = data.begin(); it != data.end(); ++it) {
         newArray.Add(FString(UTF8_TO_TCHAR(it->c_str())));
     }
@@ -74,7 +103,7 @@ UGameSparksScriptData* UGameSparksScriptData::SetStringArray(const FString& name
 
 bool UGameSparksScriptData::HasNumber(const FString& name) const
 {
-    return m_Data.ContainsKey(TCHAR_TO_UTF8(*name)) && m_Data.GetLong(TCHAR_TO_UTF8(*name)).HasValue();
+    return HasMember(m_Data, name, cJSON_Number);
 };
 
 int32 UGameSparksScriptData::GetNumber(const FString& name) const
@@ -90,7 +119,7 @@ UGameSparksScriptData* UGameSparksScriptData::SetNumber(const FString& name, con
 
 bool UGameSparksScriptData::HasNumberArray(const FString& name) const
 {
-    return m_Data.ContainsKey(TCHAR_TO_UTF8(*name)) && m_Data.GetLongList(TCHAR_TO_UTF8(*name)).size() > 0;
+    return HasArrayOf(m_Data, name, cJSON_Number);
 };
 
 TArray<int32> UGameSparksScriptData::GetNumberArray(const FString& name) const
@@ -116,7 +145,7 @@ UGameSparksScriptData* UGameSparksScriptData::SetNumberArray(const FString& name
 
 bool UGameSparksScriptData::HasFloat(const FString& name) const
 {
-    return m_Data.ContainsKey(TCHAR_TO_UTF8(*name)) && m_Data.GetFloat(TCHAR_TO_UTF8(*name)).HasValue();
+    return HasMember(m_Data, name, cJSON_Number);
 }
 
 float UGameSparksScriptData::GetFloat(const FString& name) const
@@ -132,7 +161,7 @@ UGameSparksScriptData* UGameSparksScriptData::SetFloat(const FString& name, cons
 
 bool UGameSparksScriptData::HasFloatArray(const FString& name) const
 {
-    return m_Data.ContainsKey(TCHAR_TO_UTF8(*name)) && m_Data.GetFloatList(TCHAR_TO_UTF8(*name)).size() > 0;
+    return HasArrayOf(m_Data, name, cJSON_Number);
 };
 
 TArray<float> UGameSparksScriptData::GetFloatArray(const FString& name) const
@@ -158,7 +187,7 @@ UGameSparksScriptData* UGameSparksScriptData::SetFloatArray(const FString& name,
 
 bool UGameSparksScriptData::HasBoolean(const FString& name) const
 {
-    return m_Data.ContainsKey(TCHAR_TO_UTF8(*name)) && m_Data.GetBoolean(TCHAR_TO_UTF8(*name)).HasValue();
+    return HasMember(m_Data, name, cJSON_True);
 };
 
 bool UGameSparksScriptData::GetBoolean(const FString& name) const
@@ -174,14 +203,15 @@ UGameSparksScriptData* UGameSparksScriptData::SetBoolean(const FString& name, co
 
 bool UGameSparksScriptData::HasGSData(const FString& name) const
 {
-    return m_Data.ContainsKey(TCHAR_TO_UTF8(*name)) && m_Data.GetGSDataObject(TCHAR_TO_UTF8(*name)).HasValue();
+    return HasMember(m_Data, name, cJSON_Object);
 };
 
 UGameSparksScriptData* UGameSparksScriptData::GetGSData(const FString& name) const
 {
     UGameSparksScriptData* ret = NewObject<UGameSparksScriptData>();
-    if(m_Data.GetGSDataObject(TCHAR_TO_UTF8(*name)).HasValue()){
-        ret->SetGSData(m_Data.GetGSDataObject(TCHAR_TO_UTF8(*name)).GetValue());
+    GameSparks::Core::GSData::t_Optional object = m_Data.GetGSDataObject(TCHAR_TO_UTF8(*name));
+    if(object.HasValue()){
+        ret->SetGSData(object.GetValue());
     }
     return ret;
 };
@@ -194,13 +224,14 @@ UGameSparksScriptData* UGameSparksScriptData::SetGSData(const FString& name,  UG
 
 bool UGameSparksScriptData::HasGSDataArray(const FString& name) const
 {
-    return m_Data.ContainsKey(TCHAR_TO_UTF8(*name)) && m_Data.GetGSDataObjectList(TCHAR_TO_UTF8(*name)).size() > 0;
+    return HasArrayOf(m_Data, name, cJSON_Object);
 };
 
 TArray<UGameSparksScriptData*> UGameSparksScriptData::GetGSDataArray(const FString& name) const
 {
     TArray<UGameSparksScriptData*> newArray;
     gsstl::vector<GameSparks::Core::GSData> data = m_Data.GetGSDataObjectList(TCHAR_TO_UTF8(*name));
+    newArray.Reserve(data.size());
     for(gsstl::vector<GameSparks::Core::GSData>::iterator it = data.begin(); it != data.end(); ++it)
     {
         UGameSparksScriptData* ret = NewObject<UGameSparksScriptData>();
@@ -223,7 +254,7 @@ UGameSparksScriptData* UGameSparksScriptData::SetGSDataArray(const FString& name
 
 bool UGameSparksScriptData::HasDateTime( const FString& name ) const
 {
-    return m_Data.ContainsKey( TCHAR_TO_UTF8( *name ) ) && m_Data.GetDate( TCHAR_TO_UTF8( *name ) ).HasValue();
+    return HasMember(m_Data, name, cJSON_String);
 }
 
 FDateTime UGameSparksScriptData::GetDateTime( const FString& name ) const
@@ -247,7 +278,7 @@ UGameSparksScriptData* UGameSparksScriptData::SetDateTime( const FString& name,
 
 bool UGameSparksScriptData::HasIntArray( const FString& name ) const
 {
-    return m_Data.ContainsKey( TCHAR_TO_UTF8( *name ) ) && m_Data.GetIntList( TCHAR_TO_UTF8( *name ) ).size() > 0;
+    return HasArrayOf(m_Data, name, cJSON_Number);
 }
 
 TArray< int > UGameSparksScriptData::GetIntArray( const FString& name ) const
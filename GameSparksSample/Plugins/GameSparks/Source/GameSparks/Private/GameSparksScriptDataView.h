@@ -0,0 +1,142 @@
+#pragma once
+#include "GameSparksPrivatePCH.h"
+#include "Engine.h"
+#include "Kismet/BlueprintFunctionLibrary.h"
+
+#include "GameSparks/GSData.h"
+#include "GameSparksScriptData.h"
+#include "GameSparksScriptDataView.generated.h"
+
+/// immutable JSON tree shared by all FGSScriptDataView handles created from the same payload
+struct FGSScriptDataTree
+{
+	explicit FGSScriptDataTree(GameSparks::cJSON* InRoot) : Root(InRoot) {}
+	~FGSScriptDataTree() { GameSparks::cJSON_Delete(Root); }
+
+	GameSparks::cJSON* Root;
+
+private:
+	FGSScriptDataTree(const FGSScriptDataTree&);
+	FGSScriptDataTree& operator=(const FGSScriptDataTree&);
+};
+
+/**
+ Read-only handle to a node of a script data payload.
+
+ Unlike UGameSparksScriptData, a view is a value type: it references a node of a tree that is
+ shared by all views created from the same payload. Walking into nested objects or arrays
+ yields new views of the same tree, so reading a large payload from Blueprint does not create
+ a UObject or copy a subtree per node.
+*/
+USTRUCT(BlueprintType)
+struct GAMESPARKS_API FGSScriptDataView
+{
+	GENERATED_USTRUCT_BODY()
+
+	FGSScriptDataView() : Node(nullptr) {}
+
+	/// creates a view of a copy of data. this is the only place the payload is copied
+	static FGSScriptDataView FromGSData(const GameSparks::Core::GSData& Data);
+
+	bool IsValid() const { return Node != nullptr; }
+
+	/// returns the member called Name of this node, if it has the given cJSON type (cJSON_True matches both booleans),
+	/// nullptr otherwise. the member is a node of the same tree, ViewOf() makes a view of it
+	const GameSparks::cJSON* Find(const FString& Name, int Type) const;
+
+	/// returns a view of Child, which has to be a node of the same tree
+	FGSScriptDataView ViewOf(const GameSparks::cJSON* Child) const;
+
+	TSharedPtr<FGSScriptDataTree, ESPMode::ThreadSafe> Tree;
+
+	/// the node within Tree this view refers to. the tree is immutable, so this is the resolved path of the view
+	const GameSparks::cJSON* Node;
+};
+
+/**
+ Blueprint accessors for FGSScriptDataView. Has* and the scalar Get* functions do not allocate,
+ GetGSData returns a view into the same tree.
+*/
+UCLASS()
+class GAMESPARKS_API UGSScriptDataViewLibrary : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	/** Creates a read-only view of the script data. The data is copied once, views of nested objects share that copy. */
+	UFUNCTION(BlueprintPure, Category = "GameSparks|Data View")
+	static FGSScriptDataView MakeScriptDataView(UGameSparksScriptData* ScriptData);
+
+	/** Converts the view back into a (mutable) script data object. This copies the subtree. */
+	UFUNCTION(BlueprintPure, Category = "GameSparks|Data View")
+	static UGameSparksScriptData* ToScriptData(const FGSScriptDataView& View);
+
+	UFUNCTION(BlueprintPure, Category = "GameSparks|Data View")
+	static bool IsValid(const FGSScriptDataView& View);
+
+	UFUNCTION(BlueprintPure, Category = "GameSparks|Data View")
+	static FString ToJSONString(const FGSScriptDataView& View);
+
+	UFUNCTION(BlueprintPure, Category = "GameSparks|Data View")
+	static TArray<FString> GetKeys(const FGSScriptDataView& View);
+
+	UFUNCTION(BlueprintPure, Category = "GameSparks|Data View")
+	static bool HasString(const FGSScriptDataView& View, const FString& Name);
+
+	UFUNCTION(BlueprintPure, Category = "GameSparks|Data View")
+	static FString GetString(const FGSScriptDataView& View, const FString& Name);
+
+	UFUNCTION(BlueprintPure, Category = "GameSparks|Data View")
+	static bool HasNumber(const FGSScriptDataView& View, const FString& Name);
+
+	UFUNCTION(BlueprintPure, Category = "GameSparks|Data View")
+	static int32 GetNumber(const FGSScriptDataView& View, const FString& Name);
+
+	UFUNCTION(BlueprintPure, Category = "GameSparks|Data View")
+	static bool HasFloat(const FGSScriptDataView& View, const FString& Name);
+
+	UFUNCTION(BlueprintPure, Category = "GameSparks|Data View")
+	static float GetFloat(const FGSScriptDataView& View, const FString& Name);
+
+	UFUNCTION(BlueprintPure, Category = "GameSparks|Data View")
+	static bool HasBoolean(const FGSScriptDataView& View, const FString& Name);
+
+	UFUNCTION(BlueprintPure, Category = "GameSparks|Data View")
+	static bool GetBoolean(const FGSScriptDataView& View, const FString& Name);
+
+	UFUNCTION(BlueprintPure, Category = "GameSparks|Data View")
+	static bool HasDateTime(const FGSScriptDataView& View, const FString& Name);
+
+	UFUNCTION(BlueprintPure, Category = "GameSparks|Data View")
+	static FDateTime GetDateTime(const FGSScriptDataView& View, const FString& Name);
+
+	UFUNCTION(BlueprintPure, Category = "GameSparks|Data View")
+	static bool HasGSData(const FGSScriptDataView& View, const FString& Name);
+
+	UFUNCTION(BlueprintPure, Category = "GameSparks|Data View")
+	static FGSScriptDataView GetGSData(const FGSScriptDataView& View, const FString& Name);
+
+	/** returns true if Name is a non-empty array */
+	UFUNCTION(BlueprintPure, Category = "GameSparks|Data View")
+	static bool HasArray(const FGSScriptDataView& View, const FString& Name);
+
+	/** number of elements of the array Name, 0 if there is no such array */
+	UFUNCTION(BlueprintPure, Category = "GameSparks|Data View")
+	static int32 GetArrayNum(const FGSScriptDataView& View, const FString& Name);
+
+	/** a view of the object at Index of the array Name. The view is invalid if there is no such element */
+	UFUNCTION(BlueprintPure, Category = "GameSparks|Data View")
+	static FGSScriptDataView GetGSDataArrayItem(const FGSScriptDataView& View, const FString& Name, int32 Index);
+
+	UFUNCTION(BlueprintPure, Category = "GameSparks|Data View")
+	static TArray<FGSScriptDataView> GetGSDataArray(const FGSScriptDataView& View, const FString& Name);
+
+	UFUNCTION(BlueprintPure, Category = "GameSparks|Data View")
+	static TArray<FString> GetStringArray(const FGSScriptDataView& View, const FString& Name);
+
+	UFUNCTION(BlueprintPure, Category = "GameSparks|Data View")
+	static TArray<int32> GetNumberArray(const FGSScriptDataView& View, const FString& Name);
+
+	UFUNCTION(BlueprintPure, Category = "GameSparks|Data View")
+	static TArray<float> GetFloatArray(const FGSScriptDataView& View, const FString& Name);
+};
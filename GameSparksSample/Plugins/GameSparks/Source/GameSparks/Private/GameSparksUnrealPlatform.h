@@ -3,6 +3,7 @@
 #include <GameSparks/IGSPlatform.h>
 #include <GameSparks/GSPlatformDeduction.h>
 #include "GameSparksModule.h"
+#include "GameSparksProfiler.h"
 
 #include "Runtime/Launch/Resources/Version.h"
 //#include <sstream>
@@ -97,6 +98,11 @@ namespace GameSparks
                     return TCHAR_TO_UTF8(*writeableLocation);
 				#endif
             }
+
+			GameSparks::Core::IGSProfiler* GetProfiler() const override
+			{
+				return FGameSparksProfiler::Get();
+			}
 		};
 	}
 }
@@ -19,6 +19,9 @@ class UGSRTData : public UObject
                 void SetRTData(const GameSparks::RT::RTData& data);
                 const GameSparks::RT::RTData& GetRTData() const;
 
+                /// returns true if index is a valid RTData slot, logs an error otherwise
+                static bool IsValidIndex(int32 index);
+
                 /* Create a new GS Data object. */
                 UFUNCTION(BlueprintPure, meta = (DisplayName = "Create GS RT Data", HidePin = "WorldContextObject", DefaultToSelf = "WorldContextObject"), Category = "GameSparksRT|Data")
                 static UGSRTData* CreateRTData(UObject* WorldContextObject);
@@ -0,0 +1,20 @@
+#pragma once
+#include "../GameSparksPrivatePCH.h"
+#include "Engine.h"
+#include "GSRTSessionTestListener.generated.h"
+
+class UGSRTSession;
+class UGSRTData;
+
+/// counts the packets broadcast by UGSRTSession::OnDataDelegate, for the automation tests
+UCLASS()
+class UGSRTSessionTestListener : public UObject
+{
+	GENERATED_UCLASS_BODY()
+
+	public:
+		UFUNCTION()
+		void OnData(UGSRTSession* session, int32 sender, int32 opCode, UGSRTData* data);
+
+		int32 Received;
+};
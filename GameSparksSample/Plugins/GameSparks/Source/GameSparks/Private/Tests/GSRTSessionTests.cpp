@@ -0,0 +1,139 @@
+#include "../GameSparksPrivatePCH.h"
+#include "GSRTSessionTestListener.h"
+#include "../RT/UGSRTSession.h"
+#include "../RT/UGSRTData.h"
+
+UGSRTSessionTestListener::UGSRTSessionTestListener(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+	, Received(0)
+{
+}
+
+void UGSRTSessionTestListener::OnData(UGSRTSession* session, int32 sender, int32 opCode, UGSRTData* data)
+{
+	++Received;
+}
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+	int32 CountRTData()
+	{
+		int32 count = 0;
+		for (TObjectIterator<UGSRTData> it; it; ++it)
+		{
+			++count;
+		}
+		return count;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGSRTSessionRecycleReceivedDataTest, "GameSparks.RT.RecycleReceivedData", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FGSRTSessionRecycleReceivedDataTest::RunTest(const FString& Parameters)
+{
+	static const int32 Packets = 100;
+
+	UGSRTSession* session = NewObject<UGSRTSession>();
+	UGSRTSessionTestListener* listener = NewObject<UGSRTSessionTestListener>();
+	session->OnDataDelegate.AddDynamic(listener, &UGSRTSessionTestListener::OnData);
+
+	GameSparks::RT::RTData data;
+	data.SetInt(1, 42);
+	const System::Bytes payload;
+	const GameSparks::RT::RTPacket packet(1, 2, payload, data);
+
+	// the default: a data object per packet, which listeners may keep
+	TestFalse(TEXT("RecycleReceivedData is opt-in"), session->RecycleReceivedData);
+	int32 before = CountRTData();
+	for (int32 i = 0; i != Packets; ++i)
+	{
+		session->OnPacket(packet);
+	}
+	TestEqual(TEXT("UGSRTData created without recycling"), CountRTData() - before, Packets);
+
+	// recycled: the first packet creates the pooled object, the others reuse it
+	session->RecycleReceivedData = true;
+	before = CountRTData();
+	for (int32 i = 0; i != Packets; ++i)
+	{
+		session->OnPacket(packet);
+	}
+	TestEqual(TEXT("UGSRTData created with recycling"), CountRTData() - before, 1);
+	TestEqual(TEXT("packets broadcast"), listener->Received, 2 * Packets);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGSRTSessionTransformsRoundTripTest, "GameSparks.RT.TransformsRoundTrip", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FGSRTSessionTransformsRoundTripTest::RunTest(const FString& Parameters)
+{
+	static const int32 Count = 100;
+
+	TArray<int32> ids;
+	TArray<FVector> locations;
+	TArray<FQuat> rotations;
+	FRandomStream random(42);
+	for (int32 i = 0; i != Count; ++i)
+	{
+		ids.Add(i * 7 - 50);
+		locations.Add(random.GetUnitVector() * random.FRandRange(0.0f, 100000.0f));
+		rotations.Add(FQuat(random.GetUnitVector(), random.FRandRange(-PI, PI)));
+	}
+
+	// each component once the largest one, and negative largest components
+	rotations[0] = FQuat::Identity;
+	rotations[1] = FQuat(1.0f, 0.0f, 0.0f, 0.0f);
+	rotations[2] = FQuat(0.0f, -1.0f, 0.0f, 0.0f);
+	rotations[3] = FQuat(0.1f, 0.2f, -0.9f, 0.3f);
+	rotations[4] = FQuat(0.5f, -0.5f, 0.5f, -0.5f);
+
+	const int32 perPacket = UGSRTSession::GetTransformsPerPacket(DeliveryIntent::UNRELIABLE, Count, 0);
+	TestEqual(TEXT("transforms per datagram to all peers"), perPacket, 43);
+	TestTrue(TEXT("fewer transforms per datagram to target players"), UGSRTSession::GetTransformsPerPacket(DeliveryIntent::UNRELIABLE, Count, 8) < perPacket);
+	TestEqual(TEXT("reliable batches are not split"), UGSRTSession::GetTransformsPerPacket(DeliveryIntent::RELIABLE, Count, 0), Count);
+
+	const GameSparks::RT::RTData noData;
+	System::Bytes payload;
+	TArray<int32> readIds;
+	TArray<FVector> readLocations;
+	TArray<FQuat> readRotations;
+	float maxError = 0.0f;
+	int32 packets = 0;
+
+	for (int32 first = 0; first < Count; first += perPacket, ++packets)
+	{
+		const int32 packetCount = FMath::Min(perPacket, Count - first);
+		UGSRTSession::WriteTransforms(payload, ids, locations, rotations, first, packetCount);
+		TestTrue(TEXT("packet fits into a datagram"), int32(payload.size()) <= GameSparks::RT::GameSparksRT::MaxDatagramPayloadSize(0));
+
+		const GameSparks::RT::RTPacket packet(1, 2, payload, noData);
+		TestTrue(TEXT("ReadTransforms() decodes each packet"), UGSRTSession::ReadTransforms(packet, readIds, readLocations, readRotations));
+		TestEqual(TEXT("transforms in packet"), readIds.Num(), packetCount);
+
+		for (int32 i = 0; i != FMath::Min(packetCount, readIds.Num()); ++i)
+		{
+			TestEqual(TEXT("id"), readIds[i], ids[first + i]);
+			TestTrue(TEXT("location at full precision"), readLocations[i] == locations[first + i]);
+			TestTrue(TEXT("rotation of unit length"), readRotations[i].IsNormalized());
+			// AngularDistance() does not distinguish q and -q, which WriteQuat() may flip
+			maxError = FMath::Max(maxError, readRotations[i].AngularDistance(rotations[first + i].GetNormalized()));
+		}
+	}
+
+	TestEqual(TEXT("packets of the batch"), packets, 3);
+
+	// 16 bits per component over +-1/sqrt(2), the rest is the precision of float
+	TestTrue(FString::Printf(TEXT("largest rotation error %f rad below 0.001 rad"), maxError), maxError < 0.001f);
+
+	payload.pop_back();
+	const GameSparks::RT::RTPacket truncated(1, 2, payload, noData);
+	TestFalse(TEXT("truncated payload is rejected"), UGSRTSession::ReadTransforms(truncated, readIds, readLocations, readRotations));
+	TestEqual(TEXT("nothing decoded from a truncated payload"), readIds.Num(), 0);
+
+	return true;
+}
+
+#endif /* WITH_DEV_AUTOMATION_TESTS */
@@ -43,10 +43,34 @@ namespace GameSparks
 			bool Update(float deltaTime);
 			 GS* GetGSInstance() const { return m_GS; }
 			 bool IsWebSocketConnectionAlive() const;
+
+			 /// true if Update() has to be called right away: the websocket has to be polled or received frames wait to be delivered.
+			 /// in network thread mode the websocket is polled by the network thread, so only the latter counts.
+			 bool HasWork() const;
+
+			 /// adds the sizes of the queues and buffers of this connection to counters, which is indexed by IGSProfiler::Counter
+			 void AddProfilerCounters(long long* counters);
 		protected:
 			static void OnWebSocketCallback(const gsstl::string& message, void* userData);
 			static void OnWebSocketError(const easywsclient::WSError& error, void* userData);
+
+			static void NetworkThreadMain(GSConnection* self);
 		private:
+			void StartNetworkThread();
+			void StopNetworkThread();
+			bool UpdateFromNetworkThread();
+
+			/// sends the handshake right away and appends everything else to the lane of its priority.
+			/// in network thread mode the caller has to hold m_WebSocketMutex.
+			void QueueFrame(const GSRequest& request);
+
+			/// moves frames from the send lanes to the websocket, as long as its send buffer has room.
+			/// in network thread mode the caller has to hold m_WebSocketMutex.
+			void FlushSendLanes();
+
+			/// in network thread mode the caller has to hold m_WebSocketMutex.
+			void AddWebSocketProfilerCounters(long long* counters) const;
+
 			GS* m_GS;
 			IGSPlatform* m_GSPlatform;
 
@@ -56,6 +80,32 @@ namespace GameSparks
 			bool m_Stopped;
             float m_lastActivity;
 
+			/// a frame received and parsed by the network thread, waiting to be delivered by Update()
+			struct ReceivedItem
+			{
+				ReceivedItem(const gsstl::string& message_, const GSObject& response_, int errorCode_, const gsstl::string& errorMessage_)
+				:message(message_), response(response_), errorCode(errorCode_), errorMessage(errorMessage_) {}
+
+				gsstl::string message;
+				GSObject response;
+				int errorCode; ///< an easywsclient::WSError::Code, ALL_OK for messages
+				gsstl::string errorMessage;
+			};
+			typedef gsstl::list<ReceivedItem> t_ReceivedItems;
+
+			bool m_UseNetworkThread;
+			bool m_NetworkThreadRunning; // guarded by m_WebSocketMutex
+			gsstl::thread m_NetworkThread;
+			gsstl::mutex m_WebSocketMutex; // serializes access to m_WebSocket between the game thread and the network thread
+			mutable gsstl::mutex m_ReceivedMutex;
+			t_ReceivedItems m_Received; // guarded by m_ReceivedMutex
+
+			/// serialized requests waiting for the websocket, one lane per GSRequest::Priority.
+			/// guarded by m_WebSocketMutex in network thread mode.
+			typedef gsstl::list<gsstl::string> t_SendLane;
+			t_SendLane m_SendLanes[GSRequest::PRIORITY_COUNT];
+			int m_SendLaneSkips[GSRequest::PRIORITY_COUNT]; ///< frames sent from higher priority lanes while this lane was waiting
+
 			typedef gsstl::map<gsstl::string, GSRequest> t_RequestMap;
 			typedef gsstl::pair<gsstl::string, GSRequest> t_RequestMapPair;
 			t_RequestMap m_PendingRequests;
@@ -0,0 +1,137 @@
+// Copyright 2015 GameSparks Ltd 2015, Inc. All Rights Reserved.
+#ifndef GSHistogram_h__
+#define GSHistogram_h__
+
+#pragma once
+
+#include "GSTime.h"
+#include <cassert>
+
+namespace GameSparks
+{
+	namespace Core
+	{
+		/*!
+			A fixed size histogram of durations used for the profiling counters of the SDK.
+
+			The upper bounds of the buckets are powers of two multiples of the bound of the first bucket,
+			i.e. with the default of 0.1 ms the buckets are <0.1ms, <0.2ms, <0.4ms ... <1.6s and a last,
+			open ended bucket for everything above. Adding a sample does not allocate.
+		 */
+		class GSHistogram
+		{
+			public:
+				enum { NumBuckets = 16 };
+
+				explicit GSHistogram(Seconds firstBucketUpperBound = 0.0001f)
+				: m_FirstBucketUpperBound(firstBucketUpperBound)
+				{
+					assert(firstBucketUpperBound > 0);
+					Reset();
+				}
+
+				/// adds a sample to the histogram
+				void Add(Seconds duration)
+				{
+					int bucket = 0;
+					Seconds bound = m_FirstBucketUpperBound;
+					while (bucket < NumBuckets - 1 && duration >= bound)
+					{
+						++bucket;
+						bound *= 2;
+					}
+
+					++m_Buckets[bucket];
+
+					if (m_Count == 0 || duration < m_Min) m_Min = duration;
+					if (m_Count == 0 || duration > m_Max) m_Max = duration;
+					++m_Count;
+					m_Sum += duration;
+				}
+
+				/// removes all samples
+				void Reset()
+				{
+					for (int i = 0; i != NumBuckets; ++i)
+					{
+						m_Buckets[i] = 0;
+					}
+					m_Count = 0;
+					m_Sum = 0;
+					m_Min = 0;
+					m_Max = 0;
+				}
+
+				/// number of samples added since the last Reset()
+				unsigned long GetCount() const { return m_Count; }
+
+				/// sum of all samples
+				double GetSum() const { return m_Sum; }
+
+				/// smallest sample, 0 if the histogram is empty
+				Seconds GetMin() const { return m_Min; }
+
+				/// largest sample, 0 if the histogram is empty
+				Seconds GetMax() const { return m_Max; }
+
+				/// average of all samples, 0 if the histogram is empty
+				Seconds GetMean() const { return m_Count ? Seconds(m_Sum / m_Count) : 0; }
+
+				/// number of samples in bucket
+				unsigned long GetBucketCount(int bucket) const
+				{
+					assert(bucket >= 0 && bucket < NumBuckets);
+					return m_Buckets[bucket];
+				}
+
+				/// exclusive upper bound of bucket. The last bucket has no upper bound, for it GetMax() is returned.
+				Seconds GetBucketUpperBound(int bucket) const
+				{
+					assert(bucket >= 0 && bucket < NumBuckets);
+					if (bucket == NumBuckets - 1)
+					{
+						return m_Max;
+					}
+
+					Seconds bound = m_FirstBucketUpperBound;
+					for (int i = 0; i != bucket; ++i)
+					{
+						bound *= 2;
+					}
+					return bound;
+				}
+
+				/// approximates the given percentile (0..100) by the upper bound of the bucket it falls into
+				Seconds GetPercentile(float percentile) const
+				{
+					if (m_Count == 0)
+					{
+						return 0;
+					}
+
+					double rank = m_Count * (percentile / 100.0);
+					unsigned long seen = 0;
+					for (int i = 0; i != NumBuckets; ++i)
+					{
+						seen += m_Buckets[i];
+						if (seen > 0 && seen >= rank)
+						{
+							Seconds bound = GetBucketUpperBound(i);
+							return bound < m_Max ? bound : m_Max;
+						}
+					}
+					return m_Max;
+				}
+
+			private:
+				Seconds m_FirstBucketUpperBound;
+				unsigned long m_Buckets[NumBuckets];
+				unsigned long m_Count;
+				double m_Sum;
+				Seconds m_Min;
+				Seconds m_Max;
+		};
+	}
+}
+
+#endif // GSHistogram_h__
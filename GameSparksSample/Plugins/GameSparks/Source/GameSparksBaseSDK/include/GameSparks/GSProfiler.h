@@ -0,0 +1,89 @@
+// Copyright 2015 GameSparks Ltd 2015, Inc. All Rights Reserved.
+#ifndef GSProfiler_h__
+#define GSProfiler_h__
+
+#pragma once
+
+namespace GameSparks
+{
+	namespace Core
+	{
+		/*!
+			Receives timing scopes and counters from the hot paths of the SDK, so that they can be forwarded
+			to the profiler of the engine.
+
+			Attach an implementation by returning it from IGSPlatform::GetProfiler(), and for realtime sessions
+			by passing it to GameSparksRT::GameSparksRTSessionBuilder::SetProfiler().
+
+			Scopes are reported by the thread doing the work. With the network thread enabled (see GS::SetNetworkThreadEnabled())
+			and for the fast connection of a realtime session this is not the thread calling Update(), so implementations have
+			to be thread safe. Scopes of different kinds nest, a scope never nests in a scope of the same kind on the same thread.
+		 */
+		class IGSProfiler
+		{
+			public:
+				enum Scope
+				{
+					SCOPE_WEBSOCKET_POLL,       ///< socket I/O of the websocket, including TLS
+					SCOPE_WEBSOCKET_DISPATCH,   ///< extracting and delivering the frames received by the websocket
+					SCOPE_JSON_PARSE,           ///< parsing a received response or message
+					SCOPE_CALLBACK_DISPATCH,    ///< invoking the callbacks and message listeners for a received response or message
+					SCOPE_RT_ACTION_DRAIN,      ///< executing the queued realtime callbacks in IRTSession::Update()
+					SCOPE_RT_PACKET_DECODE,     ///< decoding a received realtime packet
+					SCOPE_COUNT
+				};
+
+				enum Counter
+				{
+					COUNTER_SEND_QUEUE,         ///< requests waiting for a connection
+					COUNTER_PENDING_REQUESTS,   ///< requests waiting for their response
+					COUNTER_DURABLE_QUEUE,      ///< entries of the durable queue
+					COUNTER_RECEIVED_QUEUE,     ///< frames received by the network thread, waiting to be delivered by Update()
+					COUNTER_SEND_LANES,         ///< serialized requests waiting in the send lanes for room in the websocket send buffer
+					COUNTER_WEBSOCKET_TX_BYTES, ///< bytes buffered for sending by the websocket
+					COUNTER_WEBSOCKET_RX_BYTES, ///< bytes received by the websocket, not yet dispatched
+					COUNTER_COUNT
+				};
+
+				virtual ~IGSProfiler() {}
+
+				virtual void BeginScope(Scope scope) = 0;
+				virtual void EndScope(Scope scope) = 0;
+
+				/// counters are sampled once per GS::Update()
+				virtual void SetCounter(Counter counter, long long value) = 0;
+		};
+
+		/// reports the lifetime of this object as scope to profiler. does nothing if profiler is null.
+		class GSProfilerScope
+		{
+			public:
+				GSProfilerScope(IGSProfiler* profiler, IGSProfiler::Scope scope)
+				: m_Profiler(profiler)
+				, m_Scope(scope)
+				{
+					if (m_Profiler)
+					{
+						m_Profiler->BeginScope(m_Scope);
+					}
+				}
+
+				~GSProfilerScope()
+				{
+					if (m_Profiler)
+					{
+						m_Profiler->EndScope(m_Scope);
+					}
+				}
+
+			private:
+				GSProfilerScope(const GSProfilerScope&);
+				GSProfilerScope& operator=(const GSProfilerScope&);
+
+				IGSProfiler* m_Profiler;
+				IGSProfiler::Scope m_Scope;
+		};
+	}
+}
+
+#endif // GSProfiler_h__
@@ -0,0 +1,136 @@
+// Copyright 2015 GameSparks Ltd 2015, Inc. All Rights Reserved.
+#ifndef GSRequestMetrics_h__
+#define GSRequestMetrics_h__
+
+#pragma once
+
+#include "GSHistogram.h"
+#include "./gsstl.h"
+
+namespace GameSparks
+{
+	namespace Core
+	{
+		/*!
+			Client side latency and outcome metrics of the requests sent by a GS instance, grouped by the
+			@class of the request (e.g. ".AuthenticationRequest").
+
+			Retrieve them via GS::GetRequestMetrics() or periodically via GS::OnRequestMetrics.
+			Recording a sample does not allocate, except for the first request of a class.
+		 */
+		class GSRequestMetrics
+		{
+			public:
+				/// metrics of one request class
+				struct Entry
+				{
+					Entry()
+					: latency(0.001f)
+					, queueWait(0.001f)
+					, sent(0)
+					, succeeded(0)
+					, errors(0)
+					, timeouts(0)
+					, durableRetries(0)
+					{}
+
+					/// time from handing the request to the connection until its response arrived. Timeouts are not included.
+					GSHistogram latency;
+
+					/// time from GS::Send() until the request was handed to a connection. Durable requests restored
+					/// from disk are not included.
+					GSHistogram queueWait;
+
+					unsigned long sent;           ///< requests handed to a connection, including durable retries
+					unsigned long succeeded;      ///< responses without an error
+					unsigned long errors;         ///< responses with an error
+					unsigned long timeouts;       ///< requests that did not receive a response in time, including those that were never sent
+					unsigned long durableRetries; ///< durable requests sent again after a timeout
+
+					/// number of requests that received a response or timed out
+					unsigned long GetCompleted() const { return succeeded + errors + timeouts; }
+
+					/// fraction (0..1) of the completed requests that received an error response
+					float GetErrorRate() const { return GetCompleted() ? float(errors) / GetCompleted() : 0; }
+
+					/// fraction (0..1) of the completed requests that timed out
+					float GetTimeoutRate() const { return GetCompleted() ? float(timeouts) / GetCompleted() : 0; }
+				};
+
+				enum Outcome
+				{
+					OUTCOME_SUCCESS,
+					OUTCOME_ERROR,
+					OUTCOME_TIMEOUT
+				};
+
+				typedef gsstl::map<gsstl::string, Entry> t_EntryMap;
+
+				/// metrics of all request classes seen since the last Reset(), indexed by @class
+				const t_EntryMap& GetEntries() const { return m_Entries; }
+
+				/// metrics of the given request class, null if no such request was sent since the last Reset()
+				const Entry* Find(const gsstl::string& requestClass) const
+				{
+					t_EntryMap::const_iterator pos = m_Entries.find(requestClass);
+					return pos != m_Entries.end() ? &pos->second : 0;
+				}
+
+				/// metrics of all requests, regardless of their class
+				const Entry& GetTotal() const { return m_Total; }
+
+				/// removes all samples
+				void Reset()
+				{
+					m_Entries.clear();
+					m_Total = Entry();
+				}
+
+				/// records that a request was handed to a connection after waiting queueWait seconds. Pass a negative queueWait, if it is unknown.
+				void AddSent(const gsstl::string& requestClass, Seconds queueWait)
+				{
+					Entry& entry = m_Entries[requestClass];
+					++entry.sent;
+					++m_Total.sent;
+
+					if (queueWait >= 0)
+					{
+						entry.queueWait.Add(queueWait);
+						m_Total.queueWait.Add(queueWait);
+					}
+				}
+
+				/// records the outcome of a request. latency is ignored for timeouts.
+				void AddCompleted(const gsstl::string& requestClass, Outcome outcome, Seconds latency)
+				{
+					Entry& entry = m_Entries[requestClass];
+					Add(entry, outcome, latency);
+					Add(m_Total, outcome, latency);
+				}
+
+				/// records that a durable request is sent again
+				void AddDurableRetry(const gsstl::string& requestClass)
+				{
+					++m_Entries[requestClass].durableRetries;
+					++m_Total.durableRetries;
+				}
+
+			private:
+				static void Add(Entry& entry, Outcome outcome, Seconds latency)
+				{
+					switch (outcome)
+					{
+						case OUTCOME_SUCCESS: ++entry.succeeded; break;
+						case OUTCOME_ERROR: ++entry.errors; break;
+						case OUTCOME_TIMEOUT: ++entry.timeouts; return;
+					}
+					entry.latency.Add(latency);
+				}
+
+				t_EntryMap m_Entries;
+				Entry m_Total;
+		};
+	}
+}
+
+#endif // GSRequestMetrics_h__
@@ -20,11 +20,12 @@ namespace GameSparks { namespace RT { namespace Proto {
 	class ProtocolParser;
 	class RTValSerializer;
 	class RTDataSerializer;
+	class RTDataDelta;
 }}} /* namespace GameSparks.RT.Proto */
 
 namespace GameSparks { namespace RT { namespace Pools {
-	class ObjectPool;
-	class PooledObjects;
+	template <typename T> class ObjectPool;
+	template <typename T> class Pooled;
 }}} /* namespace GameSparks.RT.Pools */
 
 namespace Com { namespace Gamesparks { namespace Realtime { namespace Proto {
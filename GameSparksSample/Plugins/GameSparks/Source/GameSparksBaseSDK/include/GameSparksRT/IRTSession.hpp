@@ -11,6 +11,17 @@
 
 namespace GameSparks { namespace RT {
 
+	/*!
+	 * Receive statistics of the messages of one peer, see IRTSession::GetPeerStats().
+	 */
+	struct RTPeerStats
+	{
+		long long packetsReceived = 0;     ///< messages received from the peer
+		long long sequencedReceived = 0;   ///< sequenced (unreliable) messages that were executed
+		long long sequencedDiscarded = 0;  ///< sequenced messages dropped because they arrived out of order or twice
+		long long sequenceGaps = 0;        ///< sequence numbers skipped, i.e. sequenced messages lost or still in flight
+	};
+
 	/*!
 	 * Sessions are created via a GameSparksRTSessionBuilder. IRTSession objects are used to send data
 	 * to the peers. Make sure to call Update() every frame. To listen for session related
@@ -91,6 +102,30 @@ namespace GameSparks { namespace RT {
 										   const System::ArraySegment<System::Byte> &payload, const RTData &data,
 										   const gsstl::vector<int> &targetPlayer) =0;
 
+			/// <summary>
+			/// Like SendRTDataAndBytes(), but compresses data and payload, see GameSparksRTSessionBuilder::EnableCompression().
+			/// The receiver decompresses the message before passing it to IRTSessionListener::OnPacket(). The message is sent
+			/// uncompressed, if compression is not enabled or does not make it smaller.
+			/// </summary>
+			virtual int SendCompressed(int opCode, GameSparksRT::DeliveryIntent intent,
+									   const System::ArraySegment<System::Byte> &payload, const RTData &data,
+									   const gsstl::vector<int> &targetPlayers)
+			{
+				return SendRTDataAndBytes(opCode, intent, payload, data, targetPlayers);
+			}
+
+			/// <summary>
+			/// Like SendRTData(), but only sends the slots that changed since the baseline of opCode, see
+			/// GameSparksRTSessionBuilder::EnableDeltaEncoding(). The receiver reconstructs the full RTData before passing it
+			/// to IRTSessionListener::OnPacket(). Sent as with SendRTData(), if delta encoding is not enabled or targetPlayers
+			/// is not empty, as the baselines are shared by all peers.
+			/// </summary>
+			virtual int SendDelta(int opCode, GameSparksRT::DeliveryIntent intent, const RTData &data,
+								  const gsstl::vector<int> &targetPlayers)
+			{
+				return SendRTData(opCode, intent, data, targetPlayers);
+			}
+
 			/// <summary>
 			/// This method should be called as frequently as possible by the thread you want
 			/// Your callbacks to execute on. In unity, you should call this from an Update
@@ -98,6 +133,35 @@ namespace GameSparks { namespace RT {
 			/// </summary>
 			virtual void Update() = 0;
 
+			/// <summary>
+			/// Returns false if calling Update() right now would not do anything, i.e. no callbacks are queued,
+			/// no batched packets wait to be sent and no reconnect is due. This can be used to skip calls to Update()
+			/// while the session is idle.
+			/// </summary>
+			virtual bool HasPendingWork() { return true; }
+
+			/// <summary>
+			/// The number of unreliable packets sent so far and the number of datagrams they were sent in.
+			/// The difference is the number of datagrams saved by packing the packets of one frame into
+			/// shared datagrams, see GameSparksRTSessionBuilder::SetMaxDatagramSize().
+			/// </summary>
+			virtual long long GetUnreliablePacketsSent() const { return 0; }
+			virtual long long GetUnreliableDatagramsSent() const { return 0; }
+
+			/// <summary>
+			/// Fills stats with the receive statistics of peerId since it connected. Returns false, if nothing was received from peerId.
+			/// </summary>
+			virtual bool GetPeerStats(int peerId, RTPeerStats& stats) const { (void)peerId; (void)stats; return false; }
+
+			/// <summary>
+			/// The number of heap allocations the session made for received messages so far: the objects its pools created
+			/// and the payload buffers of pooled messages that had to grow, including the buffers compressed, delta encoded
+			/// and fragmented messages are decoded in. The session reuses both, so this stops growing once the traffic
+			/// reached a steady state. Not counted: the fragments of a fragmented message, which are kept per message
+			/// until it is complete. Meant for tests and profiling.
+			/// </summary>
+			virtual long long GetPoolAllocations() const { return 0; }
+
 
 			virtual ~IRTSession(){}
 		protected:
@@ -3,6 +3,7 @@
 
 #include "./Forwards.hpp"
 #include "./GameSparksRT.hpp"
+#include "./RTVector.hpp"
 #include "./Proto/RTVal.hpp"
 #include "./GSLinking.hpp"
 #include "System/Nullable.hpp"
@@ -25,35 +26,6 @@ namespace System{
 
 namespace GameSparks { namespace RT {
 
-    /*!
-     * Can be used to represent points and directions in one to four dimensional space.
-     */
-    class RTVector
-    {
-        public:
-            System::Nullable<float> x;
-            System::Nullable<float> y;
-            System::Nullable<float> z;
-            System::Nullable<float> w;
-
-            RTVector() {}
-            RTVector(float x_) : x(x_) {}
-            RTVector(float x_, float y_) : x(x_), y(y_) {}
-            RTVector(float x_, float y_, float z_) : x(x_), y(y_), z(z_) {}
-            RTVector(float x_, float y_, float z_, float w_) : x(x_), y(y_), z(z_), w(w_) {}
-			friend gsstl::ostream& operator << (gsstl::ostream& os, const RTVector& p);
-
-			bool operator == (const RTVector& o) const
-			{
-				return x == o.x && y == o.y && z == o.z && w == o.w;
-			}
-
-            bool operator != (const RTVector& o) const
-            {
-                return !(*this == o);
-            }
-    };
-
 	typedef unsigned int uint;
 
     /*!
@@ -79,9 +51,14 @@ namespace GameSparks { namespace RT {
             RTData& SetString(uint index, const gsstl::string& value);
             RTData& SetData(uint index, const RTData& value);
             friend GS_API gsstl::ostream& operator << (gsstl::ostream& os, const RTData& p);
+
+            /// true, if both have the same slots set to the same values
+            bool operator == (const RTData& o) const;
+            bool operator != (const RTData& o) const { return !(*this == o); }
         private:
             friend Proto::RTValSerializer;
             friend Proto::RTDataSerializer;
+            friend Proto::RTDataDelta;
 
             // maybe we want to store that sparse (std::map) ?
             gsstl::array<Proto::RTVal, GameSparksRT::MAX_RTDATA_SLOTS> data;
@@ -0,0 +1,40 @@
+#ifndef _GAMESPARKSRT_RTVECTOR_HPP_
+#define _GAMESPARKSRT_RTVECTOR_HPP_
+
+#include "System/Nullable.hpp"
+#include "../GameSparks/gsstl.h"
+
+namespace GameSparks { namespace RT {
+
+    /*!
+     * Can be used to represent points and directions in one to four dimensional space.
+     */
+    class RTVector
+    {
+        public:
+            System::Nullable<float> x;
+            System::Nullable<float> y;
+            System::Nullable<float> z;
+            System::Nullable<float> w;
+
+            RTVector() {}
+            RTVector(float x_) : x(x_) {}
+            RTVector(float x_, float y_) : x(x_), y(y_) {}
+            RTVector(float x_, float y_, float z_) : x(x_), y(y_), z(z_) {}
+            RTVector(float x_, float y_, float z_, float w_) : x(x_), y(y_), z(z_), w(w_) {}
+			friend gsstl::ostream& operator << (gsstl::ostream& os, const RTVector& p);
+
+			bool operator == (const RTVector& o) const
+			{
+				return x == o.x && y == o.y && z == o.z && w == o.w;
+			}
+
+            bool operator != (const RTVector& o) const
+            {
+                return !(*this == o);
+            }
+    };
+
+}} /* namespace GameSparks.RT */
+
+#endif /* _GAMESPARKSRT_RTVECTOR_HPP_ */
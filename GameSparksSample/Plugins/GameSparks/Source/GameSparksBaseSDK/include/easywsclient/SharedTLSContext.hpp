@@ -0,0 +1,183 @@
+#ifndef GAMESPAKS_SHARED_TLS_CONTEXT_HPP
+#define GAMESPAKS_SHARED_TLS_CONTEXT_HPP
+
+#include "GameSparks/GSPlatformDeduction.h"
+#include "GameSparks/gsstl.h"
+
+#include <mbedtls/ssl.h>
+#include <mbedtls/entropy.h>
+#include <mbedtls/ctr_drbg.h>
+#include <mbedtls/platform.h>
+#include <cstdio>
+#include <functional>
+
+#include "easywsclient/CertificateStore.hpp"
+
+namespace GameSparks { namespace Util {
+
+	/// process wide TLS client configuration shared by the websocket and the RT sockets.
+	/// seeding the DRBG and configuring the CA chain is expensive, so this is done once
+	/// instead of for every connection attempt. The context is created by the first call to config()
+	/// and kept until the process exits, so that a reconnect after the last connection was closed
+	/// does not pay for the setup again.
+	///
+	/// the returned mbedtls_ssl_config must be treated as immutable, it is used concurrently by
+	/// all mbedtls_ssl_context instances set up from it.
+	class SharedTLSContext
+	{
+		public:
+			enum MinVersion
+			{
+				AnyVersion = 0, ///< mbedtls defaults
+				TLS12 = 1,      ///< default suite, but with at least TLS 1.2
+				NumVersions = 2
+			};
+
+			/// returns the shared configuration for minVersion, creating it if required.
+			/// returns 0 and stores the mbedtls error code in error, if the configuration could not be created.
+			static const mbedtls_ssl_config* config(MinVersion minVersion, int& error)
+			{
+				State& s = state();
+				gsstl::lock_guard<gsstl::mutex> guard(s.mutex);
+
+				error = 0;
+
+				if (!s.seeded)
+				{
+					mbedtls_entropy_init(&s.entropy);
+					mbedtls_ctr_drbg_init(&s.ctr_drbg);
+
+					static const char personalization[] = "GameSparks";
+					error = mbedtls_ctr_drbg_seed(&s.ctr_drbg, mbedtls_entropy_func, &s.entropy, (const unsigned char*)personalization, sizeof(personalization) - 1);
+					if (error != 0)
+					{
+						mbedtls_ctr_drbg_free(&s.ctr_drbg);
+						mbedtls_entropy_free(&s.entropy);
+						return 0;
+					}
+					s.seeded = true;
+					s.seedThread = gsstl::this_thread::get_id();
+				}
+				else if (s.seedThread != gsstl::this_thread::get_id())
+				{
+					// connections are set up on a dedicated thread each. mix the id of the new thread
+					// into a reseed, so that the DRBG state diverges for every thread it is handed to.
+					size_t threadHash = std::hash<gsstl::thread::id>()(gsstl::this_thread::get_id());
+					gsstl::lock_guard<gsstl::mutex> rngGuard(s.rngMutex);
+					error = mbedtls_ctr_drbg_reseed(&s.ctr_drbg, (const unsigned char*)&threadHash, sizeof(threadHash));
+					if (error != 0)
+					{
+						return 0;
+					}
+					s.seedThread = gsstl::this_thread::get_id();
+				}
+
+				if (!s.configured[minVersion])
+				{
+					mbedtls_ssl_config& conf = s.conf[minVersion];
+					mbedtls_ssl_config_init(&conf);
+
+					error = mbedtls_ssl_config_defaults(&conf,
+						MBEDTLS_SSL_IS_CLIENT,
+						MBEDTLS_SSL_TRANSPORT_STREAM,
+						MBEDTLS_SSL_PRESET_DEFAULT);
+
+					if (error != 0)
+					{
+						mbedtls_ssl_config_free(&conf);
+						return 0;
+					}
+
+					if (minVersion == TLS12)
+					{
+						mbedtls_ssl_conf_min_version(&conf, MBEDTLS_SSL_MAJOR_VERSION_3, MBEDTLS_SSL_MINOR_VERSION_3);
+					}
+
+					mbedtls_ssl_conf_authmode(&conf, MBEDTLS_SSL_VERIFY_NONE);
+
+					// this performs platform specific initialisation by retrieving the certificate store from the OS.
+					// if implemented for this platform, it also sets mbedtls_ssl_conf_authmode to MBEDTLS_SSL_VERIFY_REQUIRED
+					error = CertificateStore::setup(conf);
+					if (error != 0)
+					{
+						mbedtls_ssl_config_free(&conf);
+						return 0;
+					}
+
+					mbedtls_ssl_conf_rng(&conf, random, &s);
+					mbedtls_ssl_conf_dbg(&conf, debug_print, stderr);
+
+					s.configured[minVersion] = true;
+				}
+
+				return &s.conf[minVersion];
+			}
+
+		private:
+			struct State
+			{
+				gsstl::mutex mutex;
+				gsstl::mutex rngMutex;
+				bool seeded;
+				gsstl::thread::id seedThread;
+				mbedtls_entropy_context entropy;
+				mbedtls_ctr_drbg_context ctr_drbg;
+				bool configured[NumVersions];
+				mbedtls_ssl_config conf[NumVersions];
+
+				State()
+				:seeded(false)
+				{
+					for (int i = 0; i != NumVersions; ++i)
+					{
+						configured[i] = false;
+					}
+				}
+
+				void teardown()
+				{
+					for (int i = 0; i != NumVersions; ++i)
+					{
+						if (configured[i])
+						{
+							mbedtls_ssl_config_free(&conf[i]);
+							configured[i] = false;
+						}
+					}
+
+					if (seeded)
+					{
+						mbedtls_ctr_drbg_free(&ctr_drbg);
+						mbedtls_entropy_free(&entropy);
+						seeded = false;
+					}
+				}
+
+				~State() { teardown(); }
+			};
+
+			static State& state()
+			{
+				static State s;
+				return s;
+			}
+
+			/// the DRBG is shared by all connections, so access to it is serialized
+			static int random(void* p_rng, unsigned char* output, size_t len)
+			{
+				State& s = *static_cast<State*>(p_rng);
+				gsstl::lock_guard<gsstl::mutex> guard(s.rngMutex);
+				return mbedtls_ctr_drbg_random(&s.ctr_drbg, output, len);
+			}
+
+			static void debug_print(void *ctx, int level, const char *file, int line, const char *str)
+			{
+				((void)level);
+				mbedtls_fprintf((FILE *)ctx, "%s:%04d: %s", file, line, str);
+				//fflush((FILE *)ctx);
+			}
+	};
+
+}} /* GameSparks::Util */
+
+#endif /* GAMESPAKS_SHARED_TLS_CONTEXT_HPP */
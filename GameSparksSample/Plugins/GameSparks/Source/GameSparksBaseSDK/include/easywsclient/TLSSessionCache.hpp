@@ -0,0 +1,246 @@
+#ifndef GAMESPAKS_TLS_SESSION_CACHE_HPP
+#define GAMESPAKS_TLS_SESSION_CACHE_HPP
+
+#include "GameSparks/GSPlatformDeduction.h"
+#include "GameSparks/gsstl.h"
+
+#include <mbedtls/ssl.h>
+#include <string.h>
+
+namespace GameSparks { namespace Util {
+
+	/// counters describing the TLS handshakes performed by the websocket and the RT sockets.
+	/// full handshakes verify the certificate chain and perform a key exchange,
+	/// resumed handshakes reuse a session (id or ticket) from an earlier connection to the same host.
+	struct TLSHandshakeStats
+	{
+		unsigned long fullHandshakes;
+		unsigned long resumedHandshakes;
+		unsigned long failedHandshakes;
+		double fullHandshakeMillis;    ///< accumulated duration of all full handshakes
+		double resumedHandshakeMillis; ///< accumulated duration of all resumed handshakes
+		double lastHandshakeMillis;    ///< duration of the most recent successful handshake
+
+		TLSHandshakeStats()
+		: fullHandshakes(0), resumedHandshakes(0), failedHandshakes(0)
+		, fullHandshakeMillis(0), resumedHandshakeMillis(0), lastHandshakeMillis(0) {}
+	};
+
+	/// process wide cache of negotiated TLS sessions keyed by "host:port".
+	/// it allows reconnects (connectUrl redirects, dropped connections, RT reconnects)
+	/// to perform an abbreviated handshake instead of a full one.
+	class TLSSessionCache
+	{
+		public:
+			/// sessions older than this are not offered to the server any more
+			enum { MaxSessionAgeSeconds = 60 * 60 };
+
+			/// copies the session cached for key into ssl. returns true if a session was offered.
+			/// optionally copies the master secret of the cached session to master (48 bytes),
+			/// so that the caller can tell afterwards if the server accepted the resumption.
+			static bool restore(mbedtls_ssl_context& ssl, const gsstl::string& key, unsigned char* master = 0)
+			{
+				State& s = state();
+				gsstl::lock_guard<gsstl::mutex> guard(s.mutex);
+
+				gsstl::map<gsstl::string, Entry>::iterator it = s.sessions.find(key);
+				if (it == s.sessions.end())
+				{
+					return false;
+				}
+
+				if (gsstl::chrono::steady_clock::now() - it->second.stored > gsstl::chrono::seconds(MaxSessionAgeSeconds))
+				{
+					mbedtls_ssl_session_free(&it->second.session);
+					s.sessions.erase(it);
+					return false;
+				}
+
+				if (mbedtls_ssl_set_session(&ssl, &it->second.session) != 0)
+				{
+					return false;
+				}
+
+				if (master)
+				{
+					memcpy(master, it->second.session.master, sizeof(it->second.session.master));
+				}
+
+				return true;
+			}
+
+			/// stores a copy of the session negotiated on ssl for later reconnects to key
+			static void store(const mbedtls_ssl_context& ssl, const gsstl::string& key)
+			{
+				Entry entry;
+				mbedtls_ssl_session_init(&entry.session);
+				if (mbedtls_ssl_get_session(&ssl, &entry.session) != 0)
+				{
+					mbedtls_ssl_session_free(&entry.session);
+					return;
+				}
+				entry.stored = gsstl::chrono::steady_clock::now();
+
+				State& s = state();
+				gsstl::lock_guard<gsstl::mutex> guard(s.mutex);
+
+				gsstl::map<gsstl::string, Entry>::iterator it = s.sessions.find(key);
+				if (it != s.sessions.end())
+				{
+					mbedtls_ssl_session_free(&it->second.session);
+					it->second = entry;
+				}
+				else
+				{
+					s.sessions.insert(gsstl::map<gsstl::string, Entry>::value_type(key, entry));
+				}
+			}
+
+			/// drops the session cached for key. used when a handshake with a cached session failed.
+			static void invalidate(const gsstl::string& key)
+			{
+				State& s = state();
+				gsstl::lock_guard<gsstl::mutex> guard(s.mutex);
+
+				gsstl::map<gsstl::string, Entry>::iterator it = s.sessions.find(key);
+				if (it != s.sessions.end())
+				{
+					mbedtls_ssl_session_free(&it->second.session);
+					s.sessions.erase(it);
+				}
+			}
+
+			/// drops all cached sessions
+			static void clear()
+			{
+				State& s = state();
+				gsstl::lock_guard<gsstl::mutex> guard(s.mutex);
+				s.clear();
+			}
+
+			static void recordHandshake(bool resumed, double millis)
+			{
+				State& s = state();
+				gsstl::lock_guard<gsstl::mutex> guard(s.mutex);
+
+				if (resumed)
+				{
+					++s.stats.resumedHandshakes;
+					s.stats.resumedHandshakeMillis += millis;
+				}
+				else
+				{
+					++s.stats.fullHandshakes;
+					s.stats.fullHandshakeMillis += millis;
+				}
+				s.stats.lastHandshakeMillis = millis;
+			}
+
+			static void recordFailedHandshake()
+			{
+				State& s = state();
+				gsstl::lock_guard<gsstl::mutex> guard(s.mutex);
+				++s.stats.failedHandshakes;
+			}
+
+			/// returns a snapshot of the handshake counters
+			static TLSHandshakeStats getStats()
+			{
+				State& s = state();
+				gsstl::lock_guard<gsstl::mutex> guard(s.mutex);
+				return s.stats;
+			}
+
+			static void resetStats()
+			{
+				State& s = state();
+				gsstl::lock_guard<gsstl::mutex> guard(s.mutex);
+				s.stats = TLSHandshakeStats();
+			}
+
+		private:
+			struct Entry
+			{
+				mbedtls_ssl_session session;
+				gsstl::chrono::steady_clock::time_point stored;
+			};
+
+			struct State
+			{
+				gsstl::map<gsstl::string, Entry> sessions;
+				TLSHandshakeStats stats;
+				gsstl::mutex mutex;
+
+				void clear()
+				{
+					for (gsstl::map<gsstl::string, Entry>::iterator it = sessions.begin(); it != sessions.end(); ++it)
+					{
+						mbedtls_ssl_session_free(&it->second.session);
+					}
+					sessions.clear();
+				}
+
+				~State() { clear(); }
+			};
+
+			static State& state()
+			{
+				static State s;
+				return s;
+			}
+	};
+
+	/// tracks a single client handshake: offers a cached session before mbedtls_ssl_handshake()
+	/// and stores the negotiated session and the handshake metrics afterwards.
+	///
+	///     TLSSessionResumption resumption(host, port);
+	///     resumption.offer(ssl);
+	///     do res = mbedtls_ssl_handshake(&ssl); while(...);
+	///     if (res != 0) resumption.failed(); else resumption.succeeded(ssl);
+	class TLSSessionResumption
+	{
+		public:
+			TLSSessionResumption(const gsstl::string& host, const gsstl::string& port)
+			:key(host + ":" + port)
+			,offered(false)
+			,start(gsstl::chrono::steady_clock::now())
+			{
+				memset(master, 0, sizeof(master));
+			}
+
+			void offer(mbedtls_ssl_context& ssl)
+			{
+				offered = TLSSessionCache::restore(ssl, key, master);
+				start = gsstl::chrono::steady_clock::now();
+			}
+
+			void succeeded(const mbedtls_ssl_context& ssl)
+			{
+				double millis = gsstl::chrono::duration_cast<gsstl::chrono::microseconds>(gsstl::chrono::steady_clock::now() - start).count() / 1000.0;
+
+				// an abbreviated handshake keeps the master secret of the resumed session
+				bool resumed = offered && ssl.session && memcmp(ssl.session->master, master, sizeof(master)) == 0;
+
+				TLSSessionCache::recordHandshake(resumed, millis);
+				TLSSessionCache::store(ssl, key);
+			}
+
+			void failed()
+			{
+				TLSSessionCache::recordFailedHandshake();
+				if (offered)
+				{
+					TLSSessionCache::invalidate(key);
+				}
+			}
+
+		private:
+			gsstl::string key;
+			bool offered;
+			unsigned char master[48];
+			gsstl::chrono::steady_clock::time_point start;
+	};
+
+}} /* GameSparks::Util */
+
+#endif /* GAMESPAKS_TLS_SESSION_CACHE_HPP */
@@ -2,16 +2,10 @@
 
 namespace GameSparks { namespace RT {
 
-CustomRequest::CustomRequest(int opCode_, GameSparksRT::DeliveryIntent intent_, const System::ArraySegment<System::Byte>& payload_, const RTData& data, gsstl::vector<int> targetPlayers)
+CustomRequest::CustomRequest(int opCode_, GameSparksRT::DeliveryIntent intent_, const System::ArraySegment<System::Byte>& payload_, const RTData& data, const gsstl::vector<int>& targetPlayers)
 :Commands::RTRequest(opCode_)
+,payload(payload_)
 {
-    payload.resize(payload_.Count());
-
-    gsstl::copy(
-        payload_.Array().begin() + payload_.Offset(),
-        payload_.Array().begin() + payload_.Offset() + payload_.Count(),
-        payload.begin());
-
     intent = intent_;
     Data = data;
     if(!targetPlayers.empty())
@@ -19,8 +13,8 @@ CustomRequest::CustomRequest(int opCode_, GameSparksRT::DeliveryIntent intent_,
 }
 
 System::Failable<void> CustomRequest::Serialize(System::IO::Stream &stream) const {
-    if (!payload.empty()) {
-        GS_CALL_OR_THROW(stream.Write (payload, 0, int(payload.size())));
+    if (payload.Count() > 0) {
+        GS_CALL_OR_THROW(stream.Write (payload.Array(), payload.Offset(), payload.Count()));
     }
     return {};
 }
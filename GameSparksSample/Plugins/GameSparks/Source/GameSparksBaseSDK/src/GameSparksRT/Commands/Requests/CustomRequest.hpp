@@ -10,9 +10,10 @@ namespace GameSparks { namespace RT {
 	class CustomRequest : public Commands::RTRequest
 	{
 		public:
-			System::Bytes payload;
+			/// refers to the payload passed to the constructor, which has to outlive the request. requests are serialized right away.
+			System::ArraySegment<System::Byte> payload;
 
-			CustomRequest(int opCode, GameSparksRT::DeliveryIntent intent, const System::ArraySegment<System::Byte>& payload, const RTData& data, gsstl::vector<int> targetPlayers);
+			CustomRequest(int opCode, GameSparksRT::DeliveryIntent intent, const System::ArraySegment<System::Byte>& payload, const RTData& data, const gsstl::vector<int>& targetPlayers);
 
 			virtual System::Failable<void> Serialize(System::IO::Stream &stream) const override;
 		private:
@@ -17,6 +17,7 @@ namespace Com { namespace Gamesparks { namespace Realtime { namespace Proto {
 
 			static System::Failable<PlayerDisconnectMessage*> Deserialize(System::IO::Stream& stream);
 			virtual void Execute() override;
+			virtual PlayerDisconnectMessage* asPlayerDisconnectMessage() override { return this; }
 
 		private:
 	};
@@ -37,20 +37,60 @@ FastConnection::FastConnection(const gsstl::string &remotehost, const gsstl::str
 }
 
 System::Failable<int> FastConnection::Send(const Commands::RTRequest &request) {
-    System::IO::MemoryStream ms_;
-
-    GS_CALL_OR_THROW(ms_.Position(0));
+    GS_CALL_OR_THROW(packetStream.SetLength(0));
     Proto::Packet p = request.ToPacket(*session, true);
 
     GS_TRY
     {
-        GS_CALL_OR_CATCH(Proto::Packet::SerializeLengthDelimited(ms_, p));
+        GS_CALL_OR_CATCH(Proto::Packet::SerializeLengthDelimited(packetStream, p));
     }
     GS_CATCH(e) {(void)e;}
 
-    GS_CALL_OR_THROW(client.Send (ms_.GetBuffer(), ms_.Position()));
+    GS_CALL_OR_THROW(client.Send (packetStream.GetBuffer(), packetStream.Position()));
+    session->OnFastDatagramSent(1);
 
-    return ms_.Position();
+    return packetStream.Position();
+}
+
+System::Failable<int> FastConnection::Queue(const Commands::RTRequest &request) {
+    if (maxDatagramSize <= 0) {
+        return Send(request);
+    }
+
+    Proto::Packet p = request.ToPacket(*session, true);
+    GS_CALL_OR_THROW(packetStream.Position(0));
+    GS_CALL_OR_THROW(Proto::Packet::SerializeLengthDelimited(packetStream, p));
+    const int size = packetStream.Position();
+
+    if (datagramPackets > 0 && datagram.Position() + size > maxDatagramSize) {
+        GS_CALL_OR_THROW(Flush());
+    }
+
+    if (size >= maxDatagramSize) {
+        // does not share a datagram with anything else anyway
+        GS_CALL_OR_THROW(client.Send (packetStream.GetBuffer(), size));
+        session->OnFastDatagramSent(1);
+        return size;
+    }
+
+    GS_CALL_OR_THROW(datagram.Write(packetStream.GetBuffer(), 0, size));
+    ++datagramPackets;
+    return size;
+}
+
+System::Failable<void> FastConnection::Flush() {
+    if (datagramPackets == 0) {
+        return {};
+    }
+
+    const int size = datagram.Position();
+    const int packets = datagramPackets;
+    datagramPackets = 0;
+    GS_CALL_OR_THROW(datagram.Position(0));
+
+    GS_CALL_OR_THROW(client.Send (datagram.GetBuffer(), size));
+    session->OnFastDatagramSent(packets);
+    return {};
 }
 
 void FastConnection::StopInternal() {
@@ -142,8 +182,9 @@ void FastConnection::ReadBuffer(int read)
 		if (!session)
 			return;
 
-        BinaryWriteMemoryStream ms;
-		GS_CALL_OR_CATCH(ms.Position(0));
+        // the stream is reused, so that its buffer is allocated only once
+        BinaryWriteMemoryStream& ms = received;
+		GS_CALL_OR_CATCH(ms.SetLength(0));
         GS_CALL_OR_CATCH(ms.Write (buffer, 0, read));
         GS_CALL_OR_CATCH(ms.Position(0));
 
@@ -152,7 +193,10 @@ void FastConnection::ReadBuffer(int read)
             {
                 assert(session);
                 Commands::Packet p(*session);
-                GS_CALL_OR_CATCH(Commands::Packet::DeserializeLengthDelimited (ms, ms.BinaryReader, p));
+                {
+                    Core::GSProfilerScope profilerScope(session->GetProfiler(), Core::IGSProfiler::SCOPE_RT_PACKET_DECODE);
+                    GS_CALL_OR_CATCH(Commands::Packet::DeserializeLengthDelimited (ms, ms.BinaryReader, p));
+                }
                 p.Reliable = p.Reliable.GetValueOrDefault (false);
                 GS_CALL_OR_CATCH(OnPacketReceived (p));
                 p = Commands::Packet(*session); // reset packet to default state
@@ -6,6 +6,7 @@
 #include "../../System/Net/Sockets/UdpClient.hpp"
 #include "../Proto/ReusableBinaryWriter.hpp"
 #include "../../System/AsyncCallback.hpp"
+#include "../../System/IO/MemoryStream.hpp"
 
 namespace System {class IAsyncResult;}
 
@@ -15,9 +16,23 @@ namespace GameSparks { namespace RT { namespace Connection {
 	{
 		public:
 			FastConnection (const gsstl::string& remotehost, const gsstl::string& port, IRTSessionInternal* session, gsstl::recursive_mutex& sessionSendMutex);
+			/// sends request in a datagram of its own right away
 			virtual System::Failable<int> Send(const Commands::RTRequest &request) override;
 			virtual void StopInternal() override;
 
+			/// appends request to the datagram sent by the next call to Flush(). If the datagram would
+			/// exceed the maximum datagram size, the queued packets are sent first.
+			System::Failable<int> Queue(const Commands::RTRequest &request);
+
+			/// sends the queued packets in a single datagram
+			System::Failable<void> Flush();
+
+			/// true, if Flush() has packets to send
+			bool HasQueued() const { return datagramPackets > 0; }
+
+			/// packets are only packed into a datagram up to this size. 0 disables packing, so that Queue() behaves like Send().
+			void SetMaxDatagramSize(int bytes) { maxDatagramSize = bytes; }
+
 			System::Bytes buffer = System::Bytes(GameSparksRT::MAX_MESSAGE_SIZE_BYTES);
 		private:
 			void DoLogin();
@@ -28,6 +43,15 @@ namespace GameSparks { namespace RT { namespace Connection {
 			System::Net::Sockets::UdpClient client;
 
 			System::AsyncCallback callback;
+
+			// Send(), Queue() and Flush() are called with the send mutex of the session locked
+			System::IO::MemoryStream packetStream;
+			System::IO::MemoryStream datagram;
+			int datagramPackets = 0;
+			int maxDatagramSize = 0;
+
+			// ReadBuffer() is called with the session mutex locked
+			BinaryWriteMemoryStream received;
 	};
 
 }}} /* namespace GameSparks.RT.Connection */
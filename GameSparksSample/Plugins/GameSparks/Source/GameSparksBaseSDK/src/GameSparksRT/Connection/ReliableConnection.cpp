@@ -35,36 +35,48 @@ ReliableConnection::ReliableConnection  (const gsstl::string& remotehost, const
 #endif
 
 System::Failable<int> ReliableConnection::Send(const RTRequest& request){
-    /*if (client.Connected()) {
-        Packet p = request.ToPacket (*session, false);
-        Packet::SerializeLengthDelimited (client.GetStream (), p);
-    }*/
     if (client.Connected()) {
         Packet p = request.ToPacket (*session, false);
-        GS_TRY
-        {
-            GS_ASSIGN_OR_CATCH(tmp, Packet::SerializeLengthDelimited (client.GetStream (), p));
-            return tmp;
-        }
-        GS_CATCH(e)
-        {
-            gsstl::clog << e << gsstl::endl;
-            if (session != nullptr && !stopped) {
-                session->SetConnectState(GameSparksRT::ConnectState::Disconnected);
-                session->Log ("ReliableConnection", GameSparksRT::LogLevel::LL_DEBUG, e.Format());
-
-                // without exception support enabled in the compiler, we're not able to catch exceptions in client code
-                GS_TRY
-                {
-                    session->OnReady (false);
-                } GS_CATCH(e) {(void)e;}
-            }
-            return 0;
-        }
+        gsstl::lock_guard<gsstl::recursive_mutex> lock(outputMutex);
+        return Packet::SerializeLengthDelimited (output, p);
     }
     return -1;
 }
 
+void ReliableConnection::Flush(){
+    gsstl::lock_guard<gsstl::recursive_mutex> lock(outputMutex);
+    const int size = output.Position();
+    if (size == 0) {
+        return;
+    }
+
+    GS_TRY
+    {
+        // the buffer is reused, even if the write fails the connection is unusable afterwards
+        GS_CALL_OR_CATCH(output.Position(0));
+        GS_CALL_OR_CATCH(client.GetStream().Write(output.GetBuffer(), 0, size));
+    }
+    GS_CATCH(e)
+    {
+        gsstl::clog << e << gsstl::endl;
+        if (session != nullptr && !stopped) {
+            session->SetConnectState(GameSparksRT::ConnectState::Disconnected);
+            session->Log ("ReliableConnection", GameSparksRT::LogLevel::LL_DEBUG, e.Format());
+
+            // without exception support enabled in the compiler, we're not able to catch exceptions in client code
+            GS_TRY
+            {
+                session->OnReady (false);
+            } GS_CATCH(e) {(void)e;}
+        }
+    }
+}
+
+int ReliableConnection::GetBufferedBytes(){
+    gsstl::lock_guard<gsstl::recursive_mutex> lock(outputMutex);
+    return output.Position();
+}
+
 #if defined(_MSC_VER)
 #	pragma warning (pop)
 #endif
@@ -93,6 +105,7 @@ void ReliableConnection::ConnectCallback(IAsyncResult /*result*/)
     {
         LoginCommand loginCmd(session->ConnectToken());
         GS_CALL_OR_CATCH(Send (loginCmd));
+        Flush();
 
         Packet p;
         {
@@ -156,6 +169,7 @@ System::Failable<bool> ReliableConnection::read(PositionStream& stream, Packet&
         return false;
     }
 
+    Core::GSProfilerScope profilerScope(session ? session->GetProfiler() : nullptr, Core::IGSProfiler::SCOPE_RT_PACKET_DECODE);
     GS_CALL_OR_THROW(Packet::DeserializeLengthDelimited (stream, stream.BinaryReader, p));
     //p.Session = session;
     p.Reliable = p.Reliable.GetValueOrDefault(true);
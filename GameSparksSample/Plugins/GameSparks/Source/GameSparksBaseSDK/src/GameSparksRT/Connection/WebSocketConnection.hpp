@@ -20,6 +20,9 @@ namespace GameSparks { namespace RT { namespace Connection {
 			virtual void StopInternal() override;
 
 			void Poll();
+
+			/// true, if Poll() has something to do, see easywsclient::WebSocket::needsPoll()
+			bool NeedsPoll() const { return client && client->needsPoll(); }
 		private:
 			void ConnectCallback();
 			static void DataReceived(const gsstl::string & message, void* This);
@@ -1,6 +1,8 @@
 #ifndef _GAMESPARKSRT_IRTCOMMAND_HPP_
 #define _GAMESPARKSRT_IRTCOMMAND_HPP_
 
+namespace Com { namespace Gamesparks { namespace Realtime { namespace Proto { class PlayerDisconnectMessage; }}}}
+
 namespace GameSparks { namespace RT {
 
 	class IRTCommand
@@ -10,6 +12,8 @@ namespace GameSparks { namespace RT {
 			virtual ~IRTCommand() {}
 
 			virtual class AbstractResult* asAbstractResult() { return nullptr; }
+			virtual class CustomCommand* asCustomCommand() { return nullptr; }
+			virtual Com::Gamesparks::Realtime::Proto::PlayerDisconnectMessage* asPlayerDisconnectMessage() { return nullptr; }
 		private:
 	};
 
@@ -11,6 +11,11 @@
 #include "../../include/GameSparksRT/IRTSessionListener.hpp"
 #include "../../include/GameSparksRT/GameSparksRT.hpp"
 #include "../System/String.hpp"
+#include "../System/Failable.hpp"
+
+namespace System { namespace IO {
+	class MemoryStream;
+}}
 
 namespace GameSparks { namespace RT {
 
@@ -58,10 +63,47 @@ namespace GameSparks { namespace RT {
 			virtual void ConnectReliable () =0;
 			virtual void ConnectFast () =0;
 			virtual bool ShouldExecute (int peerId, System::Nullable<int> sequence) = 0;
-			virtual void SubmitAction (gsstl::unique_ptr<IRTCommand>& action) =0;
+			/// queues action for Update(). sequenced is true for messages received UNRELIABLE_SEQUENCED, those may be
+			/// dropped in favour of a newer message, see GameSparksRTSessionBuilder::EnableSequencedCollapse().
+			virtual void SubmitAction (gsstl::unique_ptr<IRTCommand>& action, bool sequenced = false) =0;
 			virtual int NextSequenceNumber() = 0;
 
+			/// a CustomCommand for CustomCommand::Deserialize(), from the pool of the session. never null.
+			virtual gsstl::unique_ptr<CustomCommand> PopCustomCommand();
+
+			/// called by CustomCommand::Deserialize(), if the payload buffer of the command had to be reallocated
+			virtual void OnPayloadAllocated() {}
+
+			/// a pool of scratch streams for serializing packets, may be null
+			virtual Pools::ObjectPool<System::IO::MemoryStream>* ScratchStreams() { return nullptr; }
+
 			virtual void SetConnectState(GameSparksRT::ConnectState value) = 0;
+
+			/// the profiler passed to GameSparksRTSessionBuilder::SetProfiler(), if any
+			virtual Core::IGSProfiler* GetProfiler() const { return nullptr; }
+
+			/// called by the fast connection for every datagram it sends, with the number of packets in it
+			virtual void OnFastDatagramSent(int /*packets*/) {}
+
+			/// the opCode of fragments, see GameSparksRTSessionBuilder::EnableFragmentation(). 0 if fragmentation is disabled.
+			virtual int FragmentOpCode() const { return 0; }
+
+			/// reads a fragment of limit bytes from stream. returns the command delivering the reassembled message,
+			/// if this was its last missing fragment, null otherwise.
+			virtual System::Failable<IRTCommand*> OnFragmentReceived(int /*sender*/, System::IO::Stream& /*stream*/, int /*limit*/) { return nullptr; }
+
+			/// the opCode of compressed messages, see GameSparksRTSessionBuilder::EnableCompression(). 0 if compression is disabled.
+			virtual int CompressionOpCode() const { return 0; }
+
+			/// reads a compressed message of limit bytes from stream. returns the command delivering the decompressed message.
+			virtual System::Failable<IRTCommand*> OnCompressedReceived(int /*sender*/, System::IO::Stream& /*stream*/, int /*limit*/) { return nullptr; }
+
+			/// the opCode of delta packets, see GameSparksRTSessionBuilder::EnableDeltaEncoding(). 0 if delta encoding is disabled.
+			virtual int DeltaOpCode() const { return 0; }
+
+			/// reads the header of a delta packet of limit bytes from stream, data holds its slots. returns the command delivering
+			/// the reconstructed message or requesting a resync, null if there is nothing to do.
+			virtual System::Failable<IRTCommand*> OnDeltaReceived(int /*sender*/, System::IO::Stream& /*stream*/, int /*limit*/, const RTData& /*data*/) { return nullptr; }
 		private:
 			virtual void DoLog (const gsstl::string& tag, GameSparksRT::LogLevel level, const gsstl::string& msg) = 0;
 
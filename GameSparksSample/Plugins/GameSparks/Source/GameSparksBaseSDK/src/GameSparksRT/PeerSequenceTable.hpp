@@ -0,0 +1,111 @@
+#ifndef _GAMESPARKSRT_PEERSEQUENCETABLE_HPP_
+#define _GAMESPARKSRT_PEERSEQUENCETABLE_HPP_
+
+#include "../../include/GameSparks/gsstl.h"
+#include "../../include/System/Nullable.hpp"
+#include "../../include/GameSparksRT/IRTSession.hpp"
+
+namespace GameSparks { namespace RT {
+
+	/*!
+		The sequence state and receive statistics of the peers, indexed by peerId. Peer ids are small, so the peers
+		are kept in a vector, with a map as fallback for unexpected ids. Not thread safe.
+	*/
+	class PeerSequenceTable
+	{
+		public:
+			/// counts the packet and returns false, if it is sequenced and not newer than the newest sequenced packet of peerId.
+			/// sequence numbers are compared modulo 2^32, so that they may wrap around.
+			bool Accept(int peerId, const System::Nullable<int>& sequence)
+			{
+				Peer& peer = Get(peerId);
+				++peer.stats.packetsReceived;
+
+				if (!sequence.HasValue())
+				{
+					return true;
+				}
+
+				const int value = sequence.Value();
+				if (peer.hasSequence)
+				{
+					const int32_t delta = int32_t(uint32_t(value) - uint32_t(peer.maxSequence));
+					if (delta <= 0)
+					{
+						++peer.stats.sequencedDiscarded;
+						return false;
+					}
+					peer.stats.sequenceGaps += delta - 1;
+				}
+
+				peer.hasSequence = true;
+				peer.maxSequence = value;
+				++peer.stats.sequencedReceived;
+				return true;
+			}
+
+			/// forgets the state of peerId, e.g. because it (re)connected
+			void Reset(int peerId)
+			{
+				if (peerId >= 0 && peerId < int(peers.size()))
+				{
+					peers[peerId] = Peer();
+				}
+				else
+				{
+					overflow.erase(peerId);
+				}
+			}
+
+			bool GetStats(int peerId, RTPeerStats& stats) const
+			{
+				const Peer* peer = nullptr;
+				if (peerId >= 0 && peerId < int(peers.size()))
+				{
+					peer = &peers[peerId];
+				}
+				else
+				{
+					auto pos = overflow.find(peerId);
+					peer = pos != overflow.end() ? &pos->second : nullptr;
+				}
+
+				if (!peer || peer->stats.packetsReceived == 0)
+				{
+					return false;
+				}
+				stats = peer->stats;
+				return true;
+			}
+
+		private:
+			enum { MAX_DENSE_PEER_ID = 1023 };
+
+			struct Peer
+			{
+				bool hasSequence = false;
+				int maxSequence = 0;
+				RTPeerStats stats;
+			};
+
+			Peer& Get(int peerId)
+			{
+				if (peerId >= 0 && peerId < int(peers.size()))
+				{
+					return peers[peerId];
+				}
+				if (peerId >= 0 && peerId <= MAX_DENSE_PEER_ID)
+				{
+					peers.resize(peerId + 1);
+					return peers[peerId];
+				}
+				return overflow[peerId];
+			}
+
+			gsstl::vector<Peer> peers;
+			gsstl::map<int, Peer> overflow;
+	};
+
+}} /* namespace GameSparks.RT */
+
+#endif /* _GAMESPARKSRT_PEERSEQUENCETABLE_HPP_ */
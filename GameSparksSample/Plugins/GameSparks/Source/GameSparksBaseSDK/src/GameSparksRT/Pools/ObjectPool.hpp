@@ -0,0 +1,102 @@
+#ifndef _GAMESPARKSRT_OBJECTPOOL_HPP_
+#define _GAMESPARKSRT_OBJECTPOOL_HPP_
+
+#include "../../../include/GameSparks/gsstl.h"
+
+namespace GameSparks { namespace RT { namespace Pools {
+
+	/*!
+		A thread safe pool of heap allocated objects, so that the objects needed per packet are allocated
+		once per session instead of once per packet. Pop() hands out a pooled object, or creates one with the
+		factory if the pool is empty. Push() takes the object back, up to maxSize objects are kept.
+		Objects are not reset, that is up to the user.
+	*/
+	template <typename T>
+	class ObjectPool
+	{
+		public:
+			typedef gsstl::function<T*()> Factory;
+
+			explicit ObjectPool(size_t maxSize_ = 64, const Factory& factory_ = &ObjectPool::Create)
+			:factory(factory_)
+			,maxSize(maxSize_)
+			{
+				objects.reserve(maxSize);
+			}
+
+			gsstl::unique_ptr<T> Pop()
+			{
+				{
+					gsstl::lock_guard<gsstl::mutex> lock(mutex);
+					if (!objects.empty())
+					{
+						gsstl::unique_ptr<T> object(gsstl::move(objects.back()));
+						objects.pop_back();
+						return object;
+					}
+					++allocations;
+				}
+				return gsstl::unique_ptr<T>(factory());
+			}
+
+			void Push(gsstl::unique_ptr<T> object)
+			{
+				gsstl::lock_guard<gsstl::mutex> lock(mutex);
+				if (object && objects.size() < maxSize)
+				{
+					objects.push_back(gsstl::move(object));
+				}
+			}
+
+			/// number of objects created by Pop() so far
+			long long GetAllocations() const
+			{
+				gsstl::lock_guard<gsstl::mutex> lock(mutex);
+				return allocations;
+			}
+		private:
+			static T* Create() { return new T(); }
+
+			ObjectPool(const ObjectPool&);
+			ObjectPool& operator=(const ObjectPool&);
+
+			Factory factory;
+			size_t maxSize;
+			mutable gsstl::mutex mutex;
+			gsstl::vector<gsstl::unique_ptr<T> > objects;
+			long long allocations = 0;
+	};
+
+	/*!
+		Borrows an object from pool for the lifetime of the Pooled instance. Without a pool, a temporary object is created.
+	*/
+	template <typename T>
+	class Pooled
+	{
+		public:
+			explicit Pooled(ObjectPool<T>* pool_)
+			:pool(pool_)
+			,object(pool_ ? pool_->Pop() : gsstl::unique_ptr<T>(new T()))
+			{}
+
+			~Pooled()
+			{
+				if (pool)
+				{
+					pool->Push(gsstl::move(object));
+				}
+			}
+
+			T& operator*() const { return *object; }
+			T* operator->() const { return object.get(); }
+		private:
+			Pooled(const Pooled&);
+			Pooled& operator=(const Pooled&);
+
+			ObjectPool<T>* pool;
+			gsstl::unique_ptr<T> object;
+	};
+
+}}} /* namespace GameSparks.RT.Pools */
+
+#endif /* _GAMESPARKSRT_OBJECTPOOL_HPP_ */
@@ -0,0 +1,180 @@
+#include "./Fragmentation.hpp"
+#include "./RTData.Serializer.hpp"
+#include "./Varint.hpp"
+#include "./ReusableBinaryWriter.hpp"
+#include "./ProtocolBufferException.hpp"
+
+namespace GameSparks { namespace RT { namespace Proto {
+
+int Fragmentation::MessageSize(const RTData& data, const System::ArraySegment<System::Byte>& payload)
+{
+    const int dataSize = RTDataSerializer::SizeOf(data);
+    return Varint::SizeOf((uint32_t)dataSize) + dataSize + payload.Count();
+}
+
+System::Failable<void> Fragmentation::WriteMessage(System::Bytes& message, const RTData& data, const System::ArraySegment<System::Byte>& payload,
+                                                   System::IO::MemoryStream& scratch)
+{
+    GS_CALL_OR_THROW(scratch.SetLength(0));
+    GS_CALL_OR_THROW(RTDataSerializer::WriteRTData(scratch, data));
+
+    const auto& written = scratch.GetBuffer();
+    message.assign(written.begin(), written.begin() + scratch.Position());
+    message.insert(message.end(),
+        payload.Array().begin() + payload.Offset(),
+        payload.Array().begin() + payload.Offset() + payload.Count());
+    return {};
+}
+
+System::Failable<void> Fragmentation::ReadMessage(const System::Bytes& message, RTData& data, System::Bytes& payload,
+                                                  BinaryWriteMemoryStream& ms)
+{
+    GS_CALL_OR_THROW(ms.SetLength(0));
+    GS_CALL_OR_THROW(ms.Write(message, 0, int(message.size())));
+    GS_CALL_OR_THROW(ms.Position(0));
+
+    data = RTData();
+    GS_CALL_OR_THROW(RTDataSerializer::ReadRTData(ms, ms.BinaryReader, data));
+    payload.assign(message.begin() + ms.Position(), message.end());
+    return {};
+}
+
+void Fragmentation::WriteFragment(System::Bytes& fragment, int opCode, bool sequenced, uint16_t messageId,
+                                  int index, int count, const System::Bytes& message, int chunkSize)
+{
+    assert(index >= 0 && index < count && count <= MAX_FRAGMENTS);
+
+    const int offset = index * chunkSize;
+    const int size = gsstl::min(chunkSize, int(message.size()) - offset);
+    assert(size > 0);
+
+    fragment.resize(HEADER_SIZE + size);
+    fragment[0] = sequenced ? 1 : 0;
+    fragment[1] = System::Byte(opCode);
+    fragment[2] = System::Byte(opCode >> 8);
+    fragment[3] = System::Byte(opCode >> 16);
+    fragment[4] = System::Byte(opCode >> 24);
+    fragment[5] = System::Byte(messageId);
+    fragment[6] = System::Byte(messageId >> 8);
+    fragment[7] = System::Byte(index);
+    fragment[8] = System::Byte(count);
+    gsstl::copy(message.begin() + offset, message.begin() + offset + size, fragment.begin() + HEADER_SIZE);
+}
+
+FragmentReassembler::FragmentReassembler(int maxMessageSize_, int maxPendingMessagesPerSender, float timeoutSeconds)
+:maxMessageSize(maxMessageSize_)
+,maxPendingMessages(maxPendingMessagesPerSender)
+,timeout(gsstl::chrono::duration_cast<gsstl::chrono::steady_clock::duration>(gsstl::chrono::duration<float>(timeoutSeconds)))
+{
+    assert(maxPendingMessages > 0);
+}
+
+void FragmentReassembler::DropExpired(Sender& sender, const gsstl::chrono::steady_clock::time_point& now)
+{
+    for (auto it = sender.pending.begin(); it != sender.pending.end(); )
+    {
+        if (now - it->firstFragmentAt > timeout)
+            it = sender.pending.erase(it);
+        else
+            ++it;
+    }
+}
+
+System::Failable<bool> FragmentReassembler::Add(int senderId, const System::Bytes& fragment, int& opCode, RTData& data, System::Bytes& payload)
+{
+    if (fragment.size() <= Fragmentation::HEADER_SIZE)
+    {
+        GS_THROW(ProtocolBufferException("fragment too short"));
+    }
+
+    const bool sequenced = (fragment[0] & 1) != 0;
+    const int messageOpCode = int(uint32_t(fragment[1]) | (uint32_t(fragment[2]) << 8) | (uint32_t(fragment[3]) << 16) | (uint32_t(fragment[4]) << 24));
+    const uint16_t id = uint16_t(fragment[5] | (fragment[6] << 8));
+    const int index = fragment[7];
+    const int count = fragment[8];
+
+    if (count == 0 || index >= count)
+    {
+        GS_THROW(ProtocolBufferException("invalid fragment index"));
+    }
+
+    Sender& sender = senders[senderId];
+    const auto now = gsstl::chrono::steady_clock::now();
+    DropExpired(sender, now);
+
+    // a sequenced message older than the last one delivered would be discarded anyway
+    if (sequenced && sender.hasSequenced && int16_t(id - sender.lastSequenced) <= 0)
+    {
+        return false;
+    }
+
+    auto message = sender.pending.begin();
+    while (message != sender.pending.end() && message->id != id)
+    {
+        ++message;
+    }
+
+    if (message == sender.pending.end())
+    {
+        if (int(sender.pending.size()) >= maxPendingMessages)
+        {
+            sender.pending.pop_front(); // the oldest incomplete message is lost
+        }
+
+        sender.pending.push_back(Message());
+        message = --sender.pending.end();
+        message->id = id;
+        message->opCode = messageOpCode;
+        message->sequenced = sequenced;
+        message->chunks.resize(count);
+        message->firstFragmentAt = now;
+    }
+    else if (int(message->chunks.size()) != count)
+    {
+        // message id reused before the old message completed or timed out
+        sender.pending.erase(message);
+        GS_THROW(ProtocolBufferException("inconsistent fragment count"));
+    }
+
+    if (!message->chunks[index].empty())
+    {
+        return false; // duplicate
+    }
+
+    message->size += int(fragment.size()) - Fragmentation::HEADER_SIZE;
+    if (message->size > maxMessageSize)
+    {
+        sender.pending.erase(message);
+        GS_THROW(ProtocolBufferException("fragmented message exceeds the maximum message size"));
+    }
+
+    message->chunks[index].assign(fragment.begin() + Fragmentation::HEADER_SIZE, fragment.end());
+    if (++message->received < count)
+    {
+        return false;
+    }
+
+    complete.clear();
+    for (const auto& chunk : message->chunks)
+    {
+        complete.insert(complete.end(), chunk.begin(), chunk.end());
+    }
+
+    opCode = message->opCode;
+    if (message->sequenced)
+    {
+        sender.hasSequenced = true;
+        sender.lastSequenced = message->id;
+    }
+    sender.pending.erase(message);
+
+    GS_CALL_OR_THROW(Fragmentation::ReadMessage(complete, data, payload, stream));
+    return true;
+}
+
+void FragmentReassembler::Clear(int sender)
+{
+    senders.erase(sender);
+}
+
+}}} /* namespace GameSparks.RT.Proto */
@@ -0,0 +1,101 @@
+#ifndef _GAMESPARKSRT_FRAGMENTATION_HPP_
+#define _GAMESPARKSRT_FRAGMENTATION_HPP_
+
+#include "../../../include/GameSparks/gsstl.h"
+#include "../../../include/System/Bytes.hpp"
+#include "../../../include/System/ArraySegment.hpp"
+#include "../../../include/GameSparksRT/RTData.hpp"
+#include "../../System/Failable.hpp"
+#include "./ReusableBinaryWriter.hpp"
+
+namespace GameSparks { namespace RT { namespace Proto {
+
+	/*!
+		Splits unreliable messages that do not fit into a single datagram into fragments, see
+		GameSparksRTSessionBuilder::EnableFragmentation().
+
+		Each fragment is the payload of a packet with the fragment opCode:
+
+			flags (1 byte, bit 0: sequenced) | opCode (int32) | message id (uint16) | index (uint8) | count (uint8) | chunk
+
+		All integers are little endian. The chunks of a message concatenated are the length delimited RTData
+		of the message followed by its payload.
+	*/
+	class Fragmentation
+	{
+		public:
+			enum
+			{
+				HEADER_SIZE = 9,
+				MAX_FRAGMENTS = 255
+			};
+
+			/// the size of the message WriteMessage() writes, computed without serializing it
+			static int MessageSize(const RTData& data, const System::ArraySegment<System::Byte>& payload);
+
+			/// serializes data and payload into message, which is cleared first. data is serialized into scratch.
+			static System::Failable<void> WriteMessage(System::Bytes& message, const RTData& data, const System::ArraySegment<System::Byte>& payload,
+													   System::IO::MemoryStream& scratch);
+
+			/// the inverse of WriteMessage(). data is read from a copy of message in scratch.
+			static System::Failable<void> ReadMessage(const System::Bytes& message, RTData& data, System::Bytes& payload,
+													  BinaryWriteMemoryStream& scratch);
+
+			/// writes the fragment with the given index of message into fragment, which is cleared first
+			static void WriteFragment(System::Bytes& fragment, int opCode, bool sequenced, uint16_t messageId,
+									  int index, int count, const System::Bytes& message, int chunkSize);
+	};
+
+	/*!
+		Reassembles the fragments written by Fragmentation, per sender.
+
+		A message is only delivered, if all of its fragments arrived. Incomplete messages are dropped as a whole
+		after the timeout, or when a sender has more than the maximum number of incomplete messages.
+		The chunks of incomplete messages are allocated per message, unlike the buffers the session pools per packet.
+		Not thread safe.
+	*/
+	class FragmentReassembler
+	{
+		public:
+			FragmentReassembler(int maxMessageSize, int maxPendingMessagesPerSender, float timeoutSeconds);
+
+			/// adds a received fragment of sender. returns true, if it completed a message. opCode, data and payload are only set in that case.
+			System::Failable<bool> Add(int sender, const System::Bytes& fragment, int& opCode, RTData& data, System::Bytes& payload);
+
+			/// drops all incomplete messages of sender, e.g. because the peer disconnected
+			void Clear(int sender);
+
+			void SetMaxMessageSize(int bytes) { maxMessageSize = bytes; }
+
+		private:
+			struct Message
+			{
+				uint16_t id = 0;
+				int opCode = 0;
+				bool sequenced = false;
+				int received = 0;
+				int size = 0;
+				gsstl::vector<System::Bytes> chunks;
+				gsstl::chrono::steady_clock::time_point firstFragmentAt;
+			};
+
+			struct Sender
+			{
+				gsstl::list<Message> pending;
+				bool hasSequenced = false;
+				uint16_t lastSequenced = 0; // id of the last sequenced message delivered
+			};
+
+			void DropExpired(Sender& sender, const gsstl::chrono::steady_clock::time_point& now);
+
+			gsstl::map<int, Sender> senders;
+			System::Bytes complete; // the message completed last, reused
+			BinaryWriteMemoryStream stream; // reused by ReadMessage()
+			int maxMessageSize;
+			int maxPendingMessages;
+			gsstl::chrono::steady_clock::duration timeout;
+	};
+
+}}} /* namespace GameSparks.RT.Proto */
+
+#endif /* _GAMESPARKSRT_FRAGMENTATION_HPP_ */
@@ -0,0 +1,301 @@
+#include "./LZCodec.hpp"
+#include "./ProtocolBufferException.hpp"
+
+namespace GameSparks { namespace RT { namespace Proto {
+
+namespace
+{
+    const int HASH_SIZE = 1 << LZCodec::HASH_BITS;
+    const int LENGTH_MASK = 15;
+    const int MAX_LENGTH = 1 << 24; // far more than any realtime message, guards against overflows
+
+    inline uint32_t Read32(const System::Byte* p)
+    {
+        return uint32_t(p[0]) | (uint32_t(p[1]) << 8) | (uint32_t(p[2]) << 16) | (uint32_t(p[3]) << 24);
+    }
+
+    inline int Hash(const System::Byte* p)
+    {
+        return int((Read32(p) * 2654435761u) >> (32 - LZCodec::HASH_BITS));
+    }
+
+    inline void WriteLength(System::Bytes& output, int length)
+    {
+        for (; length >= 255; length -= 255)
+        {
+            output.push_back(255);
+        }
+        output.push_back(System::Byte(length));
+    }
+
+    inline void WriteSequence(System::Bytes& output, const System::Byte* literals, int literalCount, int offset, int matchLength)
+    {
+        const int matchCode = matchLength - LZCodec::MIN_MATCH;
+        output.push_back(System::Byte(((literalCount < LENGTH_MASK ? literalCount : LENGTH_MASK) << 4) |
+                                      (matchLength == 0 ? 0 : (matchCode < LENGTH_MASK ? matchCode : LENGTH_MASK))));
+        if (literalCount >= LENGTH_MASK)
+        {
+            WriteLength(output, literalCount - LENGTH_MASK);
+        }
+        output.insert(output.end(), literals, literals + literalCount);
+
+        if (matchLength == 0)
+        {
+            return; // the last sequence
+        }
+
+        output.push_back(System::Byte(offset));
+        output.push_back(System::Byte(offset >> 8));
+        if (matchCode >= LENGTH_MASK)
+        {
+            WriteLength(output, matchCode - LENGTH_MASK);
+        }
+    }
+
+    inline bool ReadLength(const System::Byte*& in, const System::Byte* end, int& length)
+    {
+        System::Byte b;
+        do
+        {
+            if (in == end || length > MAX_LENGTH)
+            {
+                return false;
+            }
+            b = *in++;
+            length += b;
+        } while (b == 255);
+        return true;
+    }
+}
+
+LZCodec::LZCodec(const System::Bytes& dictionary_)
+:dictionary(dictionary_.size() > size_t(MAX_OFFSET) ? System::Bytes(dictionary_.end() - MAX_OFFSET, dictionary_.end()) : dictionary_)
+,dictionaryTable(HASH_SIZE, -1)
+{
+    for (int pos = 0; pos + MIN_MATCH <= int(dictionary.size()); ++pos)
+    {
+        dictionaryTable[Hash(&dictionary[pos])] = pos;
+    }
+}
+
+void LZCodec::Compress(const System::Byte* input, int size, System::Bytes& output)
+{
+    const int dictionarySize = int(dictionary.size());
+    window.assign(dictionary.begin(), dictionary.end());
+    window.insert(window.end(), input, input + size);
+    table = dictionaryTable;
+
+    const System::Byte* base = window.data();
+    const int end = int(window.size());
+    int anchor = dictionarySize;
+    int pos = dictionarySize;
+
+    while (pos + MIN_MATCH <= end)
+    {
+        const int h = Hash(base + pos);
+        const int candidate = table[h];
+        table[h] = pos;
+
+        if (candidate < 0 || pos - candidate > MAX_OFFSET || Read32(base + candidate) != Read32(base + pos))
+        {
+            ++pos;
+            continue;
+        }
+
+        int length = MIN_MATCH;
+        while (pos + length < end && base[candidate + length] == base[pos + length])
+        {
+            ++length;
+        }
+
+        WriteSequence(output, base + anchor, pos - anchor, pos - candidate, length);
+
+        // index the positions covered by the match, so that later repetitions find them
+        const int matchEnd = pos + length;
+        for (++pos; pos < matchEnd && pos + MIN_MATCH <= end; ++pos)
+        {
+            table[Hash(base + pos)] = pos;
+        }
+        pos = matchEnd;
+        anchor = pos;
+    }
+
+    if (anchor < end || size == 0)
+    {
+        WriteSequence(output, base + anchor, end - anchor, 0, 0);
+    }
+}
+
+System::Failable<void> LZCodec::Decompress(const System::Byte* input, int size, int decompressedSize, System::Bytes& output) const
+{
+    if (decompressedSize < 0)
+    {
+        GS_THROW(ProtocolBufferException("invalid decompressed size"));
+    }
+
+    const int dictionarySize = int(dictionary.size());
+    const int outputEnd = dictionarySize + decompressedSize;
+
+    output.resize(outputEnd);
+    gsstl::copy(dictionary.begin(), dictionary.end(), output.begin());
+    int out = dictionarySize;
+
+    const System::Byte* in = input;
+    const System::Byte* end = input + size;
+    while (in != end)
+    {
+        const int token = *in++;
+
+        int literalCount = token >> 4;
+        if (literalCount == LENGTH_MASK && !ReadLength(in, end, literalCount))
+        {
+            GS_THROW(ProtocolBufferException("truncated compressed data"));
+        }
+        if (literalCount > end - in || literalCount > outputEnd - out)
+        {
+            GS_THROW(ProtocolBufferException("malformed compressed data"));
+        }
+        gsstl::copy(in, in + literalCount, output.begin() + out);
+        in += literalCount;
+        out += literalCount;
+
+        if (in == end)
+        {
+            break; // the last sequence has no match
+        }
+
+        if (end - in < 2)
+        {
+            GS_THROW(ProtocolBufferException("truncated compressed data"));
+        }
+        const int offset = int(in[0]) | (int(in[1]) << 8);
+        in += 2;
+
+        int length = token & LENGTH_MASK;
+        if (length == LENGTH_MASK && !ReadLength(in, end, length))
+        {
+            GS_THROW(ProtocolBufferException("truncated compressed data"));
+        }
+        length += MIN_MATCH;
+
+        if (offset == 0 || offset > out || length > outputEnd - out)
+        {
+            GS_THROW(ProtocolBufferException("malformed compressed data"));
+        }
+
+        // byte by byte, the match may overlap the bytes it produces
+        for (int from = out - offset; length != 0; --length)
+        {
+            output[out++] = output[from++];
+        }
+    }
+
+    if (out != outputEnd)
+    {
+        GS_THROW(ProtocolBufferException("compressed data does not match its size"));
+    }
+
+    output.erase(output.begin(), output.begin() + dictionarySize);
+    return {};
+}
+
+System::Bytes LZCodec::TrainDictionary(const gsstl::vector<System::Bytes>& samples, int maxSize)
+{
+    // counts the 8 byte sequences of the samples. the most frequent ones are grown to the longest run of frequent
+    // neighbours and copied into the dictionary, the most frequent last, where their offsets are smallest.
+    const int SEGMENT = 8;
+
+    struct Occurrence
+    {
+        int count = 0;
+        int sample = 0;
+        int pos = 0;
+        bool used = false;
+    };
+
+    auto key = [](const System::Byte* p) {
+        return uint64_t(Read32(p)) | (uint64_t(Read32(p + 4)) << 32);
+    };
+
+    gsstl::map<uint64_t, Occurrence> occurrences;
+    for (int sample = 0; sample != int(samples.size()); ++sample)
+    {
+        const System::Bytes& bytes = samples[sample];
+        for (int pos = 0; pos + SEGMENT <= int(bytes.size()); ++pos)
+        {
+            Occurrence& occurrence = occurrences[key(&bytes[pos])];
+            if (occurrence.count++ == 0)
+            {
+                occurrence.sample = sample;
+                occurrence.pos = pos;
+            }
+        }
+    }
+
+    gsstl::vector<gsstl::pair<int, uint64_t> > ranked;
+    for (auto& occurrence : occurrences)
+    {
+        if (occurrence.second.count > 1)
+        {
+            ranked.push_back(gsstl::pair<int, uint64_t>(-occurrence.second.count, occurrence.first));
+        }
+    }
+    gsstl::sort(ranked.begin(), ranked.end());
+
+    if (maxSize > MAX_OFFSET)
+    {
+        maxSize = MAX_OFFSET;
+    }
+
+    gsstl::vector<System::Bytes> segments;
+    int size = 0;
+    for (size_t i = 0; i != ranked.size() && size < maxSize; ++i)
+    {
+        Occurrence& best = occurrences[ranked[i].second];
+        if (best.used)
+        {
+            continue;
+        }
+
+        const System::Bytes& bytes = samples[best.sample];
+        const int threshold = best.count / 2 > 1 ? best.count / 2 : 2;
+        auto frequent = [&](int pos) {
+            if (pos < 0 || pos + SEGMENT > int(bytes.size()))
+            {
+                return false;
+            }
+            const Occurrence& occurrence = occurrences[key(&bytes[pos])];
+            return !occurrence.used && occurrence.count >= threshold;
+        };
+
+        int first = best.pos;
+        int last = best.pos;
+        while (frequent(first - 1) && (last - first + 1) + SEGMENT <= maxSize - size)
+        {
+            --first;
+        }
+        while (frequent(last + 1) && (last - first + 1) + SEGMENT <= maxSize - size)
+        {
+            ++last;
+        }
+
+        for (int pos = first; pos <= last; ++pos)
+        {
+            occurrences[key(&bytes[pos])].used = true;
+        }
+
+        const int length = gsstl::min(last - first + SEGMENT, maxSize - size);
+        segments.push_back(System::Bytes(bytes.begin() + first, bytes.begin() + first + length));
+        size += length;
+    }
+
+    System::Bytes dictionary;
+    dictionary.reserve(size);
+    for (auto segment = segments.rbegin(); segment != segments.rend(); ++segment)
+    {
+        dictionary.insert(dictionary.end(), segment->begin(), segment->end());
+    }
+    return dictionary;
+}
+
+}}} /* namespace GameSparks.RT.Proto */
@@ -48,6 +48,10 @@ namespace GameSparks { namespace RT { namespace Proto {
 			bool hasPayload = false;
 			System::Failable<void> WritePayload (System::IO::Stream& stream) const;
 
+			/// upper bound of the bytes a packet sent to targetPlayers adds around its data and payload: the length of the
+			/// packet, its scalar fields, the packed target players and the keys and lengths of data and payload
+			static int MaxOverhead(int targetPlayers) { return 32 + 6 * targetPlayers; }
+
 			//serializer
 			static System::Failable<void> DeserializeLengthDelimited(System::IO::Stream& stream, System::IO::BinaryReader& br, Packet& instance);
 			static System::Failable<void> Serialize(System::IO::Stream& stream, const Packet& instance);
@@ -99,68 +99,80 @@ System::Failable<void> RTValSerializer::ReadRTVal (System::IO::Stream& stream, S
 }
 
 
+int RTValSerializer::NumberOfFloatsSet (const RTVector& vec)
+{
+    /*!
+     * You need to set x, xy, xyz or xyzw. You cannot leave dimensions of the vector blank.
+     * For example you cannot only set y and leave the rest unset.
+     * */
+    assert(
+        ((vec.x.HasValue() && vec.y.HasValue() && vec.z.HasValue() && vec.w.HasValue()) ||
+        (vec.x.HasValue() && vec.y.HasValue() && vec.z.HasValue()) ||
+        (vec.x.HasValue() && vec.y.HasValue()) ||
+        (vec.x.HasValue())) && "RTVector cannot be sparse."
+    );
+
+    return vec.w.HasValue() ? 4 : (vec.z.HasValue() ? 3 : (vec.y.HasValue() ? 2 : (vec.x.HasValue() ? 1 : 0)));
+}
+
+
+int RTValSerializer::SizeOf (const RTVal& val)
+{
+    int size = 0;
+    if (val.string_val.HasValue())
+    {
+        size = int(val.string_val.Value().size());
+    }
+    else if (val.data_val.HasValue())
+    {
+        size = RTDataSerializer::SizeOf(val.data_val.Value());
+    }
+    else if (val.vec_val.HasValue())
+    {
+        size = 4 * NumberOfFloatsSet(val.vec_val.Value());
+    }
+    else
+    {
+        return 0;
+    }
+    // key and length
+    return 1 + Varint::SizeOf((uint)size) + size;
+}
+
+
 System::Failable<void> RTValSerializer::WriteRTVal (System::IO::Stream& stream, const RTVal& val)
 {
-    BinaryWriteMemoryStream ms;
+    // the size is computed up front, so that the value is written straight to stream instead of a temporary stream
+    GS_CALL_OR_THROW(::GameSparks::RT::Proto::ProtocolParser::WriteUInt32(stream, (uint)SizeOf(val)));
+
     if (val.string_val.HasValue())
     {
         // Key for field: 1, LengthDelimited
-        GS_CALL_OR_THROW(ms.WriteByte(10));
-        GS_CALL_OR_THROW(::GameSparks::RT::Proto::ProtocolParser::WriteBytes(ms, System::Text::Encoding::UTF8::GetBytes(val.string_val.Value())));
+        GS_CALL_OR_THROW(stream.WriteByte(10));
+        GS_CALL_OR_THROW(::GameSparks::RT::Proto::ProtocolParser::WriteString(stream, val.string_val.Value()));
     }
     else if(val.data_val.HasValue())
     {
-        GS_CALL_OR_THROW(ms.WriteByte(114));
-        GS_CALL_OR_THROW(RTData::WriteRTData(ms, val.data_val.Value()));
+        GS_CALL_OR_THROW(stream.WriteByte(114));
+        GS_CALL_OR_THROW(RTData::WriteRTData(stream, val.data_val.Value()));
     }
     else if (val.vec_val.HasValue())
     {
-
-        RTVector vec_value = val.vec_val.Value();
-        // Key for field: 2, LengthDelimited
-        GS_CALL_OR_THROW(ms.WriteByte(18));
-
-        /*!
-         * You need to set x, xy, xyz or xyzw. You cannot leave dimensions of the vector blank.
-         * For example you cannot only set y and leave the rest unset.
-         * */
-        assert(
-            ((vec_value.x.HasValue() && vec_value.y.HasValue() && vec_value.z.HasValue() && vec_value.w.HasValue()) ||
-            (vec_value.x.HasValue() && vec_value.y.HasValue() && vec_value.z.HasValue()) ||
-            (vec_value.x.HasValue() && vec_value.y.HasValue()) ||
-            (vec_value.x.HasValue())) && "RTVector cannot be sparse."
-        );
-
-        int numberOfFloatsSet = vec_value.w.HasValue() ? 4 : (vec_value.z.HasValue() ? 3 : (vec_value.y.HasValue() ? 2 : (vec_value.x.HasValue() ? 1 : 0)));
-        GS_CALL_OR_THROW(::GameSparks::RT::Proto::ProtocolParser::WriteUInt32(ms, 4u * (uint)numberOfFloatsSet));
-
-        for(int i=0 ; i<numberOfFloatsSet ; i++)
-        {
-            switch (i)
+        const RTVector& vec_value = val.vec_val.Value();
+        const int numberOfFloatsSet = NumberOfFloatsSet(vec_value);
+        const System::Nullable<float>* floats[] = { &vec_value.x, &vec_value.y, &vec_value.z, &vec_value.w };
+
+        GS_CALL_OR_THROW(ProtocolParser::WriteEncoded(stream, 1 + Varint::MAX_VARINT32_SIZE + 16, [&](Varint::byte*& pos, Varint::byte* end) -> bool {
+            // Key for field: 2, LengthDelimited
+            bool ok = Varint::WriteKey(pos, end, 2, int(Wire::LengthDelimited)) && Varint::WriteUInt32(pos, end, 4u * (uint)numberOfFloatsSet);
+            for (int i = 0; i < numberOfFloatsSet; i++)
             {
-                case 0:
-                    GS_CALL_OR_THROW(ms.BinaryWriter.Write(vec_value.x.Value()));
-                    break;
-                case 1:
-                    GS_CALL_OR_THROW(ms.BinaryWriter.Write(vec_value.y.Value()));
-                    break;
-                case 2:
-                    GS_CALL_OR_THROW(ms.BinaryWriter.Write(vec_value.z.Value()));
-                    break;
-                case 3:
-                    GS_CALL_OR_THROW(ms.BinaryWriter.Write(vec_value.w.Value()));
-                    break;
-                default:
-                    break;
+                ok = ok && Varint::WriteFloat(pos, end, floats[i]->Value());
             }
-        }
-
+            return ok;
+        }));
     }
 
-    auto data = ms.GetBuffer();
-    GS_CALL_OR_THROW(::GameSparks::RT::Proto::ProtocolParser::WriteUInt32(stream, (uint)ms.Position()));
-    GS_CALL_OR_THROW(stream.Write(data, 0, (int)ms.Position()));
-
     return {};
 }
 
@@ -235,38 +247,53 @@ System::Failable<void> RTDataSerializer::ReadRTData(System::IO::Stream& stream,
 }
 
 
-System::Failable<void> RTDataSerializer::WriteRTData(System::IO::Stream& stream, const RTData& instance)
+int RTDataSerializer::SizeOf(const RTData& instance)
 {
-    BinaryWriteMemoryStream ms;
-
+    int size = 0;
     for (ProtocolParser::uint index = 1; index < ProtocolParser::uint(instance.data.size()); index++) {
 
-        RTVal entry = instance.data [index];
+        const RTVal& entry = instance.data [index];
 
         if (entry.long_val.HasValue()) {
-            GS_CALL_OR_THROW(ProtocolParser::WriteUInt32 (ms, index << 3));
-            //ms.WriteByte ((byte)(index << 3));
-            GS_CALL_OR_THROW(ProtocolParser::WriteZInt64 (ms, (int64_t)entry.long_val.Value()));
+            size += Varint::SizeOf(index << 3) + Varint::SizeOf(Varint::EncodeZigZag64((int64_t)entry.long_val.Value()));
         } else if (entry.double_val.HasValue()) {
-            GS_CALL_OR_THROW(ProtocolParser::WriteUInt32 (ms, (index << 3) | ((uint)1)));
-            //ms.WriteByte ((byte)((index << 3) + 1));
-            GS_CALL_OR_THROW(ms.BinaryWriter.Write ((double)entry.double_val.Value()));
+            size += Varint::SizeOf((index << 3) | ((uint)1)) + 8;
         } else if (entry.float_val.HasValue()) {
-            GS_CALL_OR_THROW(ProtocolParser::WriteUInt32 (ms, (index << 3) | ((uint)5)));
-            //ms.WriteByte ((byte)((index << 3) + 5));
-            GS_CALL_OR_THROW(ms.BinaryWriter.Write ((float)entry.float_val.Value()));
-
+            size += Varint::SizeOf((index << 3) | ((uint)5)) + 4;
         } else if (entry.data_val.HasValue() || entry.string_val.HasValue() || entry.vec_val.HasValue()) {
-            GS_CALL_OR_THROW(ProtocolParser::WriteUInt32 (ms, (index << 3) | ((uint)2)));
-            //ms.WriteByte ((byte)((index << 3) + 2));
-            GS_CALL_OR_THROW(entry.SerializeLengthDelimited (ms));
+            const int valueSize = RTValSerializer::SizeOf(entry);
+            size += Varint::SizeOf((index << 3) | ((uint)2)) + Varint::SizeOf((uint)valueSize) + valueSize;
         }
     }
+    return size;
+}
 
-    auto buffer = ms.GetBuffer();
 
-    GS_CALL_OR_THROW(::GameSparks::RT::Proto::ProtocolParser::WriteUInt32(stream, (uint)ms.Position()));
-    GS_CALL_OR_THROW(stream.Write(buffer, 0, (int)ms.Position()));
+System::Failable<void> RTDataSerializer::WriteRTData(System::IO::Stream& stream, const RTData& instance)
+{
+    // the size is computed up front, so that the entries are written straight to stream instead of a temporary stream
+    GS_CALL_OR_THROW(::GameSparks::RT::Proto::ProtocolParser::WriteUInt32(stream, (uint)SizeOf(instance)));
+
+    for (ProtocolParser::uint index = 1; index < ProtocolParser::uint(instance.data.size()); index++) {
+
+        const RTVal& entry = instance.data [index];
+
+        if (entry.long_val.HasValue() || entry.double_val.HasValue() || entry.float_val.HasValue()) {
+            // key and value of the scalars are encoded in one go
+            GS_CALL_OR_THROW(ProtocolParser::WriteEncoded(stream, Varint::MAX_VARINT32_SIZE + Varint::MAX_VARINT64_SIZE, [&](Varint::byte*& pos, Varint::byte* end) -> bool {
+                if (entry.long_val.HasValue()) {
+                    return Varint::WriteKey(pos, end, index, int(Wire::Varint)) && Varint::WriteZInt64(pos, end, (int64_t)entry.long_val.Value());
+                } else if (entry.double_val.HasValue()) {
+                    return Varint::WriteKey(pos, end, index, int(Wire::Fixed64)) && Varint::WriteDouble(pos, end, (double)entry.double_val.Value());
+                } else {
+                    return Varint::WriteKey(pos, end, index, int(Wire::Fixed32)) && Varint::WriteFloat(pos, end, (float)entry.float_val.Value());
+                }
+            }));
+        } else if (entry.data_val.HasValue() || entry.string_val.HasValue() || entry.vec_val.HasValue()) {
+            GS_CALL_OR_THROW(ProtocolParser::WriteUInt32 (stream, (index << 3) | ((uint)2)));
+            GS_CALL_OR_THROW(entry.SerializeLengthDelimited (stream));
+        }
+    }
 
     return {};
 }
@@ -11,7 +11,10 @@ namespace GameSparks { namespace RT { namespace Proto {
 		public:
 			static System::Failable<void> ReadRTVal (System::IO::Stream& stream, System::IO::BinaryReader& br, RTVal& instance);
 			static System::Failable<void> WriteRTVal (System::IO::Stream& stream, const RTVal& instance);
+			/// the number of bytes WriteRTVal() writes after the length
+			static int SizeOf (const RTVal& instance);
 		private:
+			static int NumberOfFloatsSet (const RTVector& vec);
 	};
 
 	class RTDataSerializer
@@ -19,6 +22,8 @@ namespace GameSparks { namespace RT { namespace Proto {
 		public:
 			static System::Failable<void> ReadRTData (System::IO::Stream& stream, System::IO::BinaryReader& br, RTData& instance);
 			static System::Failable<void> WriteRTData (System::IO::Stream& stream, const RTData& instance);
+			/// the number of bytes WriteRTData() writes after the length
+			static int SizeOf (const RTData& instance);
 		private:
 	};
 
@@ -0,0 +1,260 @@
+#include "./RTDataDelta.hpp"
+#include "./ProtocolBufferException.hpp"
+
+#include <cassert>
+
+namespace GameSparks { namespace RT { namespace Proto {
+
+namespace
+{
+    // a baseline that unreliable deltas refer to, but that did not arrive reliably within this time, is requested explicitly
+    const gsstl::chrono::seconds MISSING_BASELINE_GRACE(1);
+
+    // minimum time between two resync requests for the same baseline
+    const gsstl::chrono::seconds RESYNC_REQUEST_INTERVAL(1);
+}
+
+void RTDataDelta::WriteHeader(System::Bytes& bytes, const Header& header)
+{
+    assert(header.removed.size() < 256);
+
+    bytes.resize(8 + header.removed.size());
+    bytes[0] = System::Byte(header.kind);
+    bytes[1] = System::Byte(header.opCode);
+    bytes[2] = System::Byte(header.opCode >> 8);
+    bytes[3] = System::Byte(header.opCode >> 16);
+    bytes[4] = System::Byte(header.opCode >> 24);
+    bytes[5] = System::Byte(header.baselineId);
+    bytes[6] = System::Byte(header.baselineId >> 8);
+    bytes[7] = System::Byte(header.removed.size());
+    gsstl::copy(header.removed.begin(), header.removed.end(), bytes.begin() + 8);
+}
+
+System::Failable<void> RTDataDelta::ReadHeader(const System::Bytes& bytes, Header& header)
+{
+    if (bytes.size() < 8 || bytes.size() != size_t(8 + bytes[7]) || bytes[0] > BASELINE)
+    {
+        GS_THROW(ProtocolBufferException("malformed delta header"));
+    }
+
+    header.kind = Kind(bytes[0]);
+    header.opCode = int(uint32_t(bytes[1]) | (uint32_t(bytes[2]) << 8) | (uint32_t(bytes[3]) << 16) | (uint32_t(bytes[4]) << 24));
+    header.baselineId = uint16_t(bytes[5] | (bytes[6] << 8));
+    header.removed.assign(bytes.begin() + 8, bytes.end());
+
+    for (auto index : header.removed)
+    {
+        if (index >= GameSparksRT::MAX_RTDATA_SLOTS)
+        {
+            GS_THROW(ProtocolBufferException("invalid removed slot"));
+        }
+    }
+    return {};
+}
+
+int RTDataDelta::Diff(const RTData& baseline, const RTData& current, RTData& changed, gsstl::vector<System::Byte>& removed)
+{
+    int changes = 0;
+    for (int i = 0; i != GameSparksRT::MAX_RTDATA_SLOTS; ++i)
+    {
+        const RTVal& before = baseline.data[i];
+        const RTVal& after = current.data[i];
+        if (after)
+        {
+            if (after != before)
+            {
+                changed.data[i] = after;
+                ++changes;
+            }
+        }
+        else if (before)
+        {
+            removed.push_back(System::Byte(i));
+            ++changes;
+        }
+    }
+    return changes;
+}
+
+void RTDataDelta::Apply(RTData& baseline, const RTData& changed, const gsstl::vector<System::Byte>& removed)
+{
+    for (int i = 0; i != GameSparksRT::MAX_RTDATA_SLOTS; ++i)
+    {
+        if (changed.data[i])
+        {
+            baseline.data[i] = changed.data[i];
+        }
+    }
+
+    for (auto index : removed)
+    {
+        baseline.data[index] = RTVal();
+    }
+}
+
+int RTDataDelta::CountSlots(const RTData& data)
+{
+    int count = 0;
+    for (const auto& val : data.data)
+    {
+        if (val)
+        {
+            ++count;
+        }
+    }
+    return count;
+}
+
+DeltaEncoder::Mode DeltaEncoder::Encode(int opCode, bool reliable, const RTData& data, RTDataDelta::Header& header, RTData& slots)
+{
+    header.opCode = opCode;
+    header.removed.clear();
+
+    auto pos = baselines.find(opCode);
+    if (pos == baselines.end() || pos->second.needsKeyframe || (!reliable && pos->second.unreliableSends >= keyframeInterval))
+    {
+        Baseline& baseline = baselines[opCode];
+        if (pos != baselines.end())
+        {
+            ++baseline.id;
+        }
+        baseline.data = data;
+        baseline.unreliableSends = 0;
+        baseline.needsKeyframe = false;
+
+        header.kind = RTDataDelta::KEYFRAME;
+        header.baselineId = baseline.id;
+        slots = data;
+        return SEND_KEYFRAME;
+    }
+
+    Baseline& baseline = pos->second;
+    slots = RTData();
+    const int changes = RTDataDelta::Diff(baseline.data, data, slots, header.removed);
+    if (changes >= RTDataDelta::CountSlots(data) && header.removed.empty())
+    {
+        // every slot changed, the delta would only add the header. the baseline stays as it is.
+        return SEND_PLAIN;
+    }
+
+    header.baselineId = baseline.id;
+    if (reliable)
+    {
+        header.kind = RTDataDelta::DELTA_ADVANCE;
+        ++baseline.id;
+        baseline.data = data;
+        baseline.unreliableSends = 0;
+    }
+    else
+    {
+        header.kind = RTDataDelta::DELTA;
+        ++baseline.unreliableSends;
+    }
+    return SEND_DELTA;
+}
+
+bool DeltaEncoder::GetBaseline(int opCode, RTDataDelta::Header& header, RTData& slots) const
+{
+    auto pos = baselines.find(opCode);
+    if (pos == baselines.end())
+    {
+        return false;
+    }
+
+    header.kind = RTDataDelta::BASELINE;
+    header.opCode = opCode;
+    header.baselineId = pos->second.id;
+    header.removed.clear();
+    slots = pos->second.data;
+    return true;
+}
+
+void DeltaEncoder::Reset()
+{
+    // the ids keep counting, so that receivers can still tell older deltas from newer ones
+    for (auto& baseline : baselines)
+    {
+        baseline.second.needsKeyframe = true;
+    }
+}
+
+DeltaDecoder::Result DeltaDecoder::Decode(int sender, const RTDataDelta::Header& header, const RTData& slots, RTData& data,
+                                          const gsstl::chrono::steady_clock::time_point& now)
+{
+    Baseline& baseline = baselines[gsstl::pair<int, int>(sender, header.opCode)];
+
+    switch (header.kind)
+    {
+        case RTDataDelta::KEYFRAME:
+        case RTDataDelta::BASELINE:
+            baseline.valid = true;
+            baseline.id = header.baselineId;
+            baseline.data = slots;
+            baseline.missing = false;
+            baseline.requested = false;
+            data = slots;
+            return DELIVER;
+
+        case RTDataDelta::DELTA:
+            if (!baseline.valid)
+            {
+                return RequestResync(baseline, now);
+            }
+            if (baseline.id != header.baselineId)
+            {
+                if (int16_t(header.baselineId - baseline.id) < 0)
+                {
+                    return DROP; // sent before the current baseline
+                }
+
+                // the keyframe is on its way over the reliable connection, unless it was not sent to us
+                if (!baseline.missing)
+                {
+                    baseline.missing = true;
+                    baseline.missingSince = now;
+                }
+                return now - baseline.missingSince > MISSING_BASELINE_GRACE ? RequestResync(baseline, now) : DROP;
+            }
+            data = baseline.data;
+            RTDataDelta::Apply(data, slots, header.removed);
+            return DELIVER;
+
+        case RTDataDelta::DELTA_ADVANCE:
+            if (!baseline.valid || baseline.id != header.baselineId)
+            {
+                return RequestResync(baseline, now);
+            }
+            RTDataDelta::Apply(baseline.data, slots, header.removed);
+            ++baseline.id;
+            baseline.missing = false;
+            data = baseline.data;
+            return DELIVER;
+
+        default:
+            return DROP;
+    }
+}
+
+DeltaDecoder::Result DeltaDecoder::RequestResync(Baseline& baseline, const gsstl::chrono::steady_clock::time_point& now)
+{
+    if (baseline.requested && now - baseline.requestedAt < RESYNC_REQUEST_INTERVAL)
+    {
+        return DROP;
+    }
+    baseline.requested = true;
+    baseline.requestedAt = now;
+    return RESYNC;
+}
+
+void DeltaDecoder::Clear(int sender)
+{
+    for (auto it = baselines.begin(); it != baselines.end(); )
+    {
+        if (it->first.first == sender)
+            it = baselines.erase(it);
+        else
+            ++it;
+    }
+}
+
+}}} /* namespace GameSparks.RT.Proto */
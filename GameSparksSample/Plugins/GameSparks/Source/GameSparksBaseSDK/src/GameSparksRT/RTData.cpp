@@ -113,6 +113,15 @@ RTData &RTData::SetData(uint index, const RTData &value) {
     return *this;
 }
 
+bool RTData::operator==(const RTData &o) const {
+    for (uint i = 0; i != GameSparksRT::MAX_RTDATA_SLOTS; ++i) {
+        if (data[i] != o.data[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
 gsstl::ostream& operator << (gsstl::ostream& os, const RTVector& p)
 {
     os << "(";
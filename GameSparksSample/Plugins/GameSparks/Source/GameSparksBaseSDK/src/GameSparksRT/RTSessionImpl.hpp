@@ -9,6 +9,12 @@
 #include "../../include/GameSparksRT/Forwards.hpp"
 #include "./IRTSessionInternal.hpp"
 #include "./IRTCommand.hpp"
+#include "./Proto/Fragmentation.hpp"
+#include "./Proto/LZCodec.hpp"
+#include "./Proto/RTDataDelta.hpp"
+#include "./PeerSequenceTable.hpp"
+#include "./Pools/ObjectPool.hpp"
+#include "./Commands/CustomCommand.hpp"
 
 #if defined(_DURANGO)
 #	define GS_RT_OVER_WS   1
@@ -38,9 +44,17 @@ namespace GameSparks { namespace RT {
 										   const System::ArraySegment<System::Byte> &payload, const RTData &data,
 										   const gsstl::vector<int> &targetPlayers) override;
 
+			virtual int SendCompressed(int opCode, GameSparksRT::DeliveryIntent intent,
+									   const System::ArraySegment<System::Byte> &payload, const RTData &data,
+									   const gsstl::vector<int> &targetPlayers) override;
+
+			virtual int SendDelta(int opCode, GameSparksRT::DeliveryIntent intent, const RTData &data,
+								  const gsstl::vector<int> &targetPlayers) override;
+
     		virtual void Stop() override;
 			virtual void Start() override;
 			virtual void Update() override;
+			virtual bool HasPendingWork() override;
 			virtual gsstl::string ConnectToken() const override;
 			virtual void ConnectToken(const gsstl::string& token) override;
 			virtual gsstl::string FastPort() const override;
@@ -49,7 +63,7 @@ namespace GameSparks { namespace RT {
 			virtual void ConnectReliable() override;
 			virtual void ConnectFast() override;
 			virtual bool ShouldExecute(int peerId, System::Nullable<int> sequence) override;
-			virtual void SubmitAction(gsstl::unique_ptr<IRTCommand>& action) override;
+			virtual void SubmitAction(gsstl::unique_ptr<IRTCommand>& action, bool sequenced = false) override;
 			virtual int NextSequenceNumber() override;
 			virtual void OnPlayerConnect(int peerId) override;
 			virtual void OnPlayerDisconnect(int peerId) override;
@@ -60,16 +74,91 @@ namespace GameSparks { namespace RT {
 			virtual GameSparksRT::ConnectState GetConnectState() const override;
 			virtual void SetConnectState(GameSparksRT::ConnectState value) override;
 
+			virtual Core::IGSProfiler* GetProfiler() const override { return profiler; }
+			void SetProfiler(Core::IGSProfiler* profiler_) { profiler = profiler_; }
+			void SetReliableFlushPolicy(int threshold, const gsstl::vector<int>& immediateOpCodes);
+			void SetMaxDatagramSize(int bytes) { maxDatagramSize = bytes; }
+			void SetUpdateBudget(int maxMessages, int maxMilliseconds, bool collapseSequenced);
+			void SetFragmentation(int opCode, int maxMessageSize);
+
+			virtual int FragmentOpCode() const override { return fragmentOpCode; }
+			virtual System::Failable<IRTCommand*> OnFragmentReceived(int sender, System::IO::Stream& stream, int limit) override;
+
+			void SetCompression(int opCode, const System::Bytes& dictionary, int maxMessageSize);
+			virtual int CompressionOpCode() const override { return compressionOpCode; }
+			virtual System::Failable<IRTCommand*> OnCompressedReceived(int sender, System::IO::Stream& stream, int limit) override;
+
+			void SetDeltaEncoding(int opCode, int keyframeInterval);
+			virtual int DeltaOpCode() const override { return deltaOpCode; }
+			virtual System::Failable<IRTCommand*> OnDeltaReceived(int sender, System::IO::Stream& stream, int limit, const RTData& data) override;
+
+			virtual void OnFastDatagramSent(int packets) override;
+			virtual long long GetUnreliablePacketsSent() const override;
+			virtual long long GetUnreliableDatagramsSent() const override;
+			virtual bool GetPeerStats(int peerId, RTPeerStats& stats) const override;
+			virtual long long GetPoolAllocations() const override;
+
+			virtual gsstl::unique_ptr<CustomCommand> PopCustomCommand() override;
+			virtual void OnPayloadAllocated() override;
+			virtual Pools::ObjectPool<System::IO::MemoryStream>* ScratchStreams() override { return &scratchStreams; }
+
 	private:
 			virtual void DoLog(const gsstl::string &tag, GameSparks::RT::GameSparksRT::LogLevel level, const gsstl::string &msg) override;
 			void ResetSequenceForPeer (int peerId);
 			void CheckConnection();
 			gsstl::unique_ptr<IRTCommand> GetNextAction();
+			gsstl::unique_ptr<IRTCommand> GetNextMessage();
+			/// removes the queued messages of peerId, called with actionQueueMutex held
+			void DropQueuedMessages(int peerId);
+			/// returns a CustomCommand to its pool, deletes other commands
+			void Recycle(gsstl::unique_ptr<IRTCommand> command);
+			bool ShouldFlushImmediately(int opCode) const;
+			// messageOpCode is the opCode passed by the caller, opCode differs from it for compressed messages
+			int SendPacket(int opCode, GameSparksRT::DeliveryIntent intent,
+						   const System::ArraySegment<System::Byte> &payload, const RTData &data,
+						   const gsstl::vector<int> &targetPlayers, int messageOpCode);
+			System::Failable<bool> Compress(int opCode, const System::ArraySegment<System::Byte> &payload, const RTData &data);
+			System::Failable<IRTCommand*> Decompress(int sender, const System::Bytes& message);
+			System::Failable<IRTCommand*> DecodeDelta(int sender, const System::Bytes& header, const RTData& slots);
+			void SendDeltaControl(int peerId, const Proto::RTDataDelta::Header& header, const RTData& slots);
+			System::Failable<IRTCommand*> CreateCustomCommand(int opCode, int sender, const RTData& data, const System::Bytes& payload);
+			#if !GS_RT_OVER_WS
+			/// returns the bytes sent in fragments, 0 if the message fits into a single datagram, -1 if it is too large
+			System::Failable<int> SendFragmented(int opCode, GameSparksRT::DeliveryIntent intent,
+												 const System::ArraySegment<System::Byte> &payload, const RTData &data,
+												 const gsstl::vector<int> &targetPlayers);
+			#endif
 
-			// note: it's important, that those two are the first members so that they are created first and destroyed last.
+			struct QueuedMessage
+			{
+				gsstl::unique_ptr<IRTCommand> command;
+				bool newest; // the entry of newestSequencedMessages points here
+			};
+			typedef gsstl::list<QueuedMessage> MessageQueue;
+
+			// note: it's important, that those are the first members so that they are created first and destroyed last.
+			// the pools hand out the objects needed per packet, so that steady traffic does not allocate.
+			Pools::ObjectPool<CustomCommand> customCommandPool {256, [this]() { return new CustomCommand(*this); }};
+			Pools::ObjectPool<System::IO::MemoryStream> scratchStreams {16};
+			Pools::ObjectPool<BinaryWriteMemoryStream> readStreams {16};
+			Pools::ObjectPool<System::Bytes> scratchBytes {16}; // the received fragments, compressed and delta messages
+
+			// commands are deserialized on the threads of both connections
+			mutable gsstl::mutex payloadAllocationsMutex;
+			long long payloadAllocations = 0; // guarded by payloadAllocationsMutex
+
+			// with an update budget, commands that drive the connection state go to actionQueue, messages for the listener
+			// to messageQueue. without one, everything goes to messageQueue. both are guarded by actionQueueMutex.
 			gsstl::queue<gsstl::unique_ptr<IRTCommand>> actionQueue;
+			MessageQueue messageQueue;
+			MessageQueue freeMessageNodes; // popped nodes of messageQueue, for reuse
+			gsstl::map<gsstl::pair<int, int>, MessageQueue::iterator> newestSequencedMessages; // by sender and opCode
 			gsstl::mutex actionQueueMutex;
 
+			int maxMessagesPerUpdate = 0;
+			int maxMillisecondsPerUpdate = 0;
+			bool collapseSequencedMessages = false;
+
 			#if GS_RT_OVER_WS
 			gsstl::unique_ptr<Connection::WebSocketConnection> reliableConnection;
 			#else
@@ -85,13 +174,51 @@ namespace GameSparks { namespace RT {
 			gsstl::string hostName;
 			gsstl::string TcpPort;
 			gsstl::string fastPort;
-			gsstl::map<int, int> peerMaxSequenceNumbers;
 
-			int sequenceNumber = 0;
+			// ShouldExecute() is called on the threads of both connections
+			mutable gsstl::mutex peerSequencesMutex;
+			PeerSequenceTable peerSequences;
+
+			uint32_t sequenceNumber = 0; // wraps around, see PeerSequenceTable::Accept()
 
 			GameSparksRT::ConnectState internalState = GameSparksRT::ConnectState::Disconnected;
 
-			gsstl::recursive_mutex sendMutex;
+			mutable gsstl::recursive_mutex sendMutex;
+
+			Core::IGSProfiler* profiler = nullptr;
+
+			int reliableFlushThreshold = 1400;
+			gsstl::vector<int> immediateFlushOpCodes;
+
+			int maxDatagramSize = 0;
+			long long unreliablePacketsSent = 0; // guarded by sendMutex
+			long long unreliableDatagramsSent = 0; // guarded by sendMutex
+
+			int fragmentOpCode = 0;
+			int maxFragmentedMessageSize = 0;
+			uint16_t nextFragmentedMessageId = 0; // guarded by sendMutex
+			System::Bytes fragmentMessage; // guarded by sendMutex
+			System::Bytes fragment; // guarded by sendMutex
+
+			// fragments arrive on the threads of both connections
+			gsstl::mutex reassemblerMutex;
+			Proto::FragmentReassembler reassembler {0, 4, 1.0f};
+
+			int compressionOpCode = 0;
+			int maxCompressedMessageSize = 0;
+			Proto::LZCodec compressor; // guarded by sendMutex, only Decompress() is used on the receiving threads
+			System::Bytes uncompressedMessage; // guarded by sendMutex
+			System::Bytes compressedMessage; // guarded by sendMutex
+
+			int deltaOpCode = 0;
+			Proto::DeltaEncoder deltaEncoder; // guarded by sendMutex
+			Proto::RTDataDelta::Header deltaHeader; // guarded by sendMutex
+			System::Bytes deltaMessage; // guarded by sendMutex
+			RTData deltaSlots; // guarded by sendMutex
+
+			// delta packets arrive on the threads of both connections
+			gsstl::mutex deltaDecoderMutex;
+			Proto::DeltaDecoder deltaDecoder;
 	};
 
 }} /* namespace GameSparks.RT */
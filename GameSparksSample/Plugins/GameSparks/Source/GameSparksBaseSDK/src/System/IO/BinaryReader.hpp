@@ -18,7 +18,7 @@ class BinaryReader
         System::Failable<void> FillBuffer(int numBytes);
     private:
         Stream& stream;
-        Bytes _buffer;
+        unsigned char _buffer[16];
 };
 
 
@@ -1,6 +1,7 @@
 //#include <iostream>
 #include "./BinaryWriter.hpp"
 #include "../ArgumentException.hpp"
+#include <cstring>
 
 namespace System { namespace IO {
 
@@ -9,7 +10,6 @@ namespace System { namespace IO {
 
         BinaryWriter::BinaryWriter(Stream &stream_)
         :stream(stream_)
-        ,_buffer(16)
         {
             if (!stream.CanWrite())
             {
@@ -30,7 +30,7 @@ namespace System { namespace IO {
             _buffer[1] = (byte)(TmpValue >> 8);
             _buffer[2] = (byte)(TmpValue >> 16);
             _buffer[3] = (byte)(TmpValue >> 24);
-            GS_CALL_OR_THROW(stream.Write(_buffer, 0, 4));
+            GS_CALL_OR_THROW(WriteBuffer(4));
             return {};
         }
 
@@ -50,7 +50,23 @@ namespace System { namespace IO {
             _buffer[5] = (byte)(TmpValue >> 40);
             _buffer[6] = (byte)(TmpValue >> 48);
             _buffer[7] = (byte)(TmpValue >> 56);
-            GS_CALL_OR_THROW(stream.Write(_buffer, 0, 8));
+            GS_CALL_OR_THROW(WriteBuffer(8));
+            return {};
+        }
+
+        Failable<void> BinaryWriter::WriteBuffer(int numBytes) {
+            if (unsigned char* span = stream.WriteSpan(numBytes))
+            {
+                memcpy(span, _buffer, numBytes);
+                stream.Commit(numBytes);
+                return {};
+            }
+
+            // the buffer is a plain array, so that constructing a writer does not allocate
+            for (int i = 0; i < numBytes; ++i)
+            {
+                GS_CALL_OR_THROW(stream.WriteByte(_buffer[i]));
+            }
             return {};
         }
 }} /* namespace System.IO */
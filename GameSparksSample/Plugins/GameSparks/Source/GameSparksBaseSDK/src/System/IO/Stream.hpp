@@ -26,6 +26,16 @@ namespace System { namespace IO {
 			virtual Failable<void> Position(
 					const int /*pos*/) { GS_PROGRAMMING_ERROR("not implemented"); GS_THROW(System::NotImplementedException("NotImplementedException")); }
 
+			/// the bytes from Position() to the end of the stream, for decoding them in place. returns null, if the stream
+			/// does not keep them in memory; use ReadByte() and Read() then. Advance() moves Position() past count of them.
+			virtual const unsigned char* ReadSpan(int& available) { available = 0; return nullptr; }
+			virtual void Advance(int /*count*/) { GS_PROGRAMMING_ERROR("not implemented"); }
+
+			/// size writable bytes at Position(), for encoding in place. returns null, if the stream cannot provide them;
+			/// use WriteByte() and Write() then. Commit() writes the first count of them and moves Position() past them.
+			virtual unsigned char* WriteSpan(int /*size*/) { return nullptr; }
+			virtual void Commit(int /*count*/) { GS_PROGRAMMING_ERROR("not implemented"); }
+
 			virtual bool CanRead () const { assert(false); return false; }
 			virtual bool CanWrite() const { assert(false); return false; }
 
@@ -381,7 +381,9 @@ int Socket::internalRecv(unsigned char *buf, size_t len)
 {
     int result = -12345;
     isInsideInternalRecv = true;
-    while(!isTearingDown && result == -12345)
+    // a timeout only gives the loop the chance to see isTearingDown. it is not an error, otherwise the fast
+    // connection would stop receiving after the first 100ms without a datagram.
+    while(!isTearingDown && (result == -12345 || result == MBEDTLS_ERR_SSL_TIMEOUT))
     {
         result = mbedtls_net_recv_timeout(&netCtx, buf, len, 100);
     }
@@ -3,7 +3,7 @@
 #include "../../../../include/mbedtls/error.h"
 #include "../../../../include/mbedtls/platform.h"
 #include "../../ObjectDisposedException.hpp"
-#include "../../../../include/easywsclient/CertificateStore.hpp"
+#include "../../../../include/easywsclient/TLSSessionCache.hpp"
 
 namespace System { namespace Net { namespace Sockets {
 	TLSSocket::TLSSocket(AddressFamily addressFamily)
@@ -11,10 +11,6 @@ namespace System { namespace Net { namespace Sockets {
 	{
 		//mbedtls_debug_set_threshold( 1000 );
 		mbedtls_ssl_init(&ssl);
-		mbedtls_ssl_config_init(&conf);
-
-		mbedtls_ctr_drbg_init(&ctr_drbg);
-		mbedtls_entropy_init(&entropy);
 	}
 
 
@@ -22,9 +18,6 @@ namespace System { namespace Net { namespace Sockets {
 	{
 		teardown();
 		mbedtls_ssl_free(&ssl);
-		mbedtls_ssl_config_free(&conf);
-		mbedtls_ctr_drbg_free(&ctr_drbg);
-		mbedtls_entropy_free(&entropy);
 	}
 
 	static void set_errstr(const gsstl::string& e)
@@ -46,13 +39,6 @@ namespace System { namespace Net { namespace Sockets {
 		set_errstr(mbedtls_error_to_string_2(res));
 	}
 
-	static void debug_print(void *ctx, int level, const char *file, int line, const char *str)
-	{
-		((void)level);
-		mbedtls_fprintf((FILE *)ctx, "%s:%04d: %s", file, line, str);
-		//fflush((FILE *)ctx);
-	}
-
 	bool TLSSocket::Connect(const IPEndPoint& endpoint)
 	{
 		if(Connected())
@@ -63,33 +49,17 @@ namespace System { namespace Net { namespace Sockets {
 
 		state = State::CONNECTING;
 
-		int res = mbedtls_ctr_drbg_seed(&ctr_drbg, mbedtls_entropy_func, &entropy, nullptr, 0);
-		res = mbedtls_ssl_config_defaults(&conf,
-			MBEDTLS_SSL_IS_CLIENT,
-			MBEDTLS_SSL_TRANSPORT_STREAM,
-			MBEDTLS_SSL_PRESET_DEFAULT);
-
-		if (res != 0)
+		// the entropy, DRBG and CA chain are set up once and shared with all other connections
+		int res = 0;
+		const mbedtls_ssl_config* conf = GameSparks::Util::SharedTLSContext::config(GameSparks::Util::SharedTLSContext::TLS12, res);
+		if (!conf)
 		{
 			set_errstr(res);
 			state = State::CLOSED;
 			return false;
 		}
 
-
-		// default suite, but with at least TLS 1.2
-		mbedtls_ssl_conf_min_version(&conf, MBEDTLS_SSL_MAJOR_VERSION_3, MBEDTLS_SSL_MINOR_VERSION_3);
-
-		mbedtls_ssl_conf_authmode(&conf, MBEDTLS_SSL_VERIFY_NONE);
-
-		// this performs platform specific initialisation by retrieving the certificate store from the OS.
-		// if implemented for this platform, it also sets mbedtls_ssl_conf_authmode to MBEDTLS_SSL_VERIFY_REQUIRED
-		GameSparks::Util::CertificateStore::setup(conf);
-
-		mbedtls_ssl_conf_rng(&conf, mbedtls_ctr_drbg_random, &ctr_drbg);
-		mbedtls_ssl_conf_dbg(&conf, debug_print, stderr);
-
-		res = mbedtls_ssl_setup(&ssl, &conf);
+		res = mbedtls_ssl_setup(&ssl, conf);
 		if (res != 0)
 		{
 			set_errstr(res);
@@ -107,11 +77,16 @@ namespace System { namespace Net { namespace Sockets {
 
 		mbedtls_ssl_set_bio(&ssl, &netCtx, mbedtls_net_send, mbedtls_net_recv, 0);// , mbedtls_net_recv_timeout);
 
+		// RT reconnects to the same endpoint can resume the session of the previous connection
+		GameSparks::Util::TLSSessionResumption resumption(endpoint.Host, endpoint.Port);
+		resumption.offer(ssl);
+
 		do res = mbedtls_ssl_handshake(&ssl);
 		while (res == MBEDTLS_ERR_SSL_WANT_READ || res == MBEDTLS_ERR_SSL_WANT_WRITE);
 
 		if (res != 0)
 		{
+			resumption.failed();
 			set_errstr(res);
 			state = State::CLOSED;
 			return false;
@@ -120,6 +95,7 @@ namespace System { namespace Net { namespace Sockets {
 		uint32_t flags;
 		if ((flags = mbedtls_ssl_get_verify_result(&ssl)) != 0)
 		{
+			resumption.failed();
 			char vrfy_buf[512];
 			mbedtls_x509_crt_verify_info(vrfy_buf, sizeof(vrfy_buf), "  ! ", flags);
 			set_errstr(vrfy_buf);
@@ -127,6 +103,7 @@ namespace System { namespace Net { namespace Sockets {
 			return false;
 		}
 
+		resumption.succeeded(ssl);
 		state = State::CONNECTED;
 		return true;
 	}
@@ -165,14 +142,22 @@ namespace System { namespace Net { namespace Sockets {
 
 	Failable<void> TLSSocket::Send(const System::Bytes &buffer, int offset, int size)
 	{
-		int ret = 0;
-		do ret = mbedtls_ssl_write(&ssl, buffer.data() + offset, size);
-		while (ret == MBEDTLS_ERR_SSL_WANT_READ || ret == MBEDTLS_ERR_SSL_WANT_WRITE);
-		//if (ret < 0) set_errstr(ret);
+		assert(static_cast<int>(buffer.size()) >= offset + size);
 
-		if (ret < 0)
+		// mbedtls_ssl_write() writes at most one record (MBEDTLS_SSL_MAX_CONTENT_LEN bytes) per call
+		while (size > 0)
 		{
-			GS_THROW(ObjectDisposedException("Socket has closed or read error:" + gsstl::string(mbedtls_error_to_string_2(ret))));
+			int ret = 0;
+			do ret = mbedtls_ssl_write(&ssl, buffer.data() + offset, size);
+			while (ret == MBEDTLS_ERR_SSL_WANT_READ || ret == MBEDTLS_ERR_SSL_WANT_WRITE);
+			//if (ret < 0) set_errstr(ret);
+
+			if (ret < 0)
+			{
+				GS_THROW(ObjectDisposedException("Socket has closed or read error:" + gsstl::string(mbedtls_error_to_string_2(ret))));
+			}
+			offset += ret;
+			size -= ret;
 		}
 		return{};
 	}
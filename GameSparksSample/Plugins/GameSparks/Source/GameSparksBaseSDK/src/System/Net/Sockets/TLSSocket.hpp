@@ -3,8 +3,7 @@
 
 #include "./Socket.hpp"
 
-#include "../../../../include/mbedtls/entropy.h"
-#include "../../../../include/mbedtls/ctr_drbg.h"
+#include "../../../../include/easywsclient/SharedTLSContext.hpp"
 
 namespace System { namespace Net { namespace Sockets {
 
@@ -21,9 +20,6 @@ namespace System { namespace Net { namespace Sockets {
 			virtual int internalRecv(unsigned char *buf, size_t len) override;
 
 			mbedtls_ssl_context ssl;
-			mbedtls_ssl_config conf;
-			mbedtls_entropy_context entropy;
-			mbedtls_ctr_drbg_context ctr_drbg;
 	};
 
 }}}
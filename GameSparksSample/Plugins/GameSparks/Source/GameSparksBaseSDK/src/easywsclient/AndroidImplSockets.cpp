@@ -15,6 +15,9 @@
 #include "GameSparks/GSLeakDetector.h"
 #include "GameSparks/GSUtil.h"
 #include "easywsclient/CertificateStore.hpp"
+#include "easywsclient/TLSSessionCache.hpp"
+#include "easywsclient/SharedTLSContext.hpp"
+#include <sys/select.h>
 
 #if defined(__UNREAL__)
 int GameSparks::Util::CertificateStore::numCerts = 0;
@@ -86,6 +89,18 @@ public:
 		return mbedtls_net_recv(&net, (unsigned char *)buf, siz);
 	}
 
+	virtual bool readable()
+	{
+		if (is_aborted || net.fd < 0) return true;
+
+		// like mbedtls_net_recv_timeout(), with a timeout of 0
+		fd_set read_fds;
+		FD_ZERO(&read_fds);
+		FD_SET(net.fd, &read_fds);
+		struct timeval tv = { 0, 0 };
+		return select(net.fd + 1, &read_fds, NULL, NULL, &tv) != 0;
+	}
+
 	virtual void set_blocking(bool should_block)
 	{
 		assert(is_connected);
@@ -114,32 +129,16 @@ class TLSSocket : public TCPSocket
 private:
 	bool is_connected;
 	mbedtls_ssl_context ssl;
-	mbedtls_ssl_config conf;
-	mbedtls_entropy_context entropy;
-	mbedtls_ctr_drbg_context ctr_drbg;
-
-	static void debug_print(void *ctx, int level, const char *file, int line, const char *str)
-	{
-		((void)level);
-		mbedtls_fprintf((FILE *)ctx, "%s:%04d: %s", file, line, str);
-		//fflush((FILE *)ctx);
-	}
 public:
 	TLSSocket() :is_connected(false)
 	{
 		//mbedtls_debug_set_threshold( 1000 );
 		mbedtls_ssl_init(&ssl);
-		mbedtls_ssl_config_init(&conf);
-		mbedtls_ctr_drbg_init(&ctr_drbg);
-		mbedtls_entropy_init(&entropy);
 	}
 
 	virtual ~TLSSocket()
 	{
 		mbedtls_ssl_free(&ssl);
-		mbedtls_ssl_config_free(&conf);
-		mbedtls_ctr_drbg_free(&ctr_drbg);
-		mbedtls_entropy_free(&entropy);
 	}
 
 	virtual bool connect(const char *host, short port)
@@ -152,34 +151,17 @@ public:
 			return false;
 		}
 
-		int res = mbedtls_ctr_drbg_seed(&ctr_drbg, mbedtls_entropy_func, &entropy, nullptr, 0);
-		res = mbedtls_ssl_config_defaults(&conf,
-			MBEDTLS_SSL_IS_CLIENT,
-			MBEDTLS_SSL_TRANSPORT_STREAM,
-			MBEDTLS_SSL_PRESET_DEFAULT);
-
-		if (res != 0)
+		// the entropy, DRBG and CA chain are set up once and shared by all connections
+		int res = 0;
+		const mbedtls_ssl_config* conf = GameSparks::Util::SharedTLSContext::config(GameSparks::Util::SharedTLSContext::AnyVersion, res);
+		if (!conf)
 		{
 			set_errstr(res);
 			close();
 			return false;
 		}
 
-		mbedtls_ssl_conf_authmode(&conf, MBEDTLS_SSL_VERIFY_NONE);
-
-		// this performs platform specific initialisation by retrieving the certificate store from the OS.
-		// if implemented for this platform, it also sets mbedtls_ssl_conf_authmode to MBEDTLS_SSL_VERIFY_REQUIRED
-		res = GameSparks::Util::CertificateStore::setup(conf);
-		if (res != 0) {
-			set_errstr(res);
-			close();
-			return false;
-		}
-
-		mbedtls_ssl_conf_rng(&conf, mbedtls_ctr_drbg_random, &ctr_drbg);
-		mbedtls_ssl_conf_dbg(&conf, debug_print, stderr);
-
-		res = mbedtls_ssl_setup(&ssl, &conf);
+		res = mbedtls_ssl_setup(&ssl, conf);
 		if (res != 0)
 		{
 			set_errstr(res);
@@ -197,11 +179,18 @@ public:
 
 		mbedtls_ssl_set_bio(&ssl, &net, mbedtls_net_send, mbedtls_net_recv, 0);// , mbedtls_net_recv_timeout);
 
+		// offer the session of a previous connection to this host, so that reconnects can do an abbreviated handshake
+		char port_str[8];
+		snprintf(port_str, 8, "%hu", port);
+		GameSparks::Util::TLSSessionResumption resumption(host, port_str);
+		resumption.offer(ssl);
+
 		do res = mbedtls_ssl_handshake(&ssl);
 		while (res == MBEDTLS_ERR_SSL_WANT_READ || res == MBEDTLS_ERR_SSL_WANT_WRITE);
 
 		if (res != 0)
 		{
+			resumption.failed();
 			set_errstr(res);
 			close();
 			return false;
@@ -210,6 +199,7 @@ public:
 		uint32_t flags;
 		if ((flags = mbedtls_ssl_get_verify_result(&ssl)) != 0)
 		{
+			resumption.failed();
 			char vrfy_buf[512];
 			mbedtls_x509_crt_verify_info(vrfy_buf, sizeof(vrfy_buf), "  ! ", flags);
 			set_errstr(vrfy_buf);
@@ -217,6 +207,7 @@ public:
 			return false;
 		}
 
+		resumption.succeeded(ssl);
 		is_connected = true;
 		return true;
 	}
@@ -246,6 +237,12 @@ public:
 		if (ret < 0) set_errstr(ret);
 		return ret;*/
 	}
+
+	virtual bool readable()
+	{
+		// records that were decrypted already are not visible to the socket
+		return mbedtls_ssl_get_bytes_avail(&ssl) > 0 || TCPSocket::readable();
+	}
 };
 
 BaseSocket *BaseSocket::create(bool useSSL) {
@@ -225,6 +225,26 @@ namespace { // private module-only namespace
 		readyStateValues getReadyState() const {
 			return readyState;
 		}
+
+		size_t getBufferedAmount() const {
+			return txbuf.size();
+		}
+
+		size_t getReceivedAmount() const {
+			return rxbuf.size();
+		}
+
+		bool needsPoll() const {
+			if (readyState == CLOSED)
+			{
+				return false;
+			}
+			if (readyState != OPEN || ipLookup != keComplete || !rxbuf.empty() || !txbuf.empty())
+			{
+				return true;
+			}
+			return socket->readable();
+		}
        
 		void poll(int timeout, WSErrorCallback errorCallback, void* userData)  // timeout in milliseconds
         {
@@ -0,0 +1,121 @@
+#include "Tests.hpp"
+#include "TestPlatform.hpp"
+#include "WebSocketServerStub.hpp"
+
+#include <GameSparks/generated/GSRequests.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+using namespace GameSparks::Core;
+
+namespace {
+
+	void SendEvent(GS& gs, GSRequest::Priority priority, const std::string& eventKey, int sequence, const std::string& padding)
+	{
+		GameSparks::Api::Requests::LogEventRequest request(gs);
+		request.SetEventKey(eventKey);
+		request.SetEventAttribute("sequence", sequence);
+		request.SetEventAttribute("padding", padding);
+		request.SetPriority(priority);
+		request.Send(60);
+	}
+
+	int SequenceOf(const std::string& frame)
+	{
+		const std::string key = "\"sequence\":";
+		const std::string::size_type position = frame.find(key);
+		return position == std::string::npos ? -1 : std::atoi(frame.c_str() + position + key.size());
+	}
+
+}
+
+// a burst of background requests must not delay an interactive request queued after it by more than the send buffer
+// GSConnection keeps in front of its lanes (SendLaneMaxBufferedBytes), no matter how much background traffic is waiting.
+GS_TEST(GSConnectionInteractiveLatencyUnderFlood)
+{
+	const int backgroundRequests = 200;
+	const std::size_t bytesPerTick = 4 * 1024;
+	const std::size_t sendLaneMaxBufferedBytes = 16 * 1024; // the limit in GSConnection.cpp
+
+	GameSparks::Tests::WebSocketServerStub server;
+	GameSparks::Tests::TestPlatform platform;
+	GS gs;
+	gs.Initialise(&platform);
+	GS_TEST_CHECK(GameSparks::Tests::WaitUntilAvailable(gs));
+
+	const std::size_t handshakeFrames = server.Frames().size();
+	const std::size_t handshakeBytes = server.ReceivedBytes();
+
+	// from here on the uplink is the bottleneck, like a mobile connection uploading telemetry
+	server.LimitSend(0);
+
+	const std::string padding(1000, 'x');
+	for (int i = 0; i != backgroundRequests; ++i)
+	{
+		SendEvent(gs, GSRequest::PRIORITY_BACKGROUND, "background", i, padding);
+	}
+	SendEvent(gs, GSRequest::PRIORITY_INTERACTIVE, "interactive", 0, padding);
+
+	int interactiveTick = -1;
+	int backgroundBefore = -1;
+	std::size_t frameBytes = 0;
+	int tick = 0;
+	for (; tick != 1000; ++tick)
+	{
+		server.LimitSend(bytesPerTick);
+		gs.Update(0.001f);
+
+		const std::vector<std::string> frames = server.Frames();
+		if (interactiveTick == -1)
+		{
+			for (std::size_t i = handshakeFrames; i != frames.size(); ++i)
+			{
+				if (frames[i].find("\"interactive\"") != std::string::npos)
+				{
+					interactiveTick = tick;
+					backgroundBefore = static_cast<int>(i - handshakeFrames);
+					frameBytes = frames[i].size();
+				}
+			}
+		}
+
+		if (frames.size() == handshakeFrames + backgroundRequests + 1)
+		{
+			break;
+		}
+	}
+
+	const std::vector<std::string> frames = server.Frames();
+	GS_TEST_CHECK(frames.size() == handshakeFrames + backgroundRequests + 1);
+	GS_TEST_CHECK(interactiveTick != -1);
+
+	// the background requests keep their order around the interactive one
+	int expected = 0;
+	for (std::size_t i = handshakeFrames; i != frames.size(); ++i)
+	{
+		if (frames[i].find("\"background\"") != std::string::npos)
+		{
+			GS_TEST_CHECK(SequenceOf(frames[i]) == expected);
+			++expected;
+		}
+	}
+	GS_TEST_CHECK(expected == backgroundRequests);
+
+	// the interactive frame waits for what is already buffered: up to the limit plus the frame that crossed it, and
+	// itself. the frame headers and the partial tick it was queued in make up the rest.
+	const std::size_t maxTicks = (sendLaneMaxBufferedBytes + 2 * (frameBytes + 14)) / bytesPerTick + 2;
+	const std::size_t floodTicks = (server.ReceivedBytes() - handshakeBytes) / bytesPerTick;
+
+	std::printf("GSConnectionInteractiveLatencyUnderFlood: %d background requests queued first, the interactive one "
+		"arrived after %d of them, in tick %d of %d (bound %d)\n",
+		backgroundRequests, backgroundBefore, interactiveTick + 1, tick + 1, static_cast<int>(maxTicks));
+
+	GS_TEST_CHECK(static_cast<std::size_t>(interactiveTick + 1) <= maxTicks);
+	GS_TEST_CHECK(floodTicks > 4 * maxTicks);
+	GS_TEST_CHECK(backgroundBefore < backgroundRequests / 4);
+
+	gs.ShutDown();
+	return true;
+}
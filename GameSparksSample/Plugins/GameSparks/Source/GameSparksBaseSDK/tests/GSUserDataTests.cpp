@@ -0,0 +1,183 @@
+#include "Tests.hpp"
+#include "TestPlatform.hpp"
+#include "WebSocketServerStub.hpp"
+
+#include <GameSparks/generated/GSRequests.h>
+
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+using namespace GameSparks::Core;
+using GameSparks::Api::Requests::LogEventRequest;
+using GameSparks::Api::Responses::LogEventResponse;
+
+namespace {
+
+	// the user-data of each response, in the order they were delivered
+	std::vector<void*> delivered;
+
+	void OnResponse(GS&, const LogEventResponse& response)
+	{
+		delivered.push_back(response.GetUserData());
+	}
+
+	/// sends a request on behalf of proxy, like the generated UGS*Request proxies of the plugin do
+	void SendFor(GS& gs, void* proxy)
+	{
+		LogEventRequest request(gs);
+		request.SetEventKey("proxy");
+		request.SetUserData(proxy);
+		request.Send(OnResponse, 60);
+	}
+
+	std::string RequestIdOf(const std::string& frame)
+	{
+		// GSRequest::GetJSON() is formatted, so there is white space after the colon
+		const std::string::size_type key = frame.find("\"requestId\":");
+		const std::string::size_type begin = key == std::string::npos ? key : frame.find('"', key + 12);
+		if (begin == std::string::npos)
+		{
+			return "";
+		}
+		return frame.substr(begin + 1, frame.find('"', begin + 1) - begin - 1);
+	}
+
+	void Respond(GameSparks::Tests::WebSocketServerStub& server, const std::string& frame)
+	{
+		server.Send("{\"@class\":\".LogEventResponse\",\"requestId\":\"" + RequestIdOf(frame) + "\"}");
+	}
+
+	/// updates gs until the server got count frames after first
+	std::vector<std::string> WaitForFrames(GS& gs, GameSparks::Tests::WebSocketServerStub& server, std::size_t first, std::size_t count)
+	{
+		std::vector<std::string> frames = server.Frames(first);
+		for (int i = 0; i != 1000 && frames.size() < count; ++i)
+		{
+			gs.Update(0.001f);
+			frames = server.Frames(first);
+		}
+		return frames;
+	}
+
+	/// updates gs until count responses were delivered
+	bool WaitForResponses(GS& gs, std::size_t count)
+	{
+		for (int i = 0; i != 1000 && delivered.size() < count; ++i)
+		{
+			gs.Update(0.001f);
+		}
+		return delivered.size() == count;
+	}
+
+}
+
+// 10000 proxies come and go while 1000 of their requests are in flight. every other proxy is destroyed before its
+// response arrives, which detaches it with ChangeUserDataForRequests(proxy, 0) like the destructors of the proxies do.
+// its callback still runs, but without user-data, all others get their own proxy.
+GS_TEST(GSUserDataTenThousandProxies)
+{
+	const int proxyCount = 10000;
+	const int inFlight = 1000;
+
+	GameSparks::Tests::WebSocketServerStub server;
+	GameSparks::Tests::TestPlatform platform;
+	GS gs;
+	gs.Initialise(&platform);
+	GS_TEST_CHECK(GameSparks::Tests::WaitUntilAvailable(gs));
+
+	std::vector<int> proxies(proxyCount);
+	delivered.clear();
+
+	std::size_t first = server.Frames().size();
+	std::chrono::steady_clock::duration detaching(0);
+	int detached = 0;
+
+	for (int round = 0; round != proxyCount / inFlight; ++round)
+	{
+		for (int i = round * inFlight; i != (round + 1) * inFlight; ++i)
+		{
+			SendFor(gs, &proxies[i]);
+		}
+
+		const std::vector<std::string> frames = WaitForFrames(gs, server, first, inFlight);
+		GS_TEST_CHECK(frames.size() == static_cast<std::size_t>(inFlight));
+		first += frames.size();
+
+		const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		for (int i = round * inFlight; i != (round + 1) * inFlight; i += 2)
+		{
+			gs.ChangeUserDataForRequests(&proxies[i], 0);
+			++detached;
+		}
+		detaching += std::chrono::steady_clock::now() - start;
+
+		for (std::size_t i = 0; i != frames.size(); ++i)
+		{
+			Respond(server, frames[i]);
+		}
+		GS_TEST_CHECK(WaitForResponses(gs, static_cast<std::size_t>((round + 1) * inFlight)));
+	}
+
+	// requests go out in the order they were sent, so do the responses
+	for (int i = 0; i != proxyCount; ++i)
+	{
+		GS_TEST_CHECK(delivered[i] == (i % 2 == 0 ? static_cast<void*>(0) : static_cast<void*>(&proxies[i])));
+	}
+
+	std::printf("GSUserDataTenThousandProxies: ChangeUserDataForRequests with %d requests in flight: %.1f ns per call\n",
+		inFlight, std::chrono::duration<double, std::nano>(detaching).count() / detached);
+
+	gs.ShutDown();
+	return true;
+}
+
+// re-targeting the user-data of a to b, when b already has requests in flight, merges both, so that the next change
+// of b covers the requests of a as well. a can then be used for new requests without touching the merged ones.
+GS_TEST(GSUserDataMergesOnCollision)
+{
+	GameSparks::Tests::WebSocketServerStub server;
+	GameSparks::Tests::TestPlatform platform;
+	GS gs;
+	gs.Initialise(&platform);
+	GS_TEST_CHECK(GameSparks::Tests::WaitUntilAvailable(gs));
+
+	int a = 0, b = 0, c = 0;
+	delivered.clear();
+
+	const std::size_t first = server.Frames().size();
+	SendFor(gs, &a);
+	SendFor(gs, &b);
+	SendFor(gs, &a);
+	SendFor(gs, &b);
+
+	gs.ChangeUserDataForRequests(&a, &b);
+	SendFor(gs, &a);
+	gs.ChangeUserDataForRequests(&b, &c);
+
+	std::vector<std::string> frames = WaitForFrames(gs, server, first, 5);
+	GS_TEST_CHECK(frames.size() == 5);
+
+	Respond(server, frames[0]);
+	Respond(server, frames[1]);
+	GS_TEST_CHECK(WaitForResponses(gs, 2));
+	GS_TEST_CHECK(delivered[0] == &c);
+	GS_TEST_CHECK(delivered[1] == &c);
+
+	// the request sent for a after the merge is not affected by the change of b
+	Respond(server, frames[4]);
+	GS_TEST_CHECK(WaitForResponses(gs, 3));
+	GS_TEST_CHECK(delivered[2] == &a);
+
+	// detaching c reaches the requests of a and b, that were merged into it
+	gs.ChangeUserDataForRequests(&c, 0);
+	Respond(server, frames[2]);
+	Respond(server, frames[3]);
+	GS_TEST_CHECK(WaitForResponses(gs, 5));
+	GS_TEST_CHECK(delivered[3] == 0);
+	GS_TEST_CHECK(delivered[4] == 0);
+
+	gs.ShutDown();
+	return true;
+}
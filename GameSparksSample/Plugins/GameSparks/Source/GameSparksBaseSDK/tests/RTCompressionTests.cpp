@@ -0,0 +1,146 @@
+#include "Tests.hpp"
+
+#include <GameSparksRT/Proto/LZCodec.hpp>
+#include <GameSparksRT/GameSparksRT.hpp>
+
+#include <chrono>
+#include <cstring>
+#include <random>
+
+using namespace GameSparks::RT;
+
+namespace {
+
+	void Append(System::Bytes& bytes, const char* text)
+	{
+		bytes.insert(bytes.end(), text, text + std::strlen(text));
+	}
+
+	/// a voxel chunk: runs of a few block ids
+	System::Bytes VoxelSnapshot(std::mt19937& rng)
+	{
+		System::Bytes snapshot;
+		while (snapshot.size() < 1024)
+		{
+			const System::Byte block = System::Byte(rng() % 6);
+			snapshot.insert(snapshot.end(), 1 + rng() % 24, block);
+		}
+		return snapshot;
+	}
+
+	/// the state of a few abilities, text with the same keys every time
+	System::Bytes AbilitySnapshot(std::mt19937& rng)
+	{
+		System::Bytes snapshot;
+		Append(snapshot, "{\"type\":\"abilities\",\"entities\":[");
+		for (int i = 0; i != 8; ++i)
+		{
+			char entity[128];
+			std::snprintf(entity, sizeof(entity), "{\"id\":%u,\"ability\":\"fireball\",\"cooldown\":%u,\"charges\":%u,\"pos\":[%u.5,2.0,%u.25]},",
+				unsigned(rng() % 64), unsigned(rng() % 30), unsigned(rng() % 3), unsigned(rng() % 100), unsigned(rng() % 100));
+			Append(snapshot, entity);
+		}
+		Append(snapshot, "]}");
+		return snapshot;
+	}
+
+	struct Result
+	{
+		double ratio;
+		double compressMBs;
+		double decompressMBs;
+		bool intact;
+	};
+
+	Result Measure(const System::Bytes& dictionary, const gsstl::vector<System::Bytes>& payloads)
+	{
+		const int rounds = 20;
+		Proto::LZCodec codec(dictionary);
+		gsstl::vector<System::Bytes> compressed(payloads.size());
+
+		Result result = {0, 0, 0, true};
+		size_t in = 0, out = 0;
+		const auto start = std::chrono::steady_clock::now();
+		for (int round = 0; round != rounds; ++round)
+		{
+			for (size_t i = 0; i != payloads.size(); ++i)
+			{
+				compressed[i].clear(); // Compress() appends
+				codec.Compress(payloads[i].data(), int(payloads[i].size()), compressed[i]);
+			}
+		}
+		const auto compressEnd = std::chrono::steady_clock::now();
+		System::Bytes decompressed;
+		for (int round = 0; round != rounds; ++round)
+		{
+			for (size_t i = 0; i != payloads.size(); ++i)
+			{
+				const System::Failable<void> ok = codec.Decompress(compressed[i].data(), int(compressed[i].size()), int(payloads[i].size()), decompressed);
+				result.intact = result.intact && ok.isOK() && decompressed == payloads[i];
+			}
+		}
+		const auto decompressEnd = std::chrono::steady_clock::now();
+
+		for (size_t i = 0; i != payloads.size(); ++i)
+		{
+			in += payloads[i].size();
+			out += compressed[i].size();
+		}
+		result.ratio = double(in) / double(out);
+		result.compressMBs = double(in) * rounds / std::chrono::duration<double>(compressEnd - start).count() / 1e6;
+		result.decompressMBs = double(in) * rounds / std::chrono::duration<double>(decompressEnd - compressEnd).count() / 1e6;
+		return result;
+	}
+
+	bool Benchmark(const char* name, System::Bytes (*snapshot)(std::mt19937&))
+	{
+		std::mt19937 rng(3);
+		gsstl::vector<System::Bytes> captured, payloads;
+		for (int i = 0; i != 200; ++i)
+		{
+			captured.push_back(snapshot(rng));
+			payloads.push_back(snapshot(rng));
+		}
+
+		const Result plain = Measure(System::Bytes(), payloads);
+		const Result trained = Measure(GameSparksRT::TrainCompressionDictionary(captured), payloads);
+		std::printf("%-10s no dictionary: ratio %.2f, compress %.0f MB/s, decompress %.0f MB/s\n", name, plain.ratio, plain.compressMBs, plain.decompressMBs);
+		std::printf("%-10s dictionary:    ratio %.2f, compress %.0f MB/s, decompress %.0f MB/s\n", name, trained.ratio, trained.compressMBs, trained.decompressMBs);
+
+		GS_TEST_CHECK(plain.intact);
+		GS_TEST_CHECK(trained.intact);
+		GS_TEST_CHECK(plain.ratio > 1.0);
+		GS_TEST_CHECK(trained.ratio >= plain.ratio);
+		return true;
+	}
+
+}
+
+GS_TEST(RTCompressionBenchmark)
+{
+	GS_TEST_CHECK(Benchmark("voxels", &VoxelSnapshot));
+	GS_TEST_CHECK(Benchmark("abilities", &AbilitySnapshot));
+	return true;
+}
+
+GS_TEST(RTCompressionRejectsCorruptInput)
+{
+	std::mt19937 rng(5);
+	Proto::LZCodec codec;
+	System::Bytes junk, output;
+	for (int i = 0; i != 20000; ++i)
+	{
+		junk.resize(rng() % 64);
+		for (size_t b = 0; b != junk.size(); ++b)
+		{
+			junk[b] = System::Byte(rng());
+		}
+		const int decompressedSize = int(rng() % 200);
+		// must not read or write out of bounds, whether or not it accepts the input
+		if (codec.Decompress(junk.data(), int(junk.size()), decompressedSize, output).isOK())
+		{
+			GS_TEST_CHECK(output.size() == size_t(decompressedSize));
+		}
+	}
+	return true;
+}
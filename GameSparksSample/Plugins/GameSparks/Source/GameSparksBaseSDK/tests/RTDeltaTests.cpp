@@ -0,0 +1,388 @@
+#include "Tests.hpp"
+#include "LoopbackServer.hpp"
+
+#include <GameSparksRT/RTSessionImpl.hpp>
+#include <GameSparksRT/IRTSessionListener.hpp>
+#include <GameSparksRT/Commands/Requests/CustomRequest.hpp>
+#include <GameSparksRT/Proto/Packet.hpp>
+#include <GameSparksRT/Proto/ReusableBinaryWriter.hpp>
+
+#include <chrono>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+
+using namespace GameSparks::RT;
+
+namespace {
+
+	const int Players = 16;
+	const int Ticks = 300; // 10 seconds at 30 Hz
+	const int StateOpCode = 10;
+	const int DeltaOpCode = 20;
+
+	/// the state each player sends every tick. most players move most of the time, the other slots change now and then.
+	class Scenario
+	{
+		public:
+			Scenario() : rng(1), x(Players, 0.0f), y(Players, 0.0f), health(Players, 100), ammo(Players, 30), score(Players, 0) {}
+
+			RTData State(int tick, int player)
+			{
+				std::uniform_int_distribution<int> percent(0, 99);
+				const bool moving = (tick / 30 + player) % 3 != 0;
+				if (moving)
+				{
+					x[player] += 0.1f;
+					y[player] += 0.05f;
+				}
+				if (percent(rng) < 2) health[player] -= 10;
+				if (percent(rng) < 5) ammo[player] -= 1;
+				if (percent(rng) < 1) score[player] += 1;
+
+				RTData state;
+				state.SetInt(1, player);
+				state.SetRTVector(2, RTVector(x[player], y[player], 0.0f));
+				state.SetRTVector(3, RTVector(0.0f, moving ? float(tick) : 0.0f, 0.0f));
+				state.SetInt(4, health[player]);
+				state.SetInt(5, ammo[player]);
+				state.SetString(6, "player_" + std::to_string(player));
+				state.SetInt(7, score[player]);
+				state.SetInt(8, player % 2);
+				return state;
+			}
+		private:
+			std::mt19937 rng;
+			gsstl::vector<float> x, y;
+			gsstl::vector<int> health, ammo, score;
+	};
+
+	class Receiver : public IRTSessionListener
+	{
+		public:
+			gsstl::vector<RTData> expected = gsstl::vector<RTData>(Players + 1); // by peer id
+			int delivered = 0;
+			int correct = 0;
+
+			virtual void OnPlayerConnect(int) override {}
+			virtual void OnPlayerDisconnect(int) override {}
+			virtual void OnReady(bool) override {}
+			virtual void OnPacket(const RTPacket& packet) override
+			{
+				++delivered;
+				if (packet.OpCode == StateOpCode && packet.Sender > 0 && packet.Sender <= Players && packet.Data == expected[packet.Sender])
+				{
+					++correct;
+				}
+			}
+	};
+
+	struct Traffic
+	{
+		long long bytes = 0;
+		long long packets = 0;
+		long long keyframes = 0;
+	};
+
+	/// serializes a packet the way a session sends it, with the sender the server adds, and unless it is lost, hands it to
+	/// the receiving session the way the fast connection does. returns the size on the wire.
+	int Send(RTSessionImpl& receiver, int sender, int opCode, GameSparksRT::DeliveryIntent intent, const System::Bytes& payload, const RTData& data, bool lost)
+	{
+		CustomRequest request(opCode, intent, payload, data, gsstl::vector<int>());
+		Proto::Packet packet = request.ToPacket(receiver, true);
+		packet.Sender = sender;
+
+		BinaryWriteMemoryStream stream;
+		Proto::Packet::SerializeLengthDelimited(stream, packet);
+		const int size = stream.Position();
+		if (lost)
+		{
+			return size;
+		}
+
+		stream.Position(0);
+		Proto::Packet received(receiver);
+		Proto::Packet::DeserializeLengthDelimited(stream, stream.BinaryReader, received);
+		if (!received.Command && !received.hasPayload)
+		{
+			// see Connection::OnPacketReceived()
+			System::IO::MemoryStream empty;
+			received.Command.reset(CustomCommand::Deserialize(received.OpCode, sender, empty, received.Data, 0, receiver).GetResult());
+		}
+		if (received.Command)
+		{
+			receiver.SubmitAction(received.Command, received.SequenceNumber.HasValue());
+		}
+		return size;
+	}
+
+	/// plays the scenario, every player sending its state to all others each tick. with delta encoding, each player
+	/// encodes the way IRTSession::SendDelta() does. loss is the share of unreliable packets lost.
+	Traffic Play(bool delta, double loss, Receiver& listener)
+	{
+		gsstl::unique_ptr<RTSessionImpl> receiver(static_cast<RTSessionImpl*>(GameSparksRTSessionBuilder()
+			.SetListener(&listener)
+			.EnableDeltaEncoding(DeltaOpCode)
+			.Build()));
+
+		Scenario scenario;
+		std::mt19937 rng(2);
+		std::uniform_real_distribution<double> chance(0.0, 1.0);
+		gsstl::vector<Proto::DeltaEncoder> encoders(Players);
+		const System::Bytes noPayload;
+		Traffic traffic;
+
+		for (int tick = 0; tick != Ticks; ++tick)
+		{
+			for (int player = 0; player != Players; ++player)
+			{
+				const int peerId = player + 1;
+				const RTData state = scenario.State(tick, player);
+				listener.expected[peerId] = state;
+
+				Proto::RTDataDelta::Header header;
+				RTData slots;
+				Proto::DeltaEncoder::Mode mode = delta
+					? encoders[player].Encode(StateOpCode, false, state, header, slots)
+					: Proto::DeltaEncoder::SEND_PLAIN;
+
+				const bool reliable = mode == Proto::DeltaEncoder::SEND_KEYFRAME;
+				const GameSparksRT::DeliveryIntent intent = reliable ? GameSparksRT::DeliveryIntent::RELIABLE : GameSparksRT::DeliveryIntent::UNRELIABLE_SEQUENCED;
+				++traffic.packets;
+				traffic.keyframes += reliable ? 1 : 0;
+
+				const bool lost = !reliable && chance(rng) < loss;
+				if (mode == Proto::DeltaEncoder::SEND_PLAIN)
+				{
+					traffic.bytes += Send(*receiver, peerId, StateOpCode, intent, noPayload, state, lost);
+				}
+				else
+				{
+					System::Bytes headerBytes;
+					Proto::RTDataDelta::WriteHeader(headerBytes, header);
+					traffic.bytes += Send(*receiver, peerId, DeltaOpCode, intent, headerBytes, slots, lost);
+				}
+			}
+			receiver->Update();
+		}
+		return traffic;
+	}
+
+}
+
+namespace {
+
+	/// two sessions connected through a LoopbackServer, the first one sends with IRTSession::SendDelta()
+	class DeltaPeers
+	{
+		public:
+			struct Observed
+			{
+				int sender;
+				bool reliable;
+				int kind;
+				uint16_t baselineId;
+			};
+
+			class Recorder : public IRTSessionListener
+			{
+				public:
+					gsstl::vector<RTData> delivered;
+
+					virtual void OnPlayerConnect(int) override {}
+					virtual void OnPlayerDisconnect(int) override {}
+					virtual void OnReady(bool) override {}
+					virtual void OnPacket(const RTPacket& packet) override
+					{
+						if (packet.OpCode == StateOpCode)
+						{
+							delivered.push_back(packet.Data);
+						}
+					}
+			};
+
+			DeltaPeers()
+			{
+				server.SetDropFilter([this](const GameSparks::Tests::RelayedPacket& packet) {
+					if (packet.opCode != DeltaOpCode || packet.payload.size() < 8)
+					{
+						return false;
+					}
+					std::lock_guard<std::mutex> lock(mutex);
+					const int kind = packet.payload[0];
+					const uint16_t baselineId = uint16_t(packet.payload[5] | (packet.payload[6] << 8));
+					observed.push_back(Observed {packet.sender, packet.reliable, kind, baselineId});
+					if (kind == Proto::RTDataDelta::KEYFRAME && keyframesToDrop > 0)
+					{
+						--keyframesToDrop;
+						return true;
+					}
+					return false;
+				});
+
+				GameSparksRTSessionBuilder senderBuilder, receiverBuilder;
+				sender.reset(server.Connect(senderBuilder.EnableDeltaEncoding(DeltaOpCode, 8), ignored));
+				receiver.reset(server.Connect(receiverBuilder.EnableDeltaEncoding(DeltaOpCode, 8), received));
+			}
+
+			/// sends state, then updates both sessions until the receiver delivered count messages in total
+			bool Send(const RTData& state, GameSparksRT::DeliveryIntent intent, size_t count)
+			{
+				sender->SendDelta(StateOpCode, intent, state, {});
+				return Pump([&]() { return received.delivered.size() >= count; });
+			}
+
+			template <typename Condition>
+			bool Pump(Condition done)
+			{
+				const auto until = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+				while (std::chrono::steady_clock::now() < until)
+				{
+					sender->Update();
+					receiver->Update();
+					if (done())
+					{
+						return true;
+					}
+					std::this_thread::sleep_for(std::chrono::milliseconds(1));
+				}
+				return false;
+			}
+
+			/// the delta packets the server forwarded or dropped so far
+			gsstl::vector<Observed> Observations()
+			{
+				std::lock_guard<std::mutex> lock(mutex);
+				return observed;
+			}
+
+			void DropKeyframes(int count)
+			{
+				std::lock_guard<std::mutex> lock(mutex);
+				keyframesToDrop = count;
+			}
+
+			GameSparks::Tests::LoopbackServer server;
+			Recorder ignored, received;
+			gsstl::unique_ptr<RTSessionImpl> sender, receiver;
+		private:
+			std::mutex mutex;
+			gsstl::vector<Observed> observed; // guarded by mutex
+			int keyframesToDrop = 0; // guarded by mutex
+	};
+
+	RTData Moved(int step)
+	{
+		RTData state;
+		state.SetInt(1, 7);
+		state.SetRTVector(2, RTVector(float(step), 2.0f * step, 0.0f));
+		state.SetString(3, "player_7");
+		state.SetInt(4, 100 - step);
+		return state;
+	}
+
+	int Count(const gsstl::vector<DeltaPeers::Observed>& observed, int sender, bool reliable, int kind)
+	{
+		int count = 0;
+		for (const DeltaPeers::Observed& o : observed)
+		{
+			count += o.sender == sender && o.reliable == reliable && o.kind == kind ? 1 : 0;
+		}
+		return count;
+	}
+
+}
+
+GS_TEST(RTDeltaSessionsRecoverDroppedKeyframe)
+{
+	DeltaPeers peers;
+
+	// the receiver never sees the first keyframe, so it cannot apply the deltas against it
+	peers.DropKeyframes(1);
+	peers.sender->SendDelta(StateOpCode, GameSparksRT::DeliveryIntent::UNRELIABLE, Moved(0), {});
+	peers.sender->SendDelta(StateOpCode, GameSparksRT::DeliveryIntent::UNRELIABLE, Moved(1), {});
+
+	// it asks the sender for the baseline, which arrives reliably and is delivered, as are the deltas after it
+	GS_TEST_CHECK(peers.Pump([&]() { return peers.received.delivered.size() >= 1; }));
+	GS_TEST_CHECK(peers.received.delivered[0] == Moved(0));
+	GS_TEST_CHECK(peers.Send(Moved(2), GameSparksRT::DeliveryIntent::UNRELIABLE, 2));
+	GS_TEST_CHECK(peers.received.delivered[1] == Moved(2));
+
+	const gsstl::vector<DeltaPeers::Observed> observed = peers.Observations();
+	GS_TEST_CHECK(peers.server.DroppedPackets() == 1);
+	GS_TEST_CHECK(Count(observed, 1, true, Proto::RTDataDelta::KEYFRAME) == 1);
+	GS_TEST_CHECK(Count(observed, 2, true, Proto::RTDataDelta::RESYNC_REQUEST) == 1);
+	GS_TEST_CHECK(Count(observed, 1, true, Proto::RTDataDelta::BASELINE) == 1);
+	GS_TEST_CHECK(Count(observed, 1, false, Proto::RTDataDelta::DELTA) == 2);
+	return true;
+}
+
+GS_TEST(RTDeltaSessionsAdvanceReliably)
+{
+	DeltaPeers peers;
+
+	// reliable sends are encoded against the previous one and move the baseline, unreliable ones use the newest baseline
+	GS_TEST_CHECK(peers.Send(Moved(0), GameSparksRT::DeliveryIntent::RELIABLE, 1));
+	GS_TEST_CHECK(peers.Send(Moved(1), GameSparksRT::DeliveryIntent::RELIABLE, 2));
+	GS_TEST_CHECK(peers.Send(Moved(2), GameSparksRT::DeliveryIntent::RELIABLE, 3));
+	GS_TEST_CHECK(peers.Send(Moved(3), GameSparksRT::DeliveryIntent::UNRELIABLE, 4));
+	for (int step = 0; step != 4; ++step)
+	{
+		GS_TEST_CHECK(peers.received.delivered[step] == Moved(step));
+	}
+
+	const gsstl::vector<DeltaPeers::Observed> observed = peers.Observations();
+	GS_TEST_CHECK(Count(observed, 1, true, Proto::RTDataDelta::KEYFRAME) == 1);
+	GS_TEST_CHECK(Count(observed, 1, true, Proto::RTDataDelta::DELTA_ADVANCE) == 2);
+	GS_TEST_CHECK(Count(observed, 1, false, Proto::RTDataDelta::DELTA) == 1);
+	GS_TEST_CHECK(observed.back().baselineId == 2);
+	GS_TEST_CHECK(Count(observed, 2, true, Proto::RTDataDelta::RESYNC_REQUEST) == 0);
+	return true;
+}
+
+GS_TEST(RTDeltaSessionsResetOnPlayerConnect)
+{
+	DeltaPeers peers;
+
+	GS_TEST_CHECK(peers.Send(Moved(0), GameSparksRT::DeliveryIntent::UNRELIABLE, 1));
+	GS_TEST_CHECK(peers.Send(Moved(1), GameSparksRT::DeliveryIntent::UNRELIABLE, 2));
+
+	// a peer that joins has none of the baselines, so the next send is a keyframe with the next baseline id
+	peers.sender->OnPlayerConnect(3);
+	GS_TEST_CHECK(peers.Send(Moved(2), GameSparksRT::DeliveryIntent::UNRELIABLE, 3));
+	GS_TEST_CHECK(peers.Send(Moved(3), GameSparksRT::DeliveryIntent::UNRELIABLE, 4));
+	for (int step = 0; step != 4; ++step)
+	{
+		GS_TEST_CHECK(peers.received.delivered[step] == Moved(step));
+	}
+
+	const gsstl::vector<DeltaPeers::Observed> observed = peers.Observations();
+	GS_TEST_CHECK(observed.size() == 4);
+	GS_TEST_CHECK(observed[2].kind == Proto::RTDataDelta::KEYFRAME && observed[2].reliable && observed[2].baselineId == 1);
+	GS_TEST_CHECK(observed[3].kind == Proto::RTDataDelta::DELTA && observed[3].baselineId == 1);
+	return true;
+}
+
+GS_TEST(RTDeltaSixteenPlayerBandwidth)
+{
+	Receiver plainListener, deltaListener, lossyListener;
+	const Traffic plain = Play(false, 0.0, plainListener);
+	const Traffic delta = Play(true, 0.0, deltaListener);
+	const Traffic lossy = Play(true, 0.1, lossyListener);
+
+	const double seconds = Ticks / 30.0;
+	std::printf("16 players, %d ticks at 30 Hz, bytes per second all players send:\n", Ticks);
+	std::printf("  full state:        %8.0f, %d of %lld delivered intact\n", plain.bytes / seconds, plainListener.correct, plain.packets);
+	std::printf("  delta:             %8.0f (%.0f%%), %lld reliable keyframes, %d of %lld delivered intact\n",
+		delta.bytes / seconds, 100.0 * delta.bytes / plain.bytes, delta.keyframes, deltaListener.correct, delta.packets);
+	std::printf("  delta at 10%% loss: %8.0f, %d delivered, %d intact\n", lossy.bytes / seconds, lossyListener.delivered, lossyListener.correct);
+
+	GS_TEST_CHECK(plainListener.correct == plain.packets);
+	GS_TEST_CHECK(deltaListener.correct == delta.packets);
+	GS_TEST_CHECK(delta.bytes < plain.bytes);
+	// a delta is applied to the baseline it was encoded against, so loss never delivers wrong state
+	GS_TEST_CHECK(lossyListener.delivered > 0);
+	GS_TEST_CHECK(lossyListener.correct == lossyListener.delivered);
+	return true;
+}
@@ -0,0 +1,232 @@
+#include "Tests.hpp"
+
+#include <GameSparksRT/RTSessionImpl.hpp>
+#include <GameSparksRT/IRTSessionListener.hpp>
+#include <GameSparksRT/Proto/Fragmentation.hpp>
+
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <chrono>
+#include <random>
+#include <thread>
+
+using namespace GameSparks::RT;
+
+namespace {
+
+	/// stands in for the RT server on the fast channel: the first datagram of each of two peers (the login) registers it,
+	/// everything else is forwarded to the other peer unless it is dropped. the loss is per datagram, like on the internet.
+	class LoopbackRelay
+	{
+		public:
+			explicit LoopbackRelay(double loss_)
+			:loss(loss_)
+			,rng(1)
+			{
+				fd = socket(AF_INET, SOCK_DGRAM, 0);
+				sockaddr_in address = {};
+				address.sin_family = AF_INET;
+				address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+				bind(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address));
+				socklen_t length = sizeof(address);
+				getsockname(fd, reinterpret_cast<sockaddr*>(&address), &length);
+				port = ntohs(address.sin_port);
+
+				timeval timeout = {0, 20000};
+				setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+				thread = std::thread([this]() { Run(); });
+			}
+
+			~LoopbackRelay()
+			{
+				stopped = true;
+				thread.join();
+				close(fd);
+			}
+
+			int Port() const { return port; }
+			int Peers() const { return peerCount; }
+			int Dropped() const { return dropped; }
+		private:
+			void Run()
+			{
+				unsigned char datagram[2048];
+				std::uniform_real_distribution<double> chance(0.0, 1.0);
+				while (!stopped)
+				{
+					sockaddr_in from = {};
+					socklen_t length = sizeof(from);
+					const ssize_t read = recvfrom(fd, datagram, sizeof(datagram), 0, reinterpret_cast<sockaddr*>(&from), &length);
+					if (read <= 0)
+					{
+						continue;
+					}
+
+					int peer = 0;
+					while (peer != peerCount && peers[peer].sin_port != from.sin_port)
+					{
+						++peer;
+					}
+					if (peer == peerCount)
+					{
+						if (peerCount < 2)
+						{
+							peers[peerCount++] = from;
+						}
+						continue;
+					}
+
+					if (peerCount < 2)
+					{
+						continue;
+					}
+					if (chance(rng) < loss)
+					{
+						++dropped;
+						continue;
+					}
+					sendto(fd, datagram, read, 0, reinterpret_cast<const sockaddr*>(&peers[1 - peer]), sizeof(peers[0]));
+				}
+			}
+
+			double loss;
+			std::mt19937 rng;
+			int fd;
+			int port;
+			std::thread thread;
+			std::atomic<bool> stopped {false};
+			sockaddr_in peers[2];
+			std::atomic<int> peerCount {0};
+			std::atomic<int> dropped {0};
+	};
+
+	const int OpCode = 5;
+
+	System::Bytes MessagePayload(int message)
+	{
+		// 2 KB to 16 KB, i.e. 2 to 17 fragments
+		System::Bytes payload(2048 + message * 72);
+		for (size_t i = 0; i != payload.size(); ++i)
+		{
+			payload[i] = System::Byte(i * 7 + message);
+		}
+		return payload;
+	}
+
+	class Receiver : public IRTSessionListener
+	{
+		public:
+			int received = 0;
+			int intact = 0;
+
+			virtual void OnPlayerConnect(int) override {}
+			virtual void OnPlayerDisconnect(int) override {}
+			virtual void OnReady(bool) override {}
+			virtual void OnPacket(const RTPacket& packet) override
+			{
+				++received;
+				const System::Nullable<int64_t> message = packet.Data.GetInt(1);
+				if (packet.OpCode == OpCode && message.HasValue() && packet.Payload == MessagePayload(int(message.Value())))
+				{
+					++intact;
+				}
+			}
+	};
+
+	/// a session connected to relay by the fast channel only, which is all unreliable messages need
+	RTSessionImpl* ConnectFast(const LoopbackRelay& relay, Receiver& listener)
+	{
+		RTSessionImpl* session = static_cast<RTSessionImpl*>(GameSparksRTSessionBuilder()
+			.SetHost("127.0.0.1")
+			.SetPort(relay.Port())
+			.SetListener(&listener)
+			.EnableFragmentation(100)
+			.Build());
+
+		const int peers = relay.Peers();
+		session->ConnectFast();
+		while (relay.Peers() == peers)
+		{
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		}
+		session->SetConnectState(GameSparksRT::ConnectState::ReliableAndFast);
+		return session;
+	}
+
+	/// sends messages of 2 to 16 KB unreliably from one session to another through relay, returns the receiving listener
+	void SendThroughRelay(LoopbackRelay& relay, int messages, Receiver& received)
+	{
+		Receiver ignored;
+		gsstl::unique_ptr<RTSessionImpl> sender(ConnectFast(relay, ignored));
+		gsstl::unique_ptr<RTSessionImpl> receiver(ConnectFast(relay, received));
+
+		for (int message = 0; message != messages; ++message)
+		{
+			RTData data;
+			data.SetInt(1, message);
+			sender->SendRTDataAndBytes(OpCode, GameSparksRT::DeliveryIntent::UNRELIABLE, MessagePayload(message), data, {});
+			sender->Update();
+			std::this_thread::sleep_for(std::chrono::microseconds(300));
+			receiver->Update();
+		}
+
+		for (int i = 0; i != 50; ++i)
+		{
+			std::this_thread::sleep_for(std::chrono::milliseconds(2));
+			receiver->Update();
+		}
+	}
+
+}
+
+GS_TEST(RTFragmentationLoopbackRelay)
+{
+	const int messages = 200;
+
+	LoopbackRelay lossless(0.0);
+	Receiver all;
+	SendThroughRelay(lossless, messages, all);
+	std::printf("no loss: %d of %d messages delivered, %d intact\n", all.received, messages, all.intact);
+	GS_TEST_CHECK(all.received == messages);
+	GS_TEST_CHECK(all.intact == messages);
+
+	// a lost fragment drops the whole message, nothing is delivered corrupted
+	LoopbackRelay lossy(0.05);
+	Receiver some;
+	SendThroughRelay(lossy, messages, some);
+	std::printf("5%% loss: %d datagrams dropped, %d of %d messages delivered, %d intact\n", lossy.Dropped(), some.received, messages, some.intact);
+	GS_TEST_CHECK(lossy.Dropped() > 0);
+	GS_TEST_CHECK(some.received < messages);
+	GS_TEST_CHECK(some.received > 0);
+	GS_TEST_CHECK(some.intact == some.received);
+	return true;
+}
+
+GS_TEST(RTFragmentationMessageSize)
+{
+	// SendFragmented() only serializes messages that do not fit into a datagram, by the size computed up front
+	RTData nested;
+	nested.SetString(1, std::string(200, 'n')).SetLong(2, -1);
+
+	RTData data[4];
+	data[1].SetInt(1, 7).SetLong(2, 1LL << 40).SetFloat(3, 0.5f).SetDouble(4, 0.25);
+	data[2].SetString(1, std::string(300, 's')).SetRTVector(5, RTVector(1.0f, 2.0f, 3.0f)).SetData(127, nested);
+	data[3].SetData(1, data[2]).SetLong(2, -(1LL << 62));
+
+	for (int payloadSize : {0, 1, 127, 128, 3000})
+	{
+		const System::Bytes payload(payloadSize, 0x5a);
+		for (const RTData& d : data)
+		{
+			const System::ArraySegment<System::Byte> segment(payload, 0, int(payload.size()));
+			System::Bytes message;
+			System::IO::MemoryStream scratch;
+			GS_TEST_CHECK(Proto::Fragmentation::WriteMessage(message, d, segment, scratch).isOK());
+			GS_TEST_CHECK(Proto::Fragmentation::MessageSize(d, segment) == int(message.size()));
+		}
+	}
+	return true;
+}
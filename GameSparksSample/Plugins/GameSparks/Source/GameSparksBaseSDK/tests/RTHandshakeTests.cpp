@@ -0,0 +1,70 @@
+#include "Tests.hpp"
+#include "LoopbackServer.hpp"
+
+#include <GameSparksRT/RTSessionImpl.hpp>
+#include <GameSparksRT/IRTSessionListener.hpp>
+#include <easywsclient/TLSSessionCache.hpp>
+
+#include <chrono>
+#include <cstdio>
+
+using namespace GameSparks::RT;
+using GameSparks::Util::TLSHandshakeStats;
+using GameSparks::Util::TLSSessionCache;
+
+namespace {
+
+	class Listener : public IRTSessionListener
+	{
+		public:
+			virtual void OnPlayerConnect(int) override {}
+			virtual void OnPlayerDisconnect(int) override {}
+			virtual void OnReady(bool) override {}
+			virtual void OnPacket(const RTPacket&) override {}
+	};
+
+}
+
+// the connection setup of an RT session, with a full TLS handshake and with one that resumes the session of the previous
+// connection. the sessions alternate, dropping the sessions cached on the client side before each full one.
+GS_TEST(RTHandshakeBenchmark)
+{
+	const int connections = 8; // the peers LoopbackServer takes
+
+	GameSparks::Tests::LoopbackServer server;
+	Listener listener;
+
+	TLSSessionCache::clear();
+	TLSSessionCache::resetStats();
+
+	double setupMillis[2] = {0, 0}; // full, resumed
+	for (int i = 0; i != connections; ++i)
+	{
+		const bool resume = i % 2 == 1;
+		if (!resume)
+		{
+			TLSSessionCache::clear();
+		}
+
+		const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		GameSparksRTSessionBuilder builder;
+		gsstl::unique_ptr<RTSessionImpl> session(server.Connect(builder, listener));
+		setupMillis[resume] += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+	}
+
+	const TLSHandshakeStats stats = TLSSessionCache::getStats();
+	const double fullHandshake = stats.fullHandshakeMillis / stats.fullHandshakes;
+	const double resumedHandshake = stats.resumedHandshakeMillis / stats.resumedHandshakes;
+
+	std::printf("RTHandshakeBenchmark: full handshake %.2f ms (connection setup %.2f ms), resumed handshake %.2f ms "
+		"(connection setup %.2f ms), over %d connections each\n",
+		fullHandshake, setupMillis[0] / (connections / 2), resumedHandshake, setupMillis[1] / (connections / 2), connections / 2);
+
+	GS_TEST_CHECK(stats.failedHandshakes == 0);
+	GS_TEST_CHECK(stats.fullHandshakes == connections / 2);
+	GS_TEST_CHECK(stats.resumedHandshakes == connections / 2);
+	GS_TEST_CHECK(resumedHandshake < fullHandshake);
+
+	TLSSessionCache::clear();
+	return true;
+}
@@ -0,0 +1,142 @@
+#include "Tests.hpp"
+
+#include <GameSparksRT/PeerSequenceTable.hpp>
+#include <GameSparksRT/RTSessionImpl.hpp>
+
+#include <chrono>
+#include <random>
+#include <utility>
+
+using namespace GameSparks::RT;
+
+namespace {
+
+	/// what RTSessionImpl::ShouldExecute() did before the table
+	class MapSequences
+	{
+		public:
+			bool Accept(int peerId, const System::Nullable<int>& sequence)
+			{
+				if (!sequence.HasValue())
+				{
+					return true;
+				}
+				if (peerMaxSequenceNumbers.count(peerId) == 0)
+				{
+					peerMaxSequenceNumbers[peerId] = 0;
+				}
+				if (peerMaxSequenceNumbers[peerId] > sequence.Value())
+				{
+					return false;
+				}
+				peerMaxSequenceNumbers[peerId] = sequence.Value();
+				return true;
+			}
+		private:
+			gsstl::map<int, int> peerMaxSequenceNumbers;
+	};
+
+	/// the table as the session uses it: RTSessionImpl::ShouldExecute() locks it, the connections call it from their threads
+	class SessionSequences
+	{
+		public:
+			SessionSequences() : session(static_cast<RTSessionImpl*>(GameSparksRTSessionBuilder().Build())) {}
+
+			bool Accept(int peerId, const System::Nullable<int>& sequence)
+			{
+				return session->ShouldExecute(peerId, sequence);
+			}
+		private:
+			gsstl::unique_ptr<RTSessionImpl> session;
+	};
+
+	struct Arrival
+	{
+		int peerId;
+		System::Nullable<int> sequence;
+	};
+
+	/// packets of 64 peers, interleaved, one in 16 overtaken by the next of the same peer
+	gsstl::vector<Arrival> Arrivals(int rounds)
+	{
+		const int peers = 64;
+		std::mt19937 rng(9);
+		gsstl::vector<Arrival> arrivals;
+		arrivals.reserve(size_t(rounds) * peers);
+		for (int round = 0; round != rounds; ++round)
+		{
+			for (int peer = 1; peer <= peers; ++peer)
+			{
+				Arrival arrival = {peer, System::Nullable<int>(round + 1)};
+				arrivals.push_back(arrival);
+			}
+		}
+		for (size_t i = peers; i < arrivals.size(); i += peers)
+		{
+			if (rng() % 16 == 0)
+			{
+				std::swap(arrivals[i - peers], arrivals[i]);
+			}
+		}
+		return arrivals;
+	}
+
+	template <typename Sequences>
+	double NanosecondsPerPacket(const gsstl::vector<Arrival>& arrivals, int repeats, long long& accepted)
+	{
+		accepted = 0;
+		std::chrono::steady_clock::duration elapsed(0);
+		for (int repeat = 0; repeat != repeats; ++repeat)
+		{
+			Sequences sequences;
+			const auto start = std::chrono::steady_clock::now();
+			for (size_t i = 0; i != arrivals.size(); ++i)
+			{
+				accepted += sequences.Accept(arrivals[i].peerId, arrivals[i].sequence) ? 1 : 0;
+			}
+			elapsed += std::chrono::steady_clock::now() - start;
+		}
+		return std::chrono::duration<double, std::nano>(elapsed).count() / (double(repeats) * arrivals.size());
+	}
+
+}
+
+GS_TEST(RTPeerSequenceBenchmark)
+{
+	const gsstl::vector<Arrival> arrivals = Arrivals(4096);
+	const int repeats = 10;
+
+	long long tableAccepted = 0, sessionAccepted = 0, mapAccepted = 0;
+	const double table = NanosecondsPerPacket<PeerSequenceTable>(arrivals, repeats, tableAccepted);
+	const double session = NanosecondsPerPacket<SessionSequences>(arrivals, repeats, sessionAccepted);
+	const double map = NanosecondsPerPacket<MapSequences>(arrivals, repeats, mapAccepted);
+	std::printf("64 peers: table %.2f ns/packet, ShouldExecute() with the table %.2f ns/packet, std::map %.2f ns/packet\n", table, session, map);
+
+	GS_TEST_CHECK(tableAccepted == mapAccepted);
+	GS_TEST_CHECK(sessionAccepted == mapAccepted);
+	GS_TEST_CHECK(tableAccepted < (long long)arrivals.size() * repeats);
+	return true;
+}
+
+GS_TEST(RTPeerSequenceWrapsAround)
+{
+	PeerSequenceTable table;
+	GS_TEST_CHECK(table.Accept(1, System::Nullable<int>(2147483646)));
+	GS_TEST_CHECK(table.Accept(1, System::Nullable<int>(2147483647)));
+	GS_TEST_CHECK(table.Accept(1, System::Nullable<int>(-2147483647 - 1)));
+	GS_TEST_CHECK(table.Accept(1, System::Nullable<int>(-2147483647 + 1))); // skips one
+	GS_TEST_CHECK(!table.Accept(1, System::Nullable<int>(2147483647)));
+	GS_TEST_CHECK(table.Accept(1, System::Nullable<int>()));
+
+	RTPeerStats stats;
+	GS_TEST_CHECK(table.GetStats(1, stats));
+	GS_TEST_CHECK(stats.packetsReceived == 6);
+	GS_TEST_CHECK(stats.sequencedReceived == 4);
+	GS_TEST_CHECK(stats.sequencedDiscarded == 1);
+	GS_TEST_CHECK(stats.sequenceGaps == 1);
+
+	table.Reset(1);
+	GS_TEST_CHECK(!table.GetStats(1, stats));
+	GS_TEST_CHECK(table.Accept(1, System::Nullable<int>(0)));
+	return true;
+}
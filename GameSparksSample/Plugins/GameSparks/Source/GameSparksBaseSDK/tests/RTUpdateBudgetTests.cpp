@@ -0,0 +1,200 @@
+#include "Tests.hpp"
+
+#include <GameSparksRT/RTSessionImpl.hpp>
+#include <GameSparksRT/IRTSessionListener.hpp>
+#include <GameSparksRT/Commands/CustomCommand.hpp>
+#include <GameSparksRT/Commands/Results/PlayerDisconnectMessage.hpp>
+#include <GameSparksRT/Proto/Packet.hpp>
+
+#include <vector>
+
+using namespace GameSparks::RT;
+
+namespace {
+
+	/// what reached the listener, in order. disconnects are recorded with opCode -1.
+	struct Event
+	{
+		int opCode;
+		int sender;
+		int value;
+
+		bool operator==(const Event& other) const { return opCode == other.opCode && sender == other.sender && value == other.value; }
+	};
+
+	class Recorder : public IRTSessionListener
+	{
+		public:
+			std::vector<Event> events;
+
+			virtual void OnPlayerConnect(int) override {}
+			virtual void OnPlayerDisconnect(int peerId) override { events.push_back(Event{-1, peerId, 0}); }
+			virtual void OnReady(bool) override {}
+			virtual void OnPacket(const RTPacket& packet) override
+			{
+				events.push_back(Event{packet.OpCode, packet.Sender, packet.Data.GetInt(1).Value()});
+			}
+	};
+
+	gsstl::unique_ptr<RTSessionImpl> Build(GameSparksRTSessionBuilder& builder, Recorder& recorder)
+	{
+		gsstl::unique_ptr<RTSessionImpl> session(static_cast<RTSessionImpl*>(builder.SetListener(&recorder).Build()));
+		// OnPlayerDisconnect() only reaches the listener of a ready session
+		session->Ready = true;
+		return session;
+	}
+
+	/// hands a message to the session the way the connections do
+	void Receive(RTSessionImpl& session, int sender, int opCode, int value, bool sequenced = false)
+	{
+		RTData data;
+		data.SetInt(1, value);
+		System::IO::MemoryStream empty;
+		gsstl::unique_ptr<IRTCommand> command(CustomCommand::Deserialize(opCode, sender, empty, data, 0, session).GetResult());
+		session.SubmitAction(command, sequenced);
+	}
+
+	void ReceiveDisconnect(RTSessionImpl& session, const Proto::Packet& packet, int peerId)
+	{
+		Com::Gamesparks::Realtime::Proto::PlayerDisconnectMessage* message = new Com::Gamesparks::Realtime::Proto::PlayerDisconnectMessage();
+		message->PeerId = peerId;
+		message->Configure(packet, session);
+		gsstl::unique_ptr<IRTCommand> command(message);
+		session.SubmitAction(command);
+	}
+
+}
+
+// the messages left over by one Update() are delivered first by the next ones, in the order they arrived
+GS_TEST(RTUpdateBudgetCarriesOver)
+{
+	Recorder recorder;
+	GameSparksRTSessionBuilder builder;
+	gsstl::unique_ptr<RTSessionImpl> session = Build(builder.SetUpdateBudget(10), recorder);
+
+	for (int i = 0; i != 25; ++i)
+	{
+		Receive(*session, 2, 1, i);
+	}
+
+	session->Update();
+	GS_TEST_CHECK(recorder.events.size() == 10);
+	session->Update();
+	GS_TEST_CHECK(recorder.events.size() == 20);
+
+	// more arrive while some are waiting, they queue up behind them
+	for (int i = 25; i != 30; ++i)
+	{
+		Receive(*session, 2, 1, i);
+	}
+	session->Update();
+	GS_TEST_CHECK(recorder.events.size() == 30);
+	session->Update();
+	GS_TEST_CHECK(recorder.events.size() == 30);
+
+	for (int i = 0; i != 30; ++i)
+	{
+		GS_TEST_CHECK(recorder.events[i] == (Event{1, 2, i}));
+	}
+	return true;
+}
+
+// a waiting sequenced message is replaced by a newer one of the same sender and opCode only. other senders, other
+// opCodes and messages that are not sequenced are all delivered.
+GS_TEST(RTUpdateBudgetCollapsesPerSenderAndOpCode)
+{
+	Recorder recorder;
+	GameSparksRTSessionBuilder builder;
+	gsstl::unique_ptr<RTSessionImpl> session = Build(builder.SetUpdateBudget(1).EnableSequencedCollapse(), recorder);
+
+	for (int i = 0; i != 5; ++i)
+	{
+		Receive(*session, 2, 1, i, true);
+		Receive(*session, 3, 1, 10 + i, true);
+		Receive(*session, 2, 7, 20 + i, true);
+	}
+	Receive(*session, 2, 1, 30);
+	Receive(*session, 2, 1, 31);
+
+	for (int i = 0; i != 10; ++i)
+	{
+		session->Update();
+	}
+
+	const std::vector<Event> expected = {
+		Event{1, 2, 4},
+		Event{1, 3, 14},
+		Event{7, 2, 24},
+		Event{1, 2, 30},
+		Event{1, 2, 31},
+	};
+	GS_TEST_CHECK(recorder.events == expected);
+
+	// once delivered, the next message of a key is queued again
+	Receive(*session, 2, 1, 5, true);
+	session->Update();
+	GS_TEST_CHECK(recorder.events.size() == 6);
+	GS_TEST_CHECK(recorder.events.back() == (Event{1, 2, 5}));
+	return true;
+}
+
+// without a budget, the commands that drive the connection state are not moved ahead: the listener sees the messages
+// of a peer that arrived before its disconnect, then the disconnect, in arrival order.
+GS_TEST(RTUpdateWithoutBudgetKeepsArrivalOrder)
+{
+	Recorder recorder;
+	GameSparksRTSessionBuilder builder;
+	gsstl::unique_ptr<RTSessionImpl> session = Build(builder, recorder);
+	Proto::Packet packet(*session);
+
+	Receive(*session, 3, 1, 0);
+	Receive(*session, 2, 1, 1);
+	ReceiveDisconnect(*session, packet, 3);
+	Receive(*session, 2, 1, 2);
+
+	session->Update();
+
+	const std::vector<Event> expected = {
+		Event{1, 3, 0},
+		Event{1, 2, 1},
+		Event{-1, 3, 0},
+		Event{1, 2, 2},
+	};
+	GS_TEST_CHECK(recorder.events == expected);
+	return true;
+}
+
+// with a budget, the disconnect of a peer is run ahead of the messages waiting for the listener. its messages are
+// dropped then, so that none of them reaches the listener after OnPlayerDisconnect().
+GS_TEST(RTUpdateBudgetDropsMessagesOfDisconnectedPeer)
+{
+	Recorder recorder;
+	GameSparksRTSessionBuilder builder;
+	gsstl::unique_ptr<RTSessionImpl> session = Build(builder.SetUpdateBudget(1).EnableSequencedCollapse(), recorder);
+	Proto::Packet packet(*session);
+
+	Receive(*session, 3, 1, 0);
+	Receive(*session, 2, 1, 1);
+	Receive(*session, 3, 1, 2, true);
+	Receive(*session, 2, 1, 3);
+	ReceiveDisconnect(*session, packet, 3);
+
+	for (int i = 0; i != 5; ++i)
+	{
+		session->Update();
+	}
+
+	const std::vector<Event> expected = {
+		Event{-1, 3, 0},
+		Event{1, 2, 1},
+		Event{1, 2, 3},
+	};
+	GS_TEST_CHECK(recorder.events == expected);
+
+	// a sequenced message of the peer after it reconnected is not mistaken for a queued one
+	Receive(*session, 3, 1, 4, true);
+	session->Update();
+	GS_TEST_CHECK(recorder.events.size() == 4);
+	GS_TEST_CHECK(recorder.events.back() == (Event{1, 3, 4}));
+	return true;
+}
@@ -0,0 +1,217 @@
+#include "Tests.hpp"
+
+#include <GameSparksRT/IRTCommand.hpp>
+#include <GameSparksRT/Proto/Packet.hpp>
+#include <GameSparksRT/Proto/PositionStream.hpp>
+#include <GameSparksRT/Proto/ProtocolParser.hpp>
+#include <GameSparksRT/Proto/ReusableBinaryWriter.hpp>
+#include <GameSparksRT/Proto/Varint.hpp>
+
+#include <chrono>
+#include <random>
+#include <string>
+
+using namespace GameSparks::RT;
+using namespace GameSparks::RT::Proto;
+
+namespace {
+
+	/// a stream without ReadSpan(), so that the parsers read one byte per virtual call, as they did before the span primitives
+	class ByteStream : public System::IO::Stream
+	{
+		public:
+			explicit ByteStream(System::IO::MemoryStream& stream_) : stream(stream_) {}
+
+			virtual System::Failable<int> ReadByte() override { return stream.ReadByte(); }
+			virtual System::Failable<int> Read(System::Bytes& buffer, int offset, int count) override { return stream.Read(buffer, offset, count); }
+			virtual int Position() const override { return stream.Position(); }
+			virtual System::Failable<void> Position(const int pos) override { return stream.Position(pos); }
+			virtual bool CanRead() const override { return true; }
+		private:
+			System::IO::MemoryStream& stream;
+	};
+
+	/// half of them take a single byte, like most opCodes, sizes and slot indices do
+	gsstl::vector<uint64_t> Values(int count)
+	{
+		std::mt19937_64 rng(7);
+		gsstl::vector<uint64_t> values;
+		for (int i = 0; i != count; ++i)
+		{
+			values.push_back(i % 2 == 0 ? rng() % 128 : rng() >> (rng() % 64));
+		}
+		return values;
+	}
+
+	RTData RandomData(std::mt19937& rng)
+	{
+		RTData data;
+		for (int i = int(rng() % 8); i > 0; --i)
+		{
+			const unsigned index = 1 + rng() % 120;
+			switch (rng() % 4)
+			{
+				case 0: data.SetLong(index, int64_t(rng()) << (rng() % 32)); break;
+				case 1: data.SetFloat(index, float(rng()) / 7.0f); break;
+				case 2: data.SetString(index, std::string(1 + rng() % 40, char('a' + rng() % 26))); break;
+				default: data.SetRTVector(index, RTVector(1.5f, 2.5f, -3.0f)); break;
+			}
+		}
+		return data;
+	}
+
+	typedef std::chrono::steady_clock Clock;
+
+	double Nanoseconds(const Clock::time_point& start, double count)
+	{
+		return std::chrono::duration<double, std::nano>(Clock::now() - start).count() / count;
+	}
+
+}
+
+GS_TEST(RTVarintBenchmark)
+{
+	const gsstl::vector<uint64_t> values = Values(100000);
+	const int rounds = 10;
+
+	BinaryWriteMemoryStream stream;
+	for (size_t i = 0; i != values.size(); ++i)
+	{
+		ProtocolParser::WriteUInt64(stream, values[i]);
+	}
+	const int size = stream.Position();
+	const Varint::byte* begin = stream.GetBuffer().data();
+
+	int wrong = 0;
+	ByteStream bytes(stream);
+	Clock::time_point start = Clock::now();
+	for (int round = 0; round != rounds; ++round)
+	{
+		stream.Position(0);
+		for (size_t i = 0; i != values.size(); ++i)
+		{
+			const System::Failable<uint64_t> value = ProtocolParser::ReadUInt64(bytes);
+			wrong += value.isOK() && value.GetResult() == values[i] ? 0 : 1;
+		}
+	}
+	const double byteStream = Nanoseconds(start, double(rounds) * values.size());
+
+	start = Clock::now();
+	for (int round = 0; round != rounds; ++round)
+	{
+		stream.Position(0);
+		for (size_t i = 0; i != values.size(); ++i)
+		{
+			const System::Failable<uint64_t> value = ProtocolParser::ReadUInt64(stream);
+			wrong += value.isOK() && value.GetResult() == values[i] ? 0 : 1;
+		}
+	}
+	const double inPlace = Nanoseconds(start, double(rounds) * values.size());
+
+	start = Clock::now();
+	for (int round = 0; round != rounds; ++round)
+	{
+		const Varint::byte* pos = begin;
+		for (size_t i = 0; i != values.size(); ++i)
+		{
+			uint64_t value = 0;
+			wrong += Varint::ReadUInt64(pos, begin + size, value) == Varint::OK && value == values[i] ? 0 : 1;
+		}
+	}
+	const double span = Nanoseconds(start, double(rounds) * values.size());
+
+	std::printf("varint decode: %.2f ns through a byte stream, %.2f ns in place, %.2f ns on the span (branch reduced: %d)\n",
+		byteStream, inPlace, span, GS_RT_BRANCH_REDUCED_VARINT);
+	GS_TEST_CHECK(wrong == 0);
+	return true;
+}
+
+GS_TEST(RTVarintPacketBenchmark)
+{
+	std::mt19937 rng(7);
+	gsstl::vector<Packet> packets(2000);
+	BinaryWriteMemoryStream stream;
+	for (size_t i = 0; i != packets.size(); ++i)
+	{
+		Packet& p = packets[i];
+		p.OpCode = int(rng() % 200);
+		p.SequenceNumber = int(rng());
+		if (rng() % 2) p.Sender = int(rng() % 20);
+		p.Data = RandomData(rng);
+		GS_TEST_CHECK(Packet::SerializeLengthDelimited(stream, p).isOK());
+	}
+	const int end = stream.Position();
+
+	const int rounds = 10;
+	double nanoseconds[2];
+	for (int pass = 0; pass != 2; ++pass)
+	{
+		int wrong = 0;
+		const Clock::time_point start = Clock::now();
+		for (int round = 0; round != rounds; ++round)
+		{
+			stream.Position(0);
+			ByteStream bytes(stream);
+			PositionStream byteByByte(bytes);
+			for (size_t i = 0; i != packets.size(); ++i)
+			{
+				Packet p;
+				const System::Failable<void> ok = pass == 0
+					? Packet::DeserializeLengthDelimited(byteByByte, byteByByte.BinaryReader, p)
+					: Packet::DeserializeLengthDelimited(stream, stream.BinaryReader, p);
+				const Packet& q = packets[i];
+				wrong += ok.isOK() && p.OpCode == q.OpCode && p.SequenceNumber == q.SequenceNumber && p.Sender == q.Sender && p.Data == q.Data ? 0 : 1;
+			}
+		}
+		nanoseconds[pass] = Nanoseconds(start, double(rounds) * packets.size());
+		GS_TEST_CHECK(wrong == 0);
+		GS_TEST_CHECK(stream.Position() == end);
+	}
+
+	std::printf("packet decode: %.0f ns through a byte stream, %.0f ns in place\n", nanoseconds[0], nanoseconds[1]);
+	return true;
+}
+
+GS_TEST(RTVarintRejectsMalformedInput)
+{
+	// a 10 byte varint, cut off at every length
+	Varint::byte longest[Varint::MAX_VARINT64_SIZE];
+	Varint::byte* end = longest;
+	GS_TEST_CHECK(Varint::WriteUInt64(end, longest + sizeof(longest), ~0ULL));
+	GS_TEST_CHECK(end == longest + sizeof(longest));
+	for (int size = 0; size != Varint::MAX_VARINT64_SIZE; ++size)
+	{
+		const Varint::byte* pos = longest;
+		uint64_t value = 0;
+		GS_TEST_CHECK(Varint::ReadUInt64(pos, longest + size, value) == Varint::Truncated);
+		GS_TEST_CHECK(pos == longest);
+	}
+
+	// too large for 64 and for 32 bits
+	const Varint::byte tooLarge64[] = {0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x02, 0};
+	const Varint::byte* pos = tooLarge64;
+	uint64_t value64 = 0;
+	GS_TEST_CHECK(Varint::ReadUInt64(pos, tooLarge64 + sizeof(tooLarge64), value64) == Varint::Overflow);
+
+	const Varint::byte tooLarge32[] = {0xff, 0xff, 0xff, 0xff, 0x1f, 0, 0, 0, 0};
+	const Varint::byte largest32[] = {0xff, 0xff, 0xff, 0xff, 0x0f, 0, 0, 0, 0};
+	uint32_t value32 = 0;
+	pos = tooLarge32;
+	GS_TEST_CHECK(Varint::ReadUInt32(pos, tooLarge32 + sizeof(tooLarge32), value32) == Varint::Overflow);
+	pos = largest32;
+	GS_TEST_CHECK(Varint::ReadUInt32(pos, largest32 + sizeof(largest32), value32) == Varint::OK);
+	GS_TEST_CHECK(value32 == 0xffffffffu);
+
+	const int32_t zigZag[] = {0, 1, -1, 2147483647, -2147483647 - 1};
+	for (size_t i = 0; i != sizeof(zigZag) / sizeof(zigZag[0]); ++i)
+	{
+		GS_TEST_CHECK(Varint::DecodeZigZag32(Varint::EncodeZigZag32(zigZag[i])) == zigZag[i]);
+	}
+
+	// a writer leaves the span untouched, if the value does not fit
+	Varint::byte small[2];
+	Varint::byte* out = small;
+	GS_TEST_CHECK(!Varint::WriteUInt64(out, small + sizeof(small), 1ULL << 14));
+	GS_TEST_CHECK(out == small);
+	return true;
+}
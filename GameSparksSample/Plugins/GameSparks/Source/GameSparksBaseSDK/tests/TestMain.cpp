@@ -0,0 +1,64 @@
+#include "Tests.hpp"
+
+#include <GameSparksRT/GameSparksRT.hpp>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+namespace GameSparks { namespace Tests {
+
+	static std::vector<std::pair<const char*, TestFunction> >& registry()
+	{
+		static std::vector<std::pair<const char*, TestFunction> > tests;
+		return tests;
+	}
+
+	Registration::Registration(const char* name, TestFunction test)
+	{
+		registry().push_back(std::make_pair(name, test));
+	}
+
+	bool Fail(const char* file, int line, const char* expression)
+	{
+		std::printf("%s:%d: check failed: %s\n", file, line, expression);
+		return false;
+	}
+
+}} /* namespace GameSparks.Tests */
+
+/// runs the tests named on the command line, or all of them
+int main(int argc, char** argv)
+{
+	using namespace GameSparks::Tests;
+
+	// the sessions log every state change, that would bury the results
+	GameSparks::RT::GameSparksRT::Logger = [](const gsstl::string&) {};
+
+	int run = 0, failed = 0;
+	for (size_t i = 0; i != registry().size(); ++i)
+	{
+		const char* name = registry()[i].first;
+		bool selected = argc < 2;
+		for (int arg = 1; arg < argc; ++arg)
+		{
+			selected = selected || std::strcmp(argv[arg], name) == 0;
+		}
+		if (!selected)
+		{
+			continue;
+		}
+
+		std::printf("[ RUN  ] %s\n", name);
+		const bool ok = registry()[i].second();
+		std::printf("[ %s ] %s\n", ok ? " OK " : "FAIL", name);
+		++run;
+		failed += ok ? 0 : 1;
+	}
+
+	if (run == 0)
+	{
+		std::printf("no test matches the given names\n");
+		return 1;
+	}
+	return failed == 0 ? 0 : 1;
+}
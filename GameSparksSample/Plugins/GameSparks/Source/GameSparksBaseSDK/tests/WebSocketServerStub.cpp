@@ -0,0 +1,229 @@
+#include "WebSocketServerStub.hpp"
+
+#include <easywsclient/easywsclient.hpp>
+#include <mbedtls/ssl.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+
+namespace GameSparks { namespace Tests {
+
+	namespace {
+
+		std::atomic<WebSocketServerStub*> installed(nullptr);
+
+		const char upgradeResponse[] =
+			"HTTP/1.1 101 Switching Protocols\r\n"
+			"Upgrade: websocket\r\n"
+			"Connection: Upgrade\r\n"
+			"\r\n";
+
+	}
+
+	/// a client connection to the stub. easywsclient owns it, so it may outlive the stub, but it is not used then.
+	class WebSocketServerStub::Socket : public BaseSocket
+	{
+		public:
+			explicit Socket(WebSocketServerStub& server) : server(server) {}
+
+			virtual bool connect(const char*, short) override { return true; }
+			virtual void close() override {}
+			virtual void set_blocking(bool) override {}
+			virtual void abort() override {}
+
+			virtual int send(const char* buf, size_t siz) override
+			{
+				std::lock_guard<std::mutex> lock(server.lock);
+				if (server.limited)
+				{
+					siz = std::min(siz, server.sendBudget);
+					if (siz == 0)
+					{
+						return MBEDTLS_ERR_SSL_WANT_WRITE;
+					}
+					server.sendBudget -= siz;
+				}
+				server.Write(buf, siz);
+				return static_cast<int>(siz);
+			}
+
+			virtual int recv(char* buf, size_t siz) override
+			{
+				std::lock_guard<std::mutex> lock(server.lock);
+				return server.Read(buf, siz);
+			}
+
+		private:
+			WebSocketServerStub& server;
+	};
+
+	WebSocketServerStub::WebSocketServerStub()
+		: upgraded(false)
+		, limited(false)
+		, sendBudget(0)
+		, receivedBytes(0)
+	{
+		WebSocketServerStub* none = nullptr;
+		const bool first = installed.compare_exchange_strong(none, this);
+		assert(first && "only one WebSocketServerStub at a time");
+		(void)first;
+	}
+
+	WebSocketServerStub::~WebSocketServerStub()
+	{
+		installed = nullptr;
+	}
+
+	void WebSocketServerStub::LimitSend(std::size_t bytes)
+	{
+		std::lock_guard<std::mutex> guard(lock);
+		limited = true;
+		sendBudget = bytes;
+	}
+
+	std::vector<std::string> WebSocketServerStub::Frames(std::size_t first) const
+	{
+		std::lock_guard<std::mutex> guard(lock);
+		return std::vector<std::string>(frames.begin() + std::min(first, frames.size()), frames.end());
+	}
+
+	void WebSocketServerStub::Send(const std::string& payload)
+	{
+		std::lock_guard<std::mutex> guard(lock);
+		QueueFrame(payload);
+	}
+
+	std::size_t WebSocketServerStub::ReceivedBytes() const
+	{
+		std::lock_guard<std::mutex> guard(lock);
+		return receivedBytes;
+	}
+
+	void WebSocketServerStub::Write(const char* buf, std::size_t size)
+	{
+		if (!upgraded)
+		{
+			// easywsclient reads the response right after writing the request, on the same thread, so it has to be
+			// waiting by then. the nonce follows the upgrade like on the real server.
+			request.append(buf, size);
+			if (request.size() >= 4 && request.compare(request.size() - 4, 4, "\r\n\r\n") == 0)
+			{
+				upgraded = true;
+				outbox.insert(outbox.end(), upgradeResponse, upgradeResponse + sizeof(upgradeResponse) - 1);
+				QueueFrame("{\"@class\":\".AuthenticatedConnectResponse\",\"nonce\":\"1234567890\"}");
+			}
+			return;
+		}
+
+		receivedBytes += size;
+		inbox.insert(inbox.end(), buf, buf + size);
+		ParseFrames();
+	}
+
+	int WebSocketServerStub::Read(char* buf, std::size_t size)
+	{
+		if (outbox.empty())
+		{
+			return MBEDTLS_ERR_SSL_WANT_READ;
+		}
+		size = std::min(size, outbox.size());
+		std::copy(outbox.begin(), outbox.begin() + size, buf);
+		outbox.erase(outbox.begin(), outbox.begin() + size);
+		return static_cast<int>(size);
+	}
+
+	void WebSocketServerStub::ParseFrames()
+	{
+		for (;;)
+		{
+			if (inbox.size() < 2)
+			{
+				return;
+			}
+
+			std::size_t header = 2;
+			std::size_t length = inbox[1] & 0x7f;
+			if (length == 126)
+			{
+				header = 4;
+				if (inbox.size() < header) return;
+				length = (std::size_t(inbox[2]) << 8) | inbox[3];
+			}
+			else if (length == 127)
+			{
+				header = 10;
+				if (inbox.size() < header) return;
+				length = 0;
+				for (int i = 2; i != 10; ++i)
+				{
+					length = (length << 8) | inbox[i];
+				}
+			}
+
+			const bool masked = (inbox[1] & 0x80) != 0;
+			const std::size_t mask = header;
+			if (masked)
+			{
+				header += 4;
+			}
+
+			if (inbox.size() < header + length)
+			{
+				return;
+			}
+
+			std::string payload(inbox.begin() + header, inbox.begin() + header + length);
+			if (masked)
+			{
+				for (std::size_t i = 0; i != payload.size(); ++i)
+				{
+					payload[i] = static_cast<char>(payload[i] ^ inbox[mask + i % 4]);
+				}
+			}
+
+			// text frames only, GSConnection sends nothing else
+			if ((inbox[0] & 0x0f) == 0x1)
+			{
+				if (payload.find("\".AuthenticatedConnectRequest\"") != std::string::npos)
+				{
+					QueueFrame("{\"@class\":\".AuthenticatedConnectResponse\",\"sessionId\":\"stub\"}");
+				}
+				frames.push_back(payload);
+			}
+
+			inbox.erase(inbox.begin(), inbox.begin() + header + length);
+		}
+	}
+
+	void WebSocketServerStub::QueueFrame(const std::string& payload)
+	{
+		// unmasked, like frames from a server are
+		outbox.push_back(static_cast<char>(0x81));
+		if (payload.size() < 126)
+		{
+			outbox.push_back(static_cast<char>(payload.size()));
+		}
+		else
+		{
+			assert(payload.size() <= 0xffff);
+			outbox.push_back(static_cast<char>(126));
+			outbox.push_back(static_cast<char>(payload.size() >> 8));
+			outbox.push_back(static_cast<char>(payload.size() & 0xff));
+		}
+		outbox.insert(outbox.end(), payload.begin(), payload.end());
+	}
+
+}} /* namespace GameSparks.Tests */
+
+// there is no websocket socket for the desktop platforms the tests run on. the RT tests do not need one, everything
+// else talks to a WebSocketServerStub.
+BaseSocket* BaseSocket::create(bool /*secure*/)
+{
+	GameSparks::Tests::WebSocketServerStub* server = GameSparks::Tests::installed;
+	if (!server)
+	{
+		return 0;
+	}
+	return new GameSparks::Tests::WebSocketServerStub::Socket(*server);
+}
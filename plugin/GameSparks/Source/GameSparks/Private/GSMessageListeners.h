@@ -16,6 +16,10 @@ public:
     UGSMessageListeners();
     
     static void RegisterListeners(GS& GS);
+
+    /// registers this component with the module, so that messages are dispatched to it
+    virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
     
 	DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnAchievementEarnedMessage, FGSAchievementEarnedMessage, AchievementEarnedMessage);
 	UPROPERTY(BlueprintAssignable, Category = GameSparks)
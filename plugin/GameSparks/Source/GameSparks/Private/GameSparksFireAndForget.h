@@ -0,0 +1,32 @@
+#pragma once
+#include "GameSparksPrivatePCH.h"
+#include "Engine.h"
+#include "Kismet/BlueprintFunctionLibrary.h"
+#include "GameSparksLogEventData.h"
+#include "GameSparksScriptData.h"
+#include "GameSparksFireAndForget.generated.h"
+
+/**
+ Sends requests without a proxy object and without converting the response.
+
+ Meant for telemetry style requests that are sent many times a second and whose response is
+ of no interest. Unlike the "GS ...Request" nodes, these do not allocate any UObject per request.
+*/
+UCLASS()
+class GAMESPARKS_API UGameSparksFireAndForget : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	Sends a LogEventRequest and ignores the response.
+	*/
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "GS LogEvent (Fire and Forget)"), Category = "GameSparks|Requests|Player")
+	static void SendLogEvent(const FString& EventKey, UGameSparksLogEventData* LogEventData = nullptr, bool Durable = false);
+
+	/**
+	Sends an AnalyticsRequest and ignores the response.
+	*/
+	UFUNCTION(BlueprintCallable, meta = (DisplayName = "GS Analytics (Fire and Forget)"), Category = "GameSparks|Requests|Analytics")
+	static void SendAnalytics(const FString& Key, UGameSparksScriptData* Data = nullptr, bool Start = false, bool End = false, bool Durable = false);
+};
@@ -17,6 +17,10 @@
 #include "GameSparks/generated/GSMessages.h"
 #include "GameSparksUnrealPlatform.h"
 #include "GSMessageListeners.h"
+#include "GSMessageListenersObject.h"
+#include "GSApi.h"
+#include "GameSparksProxyPool.h"
+#include "GameSparksStats.h"
 #include <functional>
 
 using namespace GameSparks::Core;
@@ -30,6 +34,23 @@ IMPLEMENT_MODULE(UGameSparksModule, GameSparks);
 
 DEFINE_LOG_CATEGORY(UGameSparksModuleLog);
 
+DEFINE_STAT(STAT_GameSparksBusyTicks);
+DEFINE_STAT(STAT_GameSparksIdleTicks);
+DEFINE_STAT(STAT_GameSparksWebSocketPoll);
+DEFINE_STAT(STAT_GameSparksWebSocketDispatch);
+DEFINE_STAT(STAT_GameSparksJSONParse);
+DEFINE_STAT(STAT_GameSparksCallbackDispatch);
+DEFINE_STAT(STAT_GameSparksRTActionDrain);
+DEFINE_STAT(STAT_GameSparksRTPacketDecode);
+DEFINE_STAT(STAT_GameSparksStructConversion);
+DEFINE_STAT(STAT_GameSparksSendQueue);
+DEFINE_STAT(STAT_GameSparksPendingRequests);
+DEFINE_STAT(STAT_GameSparksDurableQueue);
+DEFINE_STAT(STAT_GameSparksReceivedQueue);
+DEFINE_STAT(STAT_GameSparksSendLanes);
+DEFINE_STAT(STAT_GameSparksWebSocketTxBytes);
+DEFINE_STAT(STAT_GameSparksWebSocketRxBytes);
+
 void GameSparksAvailable_Static(GameSparks::Core::GS& gsInstance, bool available)
 {
     UE_LOG(UGameSparksModuleLog, Warning, TEXT("%s"), TEXT("GameSparks::GameSparksAvailable_Static"));
@@ -46,6 +67,9 @@ void UGameSparksModule::StartupModule()
 
 void UGameSparksModule::ShutdownModule()
 {
+    TGameSparksProxyPool<UGSLogEventRequest>::Empty();
+    TGameSparksProxyPool<UGSAnalyticsRequest>::Empty();
+
     GS.ShutDown();
     delete this->platform;
     this->platform = nullptr;
@@ -64,11 +88,21 @@ bool UGameSparksModule::IsTickableInEditor() const
 
 void UGameSparksModule::Tick(float DeltaTime)
 {
-    GS.Update(DeltaTime);
+    INC_DWORD_STAT(STAT_GameSparksBusyTicks);
+
+    // frames might have been skipped while idle, so pass the time since the last update instead of DeltaTime
+    const double Now = FPlatformTime::Seconds();
+    GS.Update(LastUpdateTime > 0 ? GameSparks::Seconds(Now - LastUpdateTime) : DeltaTime);
+    LastUpdateTime = Now;
 }
 
 bool UGameSparksModule::IsTickable() const
 {
+    if (GS.GetTimeUntilUpdateRequired() > FPlatformTime::Seconds() - LastUpdateTime)
+    {
+        INC_DWORD_STAT(STAT_GameSparksIdleTicks);
+        return false;
+    }
     return true;
 }
 
@@ -135,6 +169,27 @@ UGameSparksModule* UGameSparksModule::GetModulePtr()
     return FModuleManager::GetModulePtr<UGameSparksModule>("GameSparks");
 }
 
+void UGameSparksModule::AddMessageListener(UGSMessageListeners* Listener)
+{
+    MessageListenerComponents.AddUnique(Listener);
+}
+
+void UGameSparksModule::RemoveMessageListener(UGSMessageListeners* Listener)
+{
+    // also drops entries of listeners that were garbage collected without EndPlay
+    MessageListenerComponents.RemoveAll([Listener](const TWeakObjectPtr<UGSMessageListeners>& Entry) { return !Entry.IsValid() || Entry.Get() == Listener; });
+}
+
+void UGameSparksModule::AddMessageListener(UGSMessageListenersObject* Listener)
+{
+    MessageListenerObjects.AddUnique(Listener);
+}
+
+void UGameSparksModule::RemoveMessageListener(UGSMessageListenersObject* Listener)
+{
+    MessageListenerObjects.RemoveAll([Listener](const TWeakObjectPtr<UGSMessageListenersObject>& Entry) { return !Entry.IsValid() || Entry.Get() == Listener; });
+}
+
 void UGameSparksModule::SendGameSparksAvailableToComponents(bool available)
 {
     for ( TObjectIterator<UGameSparksComponent> Itr; Itr; ++Itr )
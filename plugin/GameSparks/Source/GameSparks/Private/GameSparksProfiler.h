@@ -0,0 +1,27 @@
+#pragma once
+
+#include <GameSparks/GSProfiler.h>
+
+namespace GameSparks
+{
+	namespace UnrealEngineSDK
+	{
+		/**
+		 Forwards the scopes and counters of the SDK to the stats system, see GameSparksStats.h.
+
+		 The scopes are cycle stats and show up in "stat GameSparks" and, as named events, in Unreal Insights
+		 and the platform profilers. Without stats (e.g. in shipping builds) only the named events are emitted,
+		 if the engine has them enabled.
+		*/
+		class FGameSparksProfiler : public GameSparks::Core::IGSProfiler
+		{
+		public:
+			/// the profiler shared by the GS instance and all realtime sessions
+			static FGameSparksProfiler* Get();
+
+			void BeginScope(Scope scope) override;
+			void EndScope(Scope scope) override;
+			void SetCounter(Counter counter, long long value) override;
+		};
+	}
+}
@@ -0,0 +1,77 @@
+#pragma once
+
+#include "GameSparksPrivatePCH.h"
+#include "GameSparksModule.h"
+#include "Engine.h"
+
+/**
+ Recycles the proxy objects of Blueprint requests that are sent at a high frequency.
+
+ Once the response of a request was broadcast, the proxy is kept (rooted) in the pool and
+ handed out again by the next Send*Request call, instead of allocating a new UObject for
+ every request. The pool is bounded, proxies above the limit are left to the garbage collector.
+ Requests of the proxy that are still in flight, e.g. durable ones, are detached from it first, like the
+ destructor of the proxy does, so that their responses are not broadcast by the proxy's next user.
+*/
+template <typename ProxyType, int32 MaxPooledProxies = 16>
+class TGameSparksProxyPool
+{
+public:
+	/// returns a pooled proxy or a new one, if the pool is empty
+	static ProxyType* Acquire()
+	{
+		TArray<ProxyType*>& Pool = GetPool();
+		while (Pool.Num() > 0)
+		{
+			ProxyType* Proxy = Pool.Pop(false);
+			Proxy->RemoveFromRoot();
+			if (!Proxy->IsPendingKill())
+			{
+				return Proxy;
+			}
+		}
+		return NewObject<ProxyType>();
+	}
+
+	/// called after the response was broadcast. unbinds the delegates and keeps the proxy for reuse
+	static void Release(ProxyType* Proxy)
+	{
+		if (UGameSparksModule* Module = UGameSparksModule::GetModulePtr())
+		{
+			if (Module->IsInitialized())
+			{
+				Module->GetGSInstance().ChangeUserDataForRequests(Proxy, nullptr);
+			}
+		}
+
+		Proxy->OnResponse.Clear();
+		Proxy->ResetForReuse();
+
+		TArray<ProxyType*>& Pool = GetPool();
+		if (Pool.Num() >= MaxPooledProxies || Proxy->IsPendingKill() || Proxy->IsRooted())
+		{
+			return;
+		}
+
+		Proxy->AddToRoot();
+		Pool.Push(Proxy);
+	}
+
+	/// hands all pooled proxies back to the garbage collector
+	static void Empty()
+	{
+		TArray<ProxyType*>& Pool = GetPool();
+		for (ProxyType* Proxy : Pool)
+		{
+			Proxy->RemoveFromRoot();
+		}
+		Pool.Empty();
+	}
+
+private:
+	static TArray<ProxyType*>& GetPool()
+	{
+		static TArray<ProxyType*> Pool;
+		return Pool;
+	}
+};
@@ -0,0 +1,275 @@
+#include "GameSparksScriptDataView.h"
+#include "GameSparksPrivatePCH.h"
+#include "GameSparks/GSDateTime.h"
+
+using GameSparks::cJSON;
+
+namespace
+{
+	const cJSON* FindArray(const FGSScriptDataView& View, const FString& Name)
+	{
+		return View.Find(Name, cJSON_Array);
+	}
+}
+
+FGSScriptDataView FGSScriptDataView::FromGSData(const GameSparks::Core::GSData& Data)
+{
+	FGSScriptDataView View;
+	View.Tree = MakeShareable(new FGSScriptDataTree(GameSparks::cJSON_Duplicate(Data.GetBaseData(), 1)));
+	View.Node = View.Tree->Root;
+	return View;
+}
+
+const cJSON* FGSScriptDataView::Find(const FString& Name, int Type) const
+{
+	if (Node == nullptr || Node->type != cJSON_Object)
+	{
+		return nullptr;
+	}
+
+	const cJSON* Item = GameSparks::cJSON_GetObjectItem(const_cast<cJSON*>(Node), TCHAR_TO_UTF8(*Name));
+	if (Item == nullptr)
+	{
+		return nullptr;
+	}
+
+	// booleans are stored as two distinct types
+	if (Item->type == Type || (Type == cJSON_True && Item->type == cJSON_False))
+	{
+		return Item;
+	}
+	return nullptr;
+}
+
+FGSScriptDataView FGSScriptDataView::ViewOf(const cJSON* Child) const
+{
+	FGSScriptDataView View;
+	if (Child != nullptr)
+	{
+		View.Tree = Tree;
+		View.Node = Child;
+	}
+	return View;
+}
+
+FGSScriptDataView UGSScriptDataViewLibrary::MakeScriptDataView(UGameSparksScriptData* ScriptData)
+{
+	if (ScriptData == nullptr)
+	{
+		return FGSScriptDataView();
+	}
+	return FGSScriptDataView::FromGSData(ScriptData->ToRequestData());
+}
+
+UGameSparksScriptData* UGSScriptDataViewLibrary::ToScriptData(const FGSScriptDataView& View)
+{
+	UGameSparksScriptData* ScriptData = NewObject<UGameSparksScriptData>();
+	if (View.IsValid() && View.Node->type == cJSON_Object)
+	{
+		ScriptData->SetGSData(GameSparks::Core::GSData(const_cast<cJSON*>(View.Node)));
+	}
+	return ScriptData;
+}
+
+bool UGSScriptDataViewLibrary::IsValid(const FGSScriptDataView& View)
+{
+	return View.IsValid();
+}
+
+FString UGSScriptDataViewLibrary::ToJSONString(const FGSScriptDataView& View)
+{
+	if (!View.IsValid())
+	{
+		return FString();
+	}
+
+	char* Json = GameSparks::cJSON_PrintUnformatted(const_cast<cJSON*>(View.Node));
+	FString Result(UTF8_TO_TCHAR(Json));
+	free(Json);
+	return Result;
+}
+
+TArray<FString> UGSScriptDataViewLibrary::GetKeys(const FGSScriptDataView& View)
+{
+	TArray<FString> Keys;
+	if (View.IsValid() && View.Node->type == cJSON_Object)
+	{
+		for (const cJSON* Item = View.Node->child; Item != nullptr; Item = Item->next)
+		{
+			Keys.Add(FString(UTF8_TO_TCHAR(Item->string)));
+		}
+	}
+	return Keys;
+}
+
+bool UGSScriptDataViewLibrary::HasString(const FGSScriptDataView& View, const FString& Name)
+{
+	return View.Find(Name, cJSON_String) != nullptr;
+}
+
+FString UGSScriptDataViewLibrary::GetString(const FGSScriptDataView& View, const FString& Name)
+{
+	const cJSON* Item = View.Find(Name, cJSON_String);
+	return Item ? FString(UTF8_TO_TCHAR(Item->valuestring)) : FString();
+}
+
+bool UGSScriptDataViewLibrary::HasNumber(const FGSScriptDataView& View, const FString& Name)
+{
+	return View.Find(Name, cJSON_Number) != nullptr;
+}
+
+int32 UGSScriptDataViewLibrary::GetNumber(const FGSScriptDataView& View, const FString& Name)
+{
+	const cJSON* Item = View.Find(Name, cJSON_Number);
+	return Item ? Item->valueint : 0;
+}
+
+bool UGSScriptDataViewLibrary::HasFloat(const FGSScriptDataView& View, const FString& Name)
+{
+	return View.Find(Name, cJSON_Number) != nullptr;
+}
+
+float UGSScriptDataViewLibrary::GetFloat(const FGSScriptDataView& View, const FString& Name)
+{
+	const cJSON* Item = View.Find(Name, cJSON_Number);
+	return Item ? static_cast<float>(Item->valuedouble) : 0.0f;
+}
+
+bool UGSScriptDataViewLibrary::HasBoolean(const FGSScriptDataView& View, const FString& Name)
+{
+	return View.Find(Name, cJSON_True) != nullptr;
+}
+
+bool UGSScriptDataViewLibrary::GetBoolean(const FGSScriptDataView& View, const FString& Name)
+{
+	const cJSON* Item = View.Find(Name, cJSON_True);
+	return Item != nullptr && Item->type == cJSON_True;
+}
+
+bool UGSScriptDataViewLibrary::HasDateTime(const FGSScriptDataView& View, const FString& Name)
+{
+	return View.Find(Name, cJSON_String) != nullptr;
+}
+
+FDateTime UGSScriptDataViewLibrary::GetDateTime(const FGSScriptDataView& View, const FString& Name)
+{
+	const cJSON* Item = View.Find(Name, cJSON_String);
+	if (Item == nullptr)
+	{
+		return FDateTime();
+	}
+
+	GameSparks::Core::GSDateTime DateTime(Item->valuestring);
+	return FDateTime(DateTime.GetYear(), DateTime.GetMonth(), DateTime.GetDay(), DateTime.GetHour(), DateTime.GetMinute(), DateTime.GetSecond());
+}
+
+bool UGSScriptDataViewLibrary::HasGSData(const FGSScriptDataView& View, const FString& Name)
+{
+	return View.Find(Name, cJSON_Object) != nullptr;
+}
+
+FGSScriptDataView UGSScriptDataViewLibrary::GetGSData(const FGSScriptDataView& View, const FString& Name)
+{
+	return View.ViewOf(View.Find(Name, cJSON_Object));
+}
+
+bool UGSScriptDataViewLibrary::HasArray(const FGSScriptDataView& View, const FString& Name)
+{
+	const cJSON* Array = FindArray(View, Name);
+	return Array != nullptr && Array->child != nullptr;
+}
+
+int32 UGSScriptDataViewLibrary::GetArrayNum(const FGSScriptDataView& View, const FString& Name)
+{
+	int32 Num = 0;
+	if (const cJSON* Array = FindArray(View, Name))
+	{
+		for (const cJSON* Item = Array->child; Item != nullptr; Item = Item->next)
+		{
+			++Num;
+		}
+	}
+	return Num;
+}
+
+FGSScriptDataView UGSScriptDataViewLibrary::GetGSDataArrayItem(const FGSScriptDataView& View, const FString& Name, int32 Index)
+{
+	if (const cJSON* Array = FindArray(View, Name))
+	{
+		const cJSON* Item = Array->child;
+		for (int32 i = 0; Item != nullptr && i < Index; ++i)
+		{
+			Item = Item->next;
+		}
+
+		if (Index >= 0 && Item != nullptr && Item->type == cJSON_Object)
+		{
+			return View.ViewOf(Item);
+		}
+	}
+	return FGSScriptDataView();
+}
+
+TArray<FGSScriptDataView> UGSScriptDataViewLibrary::GetGSDataArray(const FGSScriptDataView& View, const FString& Name)
+{
+	TArray<FGSScriptDataView> Result;
+	if (const cJSON* Array = FindArray(View, Name))
+	{
+		for (const cJSON* Item = Array->child; Item != nullptr; Item = Item->next)
+		{
+			if (Item->type == cJSON_Object)
+			{
+				Result.Add(View.ViewOf(Item));
+			}
+		}
+	}
+	return Result;
+}
+
+TArray<FString> UGSScriptDataViewLibrary::GetStringArray(const FGSScriptDataView& View, const FString& Name)
+{
+	TArray<FString> Result;
+	if (const cJSON* Array = FindArray(View, Name))
+	{
+		for (const cJSON* Item = Array->child; Item != nullptr; Item = Item->next)
+		{
+			if (Item->type == cJSON_String)
+			{
+				Result.Add(FString(UTF8_TO_TCHAR(Item->valuestring)));
+			}
+		}
+	}
+	return Result;
+}
+
+TArray<int32> UGSScriptDataViewLibrary::GetNumberArray(const FGSScriptDataView& View, const FString& Name)
+{
+	TArray<int32> Result;
+	if (const cJSON* Array = FindArray(View, Name))
+	{
+		for (const cJSON* Item = Array->child; Item != nullptr; Item = Item->next)
+		{
+			if (Item->type == cJSON_Number)
+			{
+				Result.Add(Item->valueint);
+			}
+		}
+	}
+	return Result;
+}
+
+TArray<float> UGSScriptDataViewLibrary::GetFloatArray(const FGSScriptDataView& View, const FString& Name)
+{
+	TArray<float> Result;
+	if (const cJSON* Array = FindArray(View, Name))
+	{
+		for (const cJSON* Item = Array->child; Item != nullptr; Item = Item->next)
+		{
+			if (Item->type == cJSON_Number)
+			{
+				Result.Add(static_cast<float>(Item->valuedouble));
+			}
+		}
+	}
+	return Result;
+}
@@ -0,0 +1,43 @@
+#pragma once
+
+#include "GameSparksPrivatePCH.h"
+#include "Engine.h"
+
+/**
+ Stats of the GameSparks plugin, shown by "stat GameSparks".
+*/
+DECLARE_STATS_GROUP(TEXT("GameSparks"), STATGROUP_GameSparks, STATCAT_Advanced);
+
+/// frames in which GS::Update() or IRTSession::Update() was called, because there was work to do
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Ticks with work"), STAT_GameSparksBusyTicks, STATGROUP_GameSparks, );
+
+/// frames in which the update was skipped, because the SDK was idle
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Idle ticks"), STAT_GameSparksIdleTicks, STATGROUP_GameSparks, );
+
+/// timing scopes of the SDK, reported through FGameSparksProfiler
+DECLARE_CYCLE_STAT_EXTERN(TEXT("WebSocket poll"), STAT_GameSparksWebSocketPoll, STATGROUP_GameSparks, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("WebSocket dispatch"), STAT_GameSparksWebSocketDispatch, STATGROUP_GameSparks, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("JSON parse"), STAT_GameSparksJSONParse, STATGROUP_GameSparks, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Callback dispatch"), STAT_GameSparksCallbackDispatch, STATGROUP_GameSparks, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("RT action drain"), STAT_GameSparksRTActionDrain, STATGROUP_GameSparks, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("RT packet decode"), STAT_GameSparksRTPacketDecode, STATGROUP_GameSparks, );
+
+/// conversion of responses and messages into FGS* structs
+DECLARE_CYCLE_STAT_EXTERN(TEXT("FGS struct conversion"), STAT_GameSparksStructConversion, STATGROUP_GameSparks, );
+
+/// queue sizes, sampled once per GS::Update()
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Send queue"), STAT_GameSparksSendQueue, STATGROUP_GameSparks, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Pending requests"), STAT_GameSparksPendingRequests, STATGROUP_GameSparks, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Durable queue"), STAT_GameSparksDurableQueue, STATGROUP_GameSparks, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Received queue"), STAT_GameSparksReceivedQueue, STATGROUP_GameSparks, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Send lanes"), STAT_GameSparksSendLanes, STATGROUP_GameSparks, );
+DECLARE_MEMORY_STAT_EXTERN(TEXT("WebSocket send buffer"), STAT_GameSparksWebSocketTxBytes, STATGROUP_GameSparks, );
+DECLARE_MEMORY_STAT_EXTERN(TEXT("WebSocket receive buffer"), STAT_GameSparksWebSocketRxBytes, STATGROUP_GameSparks, );
+
+/// converts a response or message of the core SDK into its FGS* struct
+template <typename StructType, typename SourceType>
+StructType ToUnrealStruct(const SourceType& Source)
+{
+	SCOPE_CYCLE_COUNTER(STAT_GameSparksStructConversion);
+	return StructType(Source.GetBaseData());
+}
@@ -0,0 +1,125 @@
+#include "FGSRTData.h"
+#include "../GameSparksPrivatePCH.h"
+#include "Engine.h"
+#include "GameSparksClasses.h"
+
+FGSRTData UGSRTDataLibrary::MakeRTDataStruct(UGSRTData* Data)
+{
+	FGSRTData ret;
+	if (Data)
+	{
+		ret.Data = Data->GetRTData();
+	}
+	return ret;
+}
+
+UGSRTData* UGSRTDataLibrary::ToRTDataObject(const FGSRTData& Data)
+{
+	UGSRTData* ret = NewObject<UGSRTData>();
+	ret->SetRTData(Data.Data);
+	return ret;
+}
+
+bool UGSRTDataLibrary::HasInt(const FGSRTData& Data, int32 Index)
+{
+	if (!UGSRTData::IsValidIndex(Index)) return{};
+	return Data.Data.GetInt(Index).HasValue();
+}
+
+bool UGSRTDataLibrary::HasVector(const FGSRTData& Data, int32 Index)
+{
+	if (!UGSRTData::IsValidIndex(Index)) return{};
+	return Data.Data.GetRTVector(Index).HasValue();
+}
+
+bool UGSRTDataLibrary::HasFloat(const FGSRTData& Data, int32 Index)
+{
+	if (!UGSRTData::IsValidIndex(Index)) return{};
+	return Data.Data.GetFloat(Index).HasValue();
+}
+
+bool UGSRTDataLibrary::HasString(const FGSRTData& Data, int32 Index)
+{
+	if (!UGSRTData::IsValidIndex(Index)) return{};
+	return Data.Data.GetString(Index).HasValue();
+}
+
+bool UGSRTDataLibrary::HasData(const FGSRTData& Data, int32 Index)
+{
+	if (!UGSRTData::IsValidIndex(Index)) return{};
+	return Data.Data.GetData(Index).HasValue();
+}
+
+int32 UGSRTDataLibrary::GetInt(const FGSRTData& Data, int32 Index)
+{
+	if (!UGSRTData::IsValidIndex(Index)) return{};
+	return Data.Data.GetInt(Index).GetValueOrDefault(0);
+}
+
+FVector UGSRTDataLibrary::GetFVector(const FGSRTData& Data, int32 Index)
+{
+	if (!UGSRTData::IsValidIndex(Index)) return{};
+	auto v = Data.Data.GetRTVector(Index).GetValueOrDefault(GameSparks::RT::RTVector());
+	return FVector(
+		v.x.GetValueOrDefault(0.0f),
+		v.y.GetValueOrDefault(0.0f),
+		v.z.GetValueOrDefault(0.0f)
+	);
+}
+
+float UGSRTDataLibrary::GetFloat(const FGSRTData& Data, int32 Index)
+{
+	if (!UGSRTData::IsValidIndex(Index)) return{};
+	return Data.Data.GetFloat(Index).GetValueOrDefault(0.0f);
+}
+
+FString UGSRTDataLibrary::GetString(const FGSRTData& Data, int32 Index)
+{
+	if (!UGSRTData::IsValidIndex(Index)) return{};
+	return FString(UTF8_TO_TCHAR(Data.Data.GetString(Index).GetValueOrDefault("").c_str()));
+}
+
+FGSRTData UGSRTDataLibrary::GetData(const FGSRTData& Data, int32 Index)
+{
+	FGSRTData ret;
+	if (!UGSRTData::IsValidIndex(Index)) return ret;
+	ret.Data = Data.Data.GetData(Index).GetValueOrDefault(GameSparks::RT::RTData());
+	return ret;
+}
+
+void UGSRTDataLibrary::SetInt(FGSRTData& Data, int32 Index, int32 Value)
+{
+	if (!UGSRTData::IsValidIndex(Index)) return;
+	Data.Data.SetInt(Index, Value);
+}
+
+void UGSRTDataLibrary::SetFVector(FGSRTData& Data, int32 Index, const FVector& Value)
+{
+	if (!UGSRTData::IsValidIndex(Index)) return;
+	Data.Data.SetRTVector(Index, {Value.X, Value.Y, Value.Z});
+}
+
+void UGSRTDataLibrary::SetFloat(FGSRTData& Data, int32 Index, float Value)
+{
+	if (!UGSRTData::IsValidIndex(Index)) return;
+	Data.Data.SetFloat(Index, Value);
+}
+
+void UGSRTDataLibrary::SetString(FGSRTData& Data, int32 Index, const FString& Value)
+{
+	if (!UGSRTData::IsValidIndex(Index)) return;
+	Data.Data.SetString(Index, TCHAR_TO_UTF8(*Value));
+}
+
+void UGSRTDataLibrary::SetData(FGSRTData& Data, int32 Index, const FGSRTData& Value)
+{
+	if (!UGSRTData::IsValidIndex(Index)) return;
+	Data.Data.SetData(Index, Value.Data);
+}
+
+FString UGSRTDataLibrary::ToString(const FGSRTData& Data)
+{
+	gsstl::stringstream ss;
+	ss << Data.Data;
+	return FString(UTF8_TO_TCHAR(ss.str().c_str()));
+}
@@ -0,0 +1,78 @@
+#pragma once
+#include "../GameSparksPrivatePCH.h"
+#include "Engine.h"
+#include "Kismet/BlueprintFunctionLibrary.h"
+
+#if !defined(GS_BUILDING_DLL)
+#       define GS_BUILDING_DLL 1
+#endif /* !defined(GS_BUILDING_DLL) */
+
+#include <GameSparksRT/RTData.hpp>
+#include "UGSRTData.h"
+#include "FGSRTData.generated.h"
+
+/**
+ Value type equivalent of UGSRTData.
+
+ Unlike UGSRTData it is not a UObject, so building a packet in Blueprint does not create
+ objects for the garbage collector. Pass it by reference to the setters of UGSRTDataLibrary
+ and send it via UGSRTSession::SendRTData().
+*/
+USTRUCT(BlueprintType)
+struct FGSRTData
+{
+	GENERATED_USTRUCT_BODY()
+
+	GameSparks::RT::RTData Data;
+};
+
+UCLASS()
+class UGSRTDataLibrary : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	/** Copies the content of a GS RT Data object into a struct. */
+	UFUNCTION(BlueprintPure, Category = "GameSparksRT|Data Struct")
+	static FGSRTData MakeRTDataStruct(UGSRTData* Data);
+
+	/** Creates a GS RT Data object with a copy of the struct. */
+	UFUNCTION(BlueprintPure, Category = "GameSparksRT|Data Struct")
+	static UGSRTData* ToRTDataObject(const FGSRTData& Data);
+
+	UFUNCTION(BlueprintPure, Category = "GameSparksRT|Data Struct")
+	static bool HasInt(const FGSRTData& Data, int32 Index);
+	UFUNCTION(BlueprintPure, Category = "GameSparksRT|Data Struct")
+	static bool HasVector(const FGSRTData& Data, int32 Index);
+	UFUNCTION(BlueprintPure, Category = "GameSparksRT|Data Struct")
+	static bool HasFloat(const FGSRTData& Data, int32 Index);
+	UFUNCTION(BlueprintPure, Category = "GameSparksRT|Data Struct")
+	static bool HasString(const FGSRTData& Data, int32 Index);
+	UFUNCTION(BlueprintPure, Category = "GameSparksRT|Data Struct")
+	static bool HasData(const FGSRTData& Data, int32 Index);
+
+	UFUNCTION(BlueprintPure, Category = "GameSparksRT|Data Struct")
+	static int32 GetInt(const FGSRTData& Data, int32 Index);
+	UFUNCTION(BlueprintPure, Category = "GameSparksRT|Data Struct")
+	static FVector GetFVector(const FGSRTData& Data, int32 Index);
+	UFUNCTION(BlueprintPure, Category = "GameSparksRT|Data Struct")
+	static float GetFloat(const FGSRTData& Data, int32 Index);
+	UFUNCTION(BlueprintPure, Category = "GameSparksRT|Data Struct")
+	static FString GetString(const FGSRTData& Data, int32 Index);
+	UFUNCTION(BlueprintPure, Category = "GameSparksRT|Data Struct")
+	static FGSRTData GetData(const FGSRTData& Data, int32 Index);
+
+	UFUNCTION(BlueprintCallable, Category = "GameSparksRT|Data Struct")
+	static void SetInt(UPARAM(ref) FGSRTData& Data, int32 Index, int32 Value);
+	UFUNCTION(BlueprintCallable, Category = "GameSparksRT|Data Struct")
+	static void SetFVector(UPARAM(ref) FGSRTData& Data, int32 Index, const FVector& Value);
+	UFUNCTION(BlueprintCallable, Category = "GameSparksRT|Data Struct")
+	static void SetFloat(UPARAM(ref) FGSRTData& Data, int32 Index, float Value);
+	UFUNCTION(BlueprintCallable, Category = "GameSparksRT|Data Struct")
+	static void SetString(UPARAM(ref) FGSRTData& Data, int32 Index, const FString& Value);
+	UFUNCTION(BlueprintCallable, Category = "GameSparksRT|Data Struct")
+	static void SetData(UPARAM(ref) FGSRTData& Data, int32 Index, const FGSRTData& Value);
+
+	UFUNCTION(BlueprintPure, Category = "GameSparksRT|Data Struct")
+	static FString ToString(const FGSRTData& Data);
+};
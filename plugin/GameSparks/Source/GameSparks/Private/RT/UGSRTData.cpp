@@ -39,6 +39,11 @@ static bool indexIsValid(int32 index)
 	return true;
 }
 
+bool UGSRTData::IsValidIndex(int32 index)
+{
+	return indexIsValid(index);
+}
+
 
 bool UGSRTData::HasInt(int32 index)
 {
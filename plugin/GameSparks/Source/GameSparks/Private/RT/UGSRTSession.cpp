@@ -2,6 +2,8 @@
 #include "../GameSparksPrivatePCH.h"
 #include "Engine.h"
 #include "GameSparksClasses.h"
+#include "../GameSparksStats.h"
+#include "../GameSparksProfiler.h"
 
 DECLARE_LOG_CATEGORY_EXTERN(UGameSparksRTSessionLog, Log, All);
 DEFINE_LOG_CATEGORY(UGameSparksRTSessionLog);
@@ -23,6 +25,7 @@ UGSRTSession* UGSRTSession::CreateRTSession(UObject* WorldContextObject, FString
 		.SetHost(TCHAR_TO_UTF8(*host))
 		.SetPort(TCHAR_TO_UTF8(*port))
 		.SetConnectToken((TCHAR_TO_UTF8(*token)))
+		.SetProfiler(GameSparks::UnrealEngineSDK::FGameSparksProfiler::Get())
 		.Build());
 
 	return proxy;
@@ -56,31 +59,281 @@ void UGSRTSession::Stop()
 	return session->Ready;
 }*/
 
-void UGSRTSession::Send(int32 opCode, DeliveryIntent intent, UGSRTData* data, TArray<int32> peerIds_)
+namespace
 {
-	if (!data)
+	// payload layout of SendTransforms(), little endian:
+	//   uint16 count
+	//   count times: int32 id, float x, float y, float z, uint8 omitted component, int16 a, int16 b, int16 c
+	const int32 TransformHeaderSize = 2;
+	const int32 TransformEntrySize = 4 + 3 * 4 + 1 + 3 * 2;
+
+	// the three smallest components of a unit quaternion are within +-1/sqrt(2)
+	const float QuatComponentRange = 0.70710678f;
+
+	void WriteU32(uint8*& out, uint32 value)
 	{
-		UE_LOG(UGameSparksRTSessionLog, Error, TEXT("%s"), TEXT("Send() requires a data abject"));
-		return;
+		out[0] = uint8(value);
+		out[1] = uint8(value >> 8);
+		out[2] = uint8(value >> 16);
+		out[3] = uint8(value >> 24);
+		out += 4;
+	}
+
+	void WriteI16(uint8*& out, int16 value)
+	{
+		out[0] = uint8(uint16(value));
+		out[1] = uint8(uint16(value) >> 8);
+		out += 2;
+	}
+
+	void WriteFloat(uint8*& out, float value)
+	{
+		uint32 bits;
+		FMemory::Memcpy(&bits, &value, sizeof(bits));
+		WriteU32(out, bits);
 	}
 
-	gsstl::vector<int> peerIds(peerIds_.Num());
-	gsstl::copy(peerIds_.GetData(), peerIds_.GetData() + peerIds_.Num(), peerIds.begin());
+	uint32 ReadU32(const uint8*& in)
+	{
+		uint32 value = uint32(in[0]) | (uint32(in[1]) << 8) | (uint32(in[2]) << 16) | (uint32(in[3]) << 24);
+		in += 4;
+		return value;
+	}
 
+	int16 ReadI16(const uint8*& in)
+	{
+		int16 value = int16(uint16(in[0]) | (uint16(in[1]) << 8));
+		in += 2;
+		return value;
+	}
+
+	float ReadFloat(const uint8*& in)
+	{
+		uint32 bits = ReadU32(in);
+		float value;
+		FMemory::Memcpy(&value, &bits, sizeof(value));
+		return value;
+	}
+
+	// smallest three: the largest component is omitted and restored from the unit length on the receiving side
+	void WriteQuat(uint8*& out, FQuat rotation)
+	{
+		rotation.Normalize();
+		const float components[4] = { rotation.X, rotation.Y, rotation.Z, rotation.W };
+
+		int32 omitted = 0;
+		for (int32 i = 1; i != 4; ++i)
+		{
+			if (FMath::Abs(components[i]) > FMath::Abs(components[omitted]))
+			{
+				omitted = i;
+			}
+		}
+
+		// q and -q are the same rotation, so flip it to make the omitted component positive
+		const float sign = components[omitted] < 0 ? -1.0f : 1.0f;
+
+		*out++ = uint8(omitted);
+		for (int32 i = 0; i != 4; ++i)
+		{
+			if (i != omitted)
+			{
+				const float normalized = FMath::Clamp(sign * components[i] / QuatComponentRange, -1.0f, 1.0f);
+				WriteI16(out, int16(FMath::RoundToInt(normalized * 32767.0f)));
+			}
+		}
+	}
+
+	FQuat ReadQuat(const uint8*& in, int32 omitted)
+	{
+		float components[4];
+		float sumOfSquares = 0;
+		for (int32 i = 0; i != 4; ++i)
+		{
+			if (i != omitted)
+			{
+				components[i] = ReadI16(in) / 32767.0f * QuatComponentRange;
+				sumOfSquares += components[i] * components[i];
+			}
+		}
+		components[omitted] = FMath::Sqrt(FMath::Max(0.0f, 1.0f - sumOfSquares));
+		return FQuat(components[0], components[1], components[2], components[3]);
+	}
+}
+
+bool UGSRTSession::CanSend(int32 opCode) const
+{
 	if (!session || !IsReady)
 	{
 		UE_LOG(UGameSparksRTSessionLog, Error, TEXT("%s"), TEXT("RT Session must be started and ready before you send."));
-		return;
+		return false;
 	}
 
 	if (opCode <= 0)
 	{
 		UE_LOG(UGameSparksRTSessionLog, Error, TEXT("%s"), TEXT("OpCode must be greater than zero!"));
+		return false;
+	}
+
+	return true;
+}
+
+const gsstl::vector<int>& UGSRTSession::ToPeerIds(const TArray<int32>& peerIds)
+{
+	sendPeerIds.assign(peerIds.GetData(), peerIds.GetData() + peerIds.Num());
+	return sendPeerIds;
+}
+
+void UGSRTSession::Send(int32 opCode, DeliveryIntent intent, UGSRTData* data, const TArray<int32>& peerIds)
+{
+	if (!data)
+	{
+		UE_LOG(UGameSparksRTSessionLog, Error, TEXT("%s"), TEXT("Send() requires a data abject"));
+		return;
+	}
+
+	if (!CanSend(opCode))
+	{
 		return;
 	}
 
 	gsstl::lock_guard<gsstl::recursive_mutex> lock(sessionMutex);
-	session->SendRTData(opCode, (GameSparks::RT::GameSparksRT::DeliveryIntent)intent, data->GetRTData(), peerIds);
+	session->SendRTData(opCode, (GameSparks::RT::GameSparksRT::DeliveryIntent)intent, data->GetRTData(), ToPeerIds(peerIds));
+}
+
+void UGSRTSession::SendRTData(int32 opCode, DeliveryIntent intent, const FGSRTData& data, const TArray<int32>& peerIds)
+{
+	if (!CanSend(opCode))
+	{
+		return;
+	}
+
+	gsstl::lock_guard<gsstl::recursive_mutex> lock(sessionMutex);
+	session->SendRTData(opCode, (GameSparks::RT::GameSparksRT::DeliveryIntent)intent, data.Data, ToPeerIds(peerIds));
+}
+
+bool UGSRTSession::SendTransforms(int32 opCode, DeliveryIntent intent, const TArray<int32>& ids, const TArray<FVector>& locations, const TArray<FQuat>& rotations, const TArray<int32>& peerIds)
+{
+	const int32 count = ids.Num();
+	if (locations.Num() != count || rotations.Num() != count)
+	{
+		UE_LOG(UGameSparksRTSessionLog, Error, TEXT("%s"), TEXT("SendTransforms() requires one location and one rotation per id."));
+		return false;
+	}
+
+	if (count > MAX_uint16)
+	{
+		UE_LOG(UGameSparksRTSessionLog, Error, TEXT("SendTransforms() can send at most %d transforms per packet."), int32(MAX_uint16));
+		return false;
+	}
+
+	if (!CanSend(opCode))
+	{
+		return false;
+	}
+
+	gsstl::lock_guard<gsstl::recursive_mutex> lock(sessionMutex);
+
+	const gsstl::vector<int>& targetPlayers = ToPeerIds(peerIds);
+	const int32 perPacket = GetTransformsPerPacket(intent, count, peerIds.Num());
+	if (intent == DeliveryIntent::UNRELIABLE_SEQUENCED && count > perPacket)
+	{
+		UE_LOG(UGameSparksRTSessionLog, Warning, TEXT("SendTransforms() splits %d transforms into packets of %d. A packet can supersede the others with UNRELIABLE_SEQUENCED, use UNRELIABLE."), count, perPacket);
+	}
+
+	bool sent = true;
+	int32 first = 0;
+	do
+	{
+		const int32 packetCount = FMath::Min(perPacket, count - first);
+		WriteTransforms(sendPayload, ids, locations, rotations, first, packetCount);
+		sent = session->SendBytes(opCode, (GameSparks::RT::GameSparksRT::DeliveryIntent)intent, System::ArraySegment<System::Byte>(sendPayload), targetPlayers) != 0 && sent;
+		first += packetCount;
+	}
+	while (first < count);
+
+	return sent;
+}
+
+int32 UGSRTSession::GetTransformsPerPacket(DeliveryIntent intent, int32 count, int32 targetPlayers)
+{
+	if (intent == DeliveryIntent::RELIABLE)
+	{
+		return FMath::Max(count, 1);
+	}
+
+	// unreliable packets have to fit into one datagram
+	const int32 space = GameSparks::RT::GameSparksRT::MaxDatagramPayloadSize(targetPlayers) - TransformHeaderSize;
+	return FMath::Max(1, space / TransformEntrySize);
+}
+
+void UGSRTSession::WriteTransforms(System::Bytes& payload, const TArray<int32>& ids, const TArray<FVector>& locations, const TArray<FQuat>& rotations, int32 first, int32 count)
+{
+	// resize() keeps the capacity, so the buffer only grows to the largest packet sent so far
+	payload.resize(TransformHeaderSize + count * TransformEntrySize);
+	uint8* out = payload.data();
+
+	*out++ = uint8(count);
+	*out++ = uint8(count >> 8);
+
+	for (int32 i = first; i != first + count; ++i)
+	{
+		WriteU32(out, uint32(ids[i]));
+		WriteFloat(out, locations[i].X);
+		WriteFloat(out, locations[i].Y);
+		WriteFloat(out, locations[i].Z);
+		WriteQuat(out, rotations[i]);
+	}
+
+	check(out == payload.data() + payload.size());
+}
+
+bool UGSRTSession::ReadTransforms(const GameSparks::RT::RTPacket& packet, TArray<int32>& ids, TArray<FVector>& locations, TArray<FQuat>& rotations)
+{
+	ids.Reset();
+	locations.Reset();
+	rotations.Reset();
+
+	const System::Bytes& payload = packet.Payload;
+	if (payload.size() < size_t(TransformHeaderSize))
+	{
+		return false;
+	}
+
+	const uint8* in = payload.data();
+	const int32 count = int32(in[0]) | (int32(in[1]) << 8);
+	in += TransformHeaderSize;
+
+	if (payload.size() != size_t(TransformHeaderSize + count * TransformEntrySize))
+	{
+		return false;
+	}
+
+	ids.Reserve(count);
+	locations.Reserve(count);
+	rotations.Reserve(count);
+
+	for (int32 i = 0; i != count; ++i)
+	{
+		ids.Add(int32(ReadU32(in)));
+
+		const float x = ReadFloat(in);
+		const float y = ReadFloat(in);
+		const float z = ReadFloat(in);
+		locations.Add(FVector(x, y, z));
+
+		const int32 omitted = *in++;
+		if (omitted > 3)
+		{
+			ids.Reset();
+			locations.Reset();
+			rotations.Reset();
+			return false;
+		}
+		rotations.Add(ReadQuat(in, omitted));
+	}
+
+	return true;
 }
 
 
@@ -127,14 +380,48 @@ void UGSRTSession::OnReady(bool ready)
 
 void UGSRTSession::OnPacket(const GameSparks::RT::RTPacket& packet)
 {
-	UGSRTData* data = NewObject<UGSRTData>();
+	OnPacketNativeDelegate.Broadcast(this, packet);
+
+	if (!OnDataDelegate.IsBound())
+	{
+		// nobody would see the copy
+		return;
+	}
+
+	UGSRTData* data = RecycleReceivedData ? AcquireReceivedData() : NewObject<UGSRTData>();
 	data->SetRTData(packet.Data);
 	OnDataDelegate.Broadcast(this, packet.Sender, packet.OpCode, data);
+
+	if (RecycleReceivedData)
+	{
+		ReleaseReceivedData(data);
+	}
+}
+
+UGSRTData* UGSRTSession::AcquireReceivedData()
+{
+	if (receivedDataPool.Num() > 0)
+	{
+		return receivedDataPool.Pop(false);
+	}
+	return NewObject<UGSRTData>(this);
+}
+
+void UGSRTSession::ReleaseReceivedData(UGSRTData* data)
+{
+	// packets are dispatched one after another, so the pool only grows if a listener re-enters Tick()
+	static const int32 MaxPooledReceivedData = 4;
+	if (receivedDataPool.Num() < MaxPooledReceivedData)
+	{
+		receivedDataPool.Push(data);
+	}
 }
 
 
 void UGSRTSession::Tick(float DeltaTime)
 {
+	INC_DWORD_STAT(STAT_GameSparksBusyTicks);
+
 	gsstl::lock_guard<gsstl::recursive_mutex> lock(sessionMutex);
 	if (session && started)
 	{
@@ -144,6 +431,17 @@ void UGSRTSession::Tick(float DeltaTime)
 
 bool UGSRTSession::IsTickable() const
 {
+	if (!started)
+	{
+		return false;
+	}
+
+	// session does not change after CreateRTSession() and HasPendingWork() is thread safe, so sessionMutex is not needed
+	if (!session || !session->HasPendingWork())
+	{
+		INC_DWORD_STAT(STAT_GameSparksIdleTicks);
+		return false;
+	}
 	return true;
 }
 
@@ -13,6 +13,7 @@
 #include <mutex>
 #include "UGSRTVector.h"
 #include "UGSRTData.h"
+#include "FGSRTData.h"
 #include "UGSRTSession.generated.h"
 
 UENUM(BlueprintType)		//"BlueprintType" is essential to include
@@ -49,7 +50,29 @@ class UGSRTSession : public UObject, public FTickableGameObject//, public GameSp
         void Stop();
 
         UFUNCTION(BlueprintCallable, Category = "GameSparksRT|Session")
-        void Send(int32 opCode, DeliveryIntent intent, UGSRTData* data, TArray<int32> peerIds);
+        void Send(int32 opCode, DeliveryIntent intent, UGSRTData* data, const TArray<int32>& peerIds);
+
+		/* Sends a GS RT Data struct. Same as Send(), but does not require a data object. */
+		UFUNCTION(BlueprintCallable, meta = (DisplayName = "Send RT Data (Struct)"), Category = "GameSparksRT|Session")
+		void SendRTData(int32 opCode, DeliveryIntent intent, const FGSRTData& data, const TArray<int32>& peerIds);
+
+		/// sends the transforms of many actors. locations and rotations must have one entry per id.
+		/// the payload is written into a buffer owned by the session, so no RTData or UObject is created.
+		/// positions are sent at full precision, rotations are quantized to 7 bytes (smallest three), 23 bytes per transform.
+		/// reliable batches are sent as one packet. unreliable batches are split into packets of GetTransformsPerPacket()
+		/// transforms, so that each fits into one datagram (see GameSparksRT::MaxDatagramPayloadSize(), 43 transforms when
+		/// sent to all peers). ReadTransforms() decodes each packet on its own. returns false if the arguments are invalid,
+		/// the session is not ready or a packet could not be sent.
+		bool SendTransforms(int32 opCode, DeliveryIntent intent, const TArray<int32>& ids, const TArray<FVector>& locations, const TArray<FQuat>& rotations, const TArray<int32>& peerIds);
+
+		/// decodes the payload of a packet sent via SendTransforms(). returns false if the payload is malformed.
+		static bool ReadTransforms(const GameSparks::RT::RTPacket& packet, TArray<int32>& ids, TArray<FVector>& locations, TArray<FQuat>& rotations);
+
+		/// the number of transforms SendTransforms() puts into one packet of a batch of count transforms
+		static int32 GetTransformsPerPacket(DeliveryIntent intent, int32 count, int32 targetPlayers);
+
+		/// writes the count transforms from first on into payload, as SendTransforms() sends them
+		static void WriteTransforms(System::Bytes& payload, const TArray<int32>& ids, const TArray<FVector>& locations, const TArray<FQuat>& rotations, int32 first, int32 count);
 
 		UFUNCTION(BlueprintPure, Category = "GameSparksRT|Session")
 		TArray<int32> GetActivePeers();
@@ -73,6 +96,18 @@ class UGSRTSession : public UObject, public FTickableGameObject//, public GameSp
 		UPROPERTY(BlueprintAssignable, Category = GameSparksRT)
 		FOnData OnDataDelegate;
 
+		/// native listeners get a view of the received packet without any UObject being created or RTData being copied.
+		/// the packet (and the RTData it references) is only valid for the duration of the broadcast.
+		DECLARE_MULTICAST_DELEGATE_TwoParams(FOnPacketNative, UGSRTSession*, const GameSparks::RT::RTPacket&);
+		FOnPacketNative OnPacketNativeDelegate;
+
+		/// if true, the UGSRTData passed to OnDataDelegate is taken from a pool and recycled once the broadcast returned, which
+		/// saves a UObject per received packet. the data object is then only valid during the broadcast: it is overwritten by
+		/// the next packet, so listeners must not store it or read it later (e.g. after a Delay), but copy the values they need.
+		/// false by default, every packet gets a UGSRTData of its own, which listeners may keep.
+		UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = GameSparksRT)
+		bool RecycleReceivedData = false;
+
 		UPROPERTY(EditAnywhere, Category = GameSparksRT)
 		bool IsReady;
 
@@ -84,6 +119,8 @@ class UGSRTSession : public UObject, public FTickableGameObject//, public GameSp
         UPROPERTY(BlueprintAssignable, Category = GameSparksRT)
         FOnReady OnReadyDelegate;*/
     private:
+		friend class FGSRTSessionRecycleReceivedDataTest;
+
 		virtual void Tick(float DeltaTime) override;
 		virtual bool IsTickable() const override;
 		virtual TStatId GetStatId() const override;
@@ -145,8 +182,24 @@ class UGSRTSession : public UObject, public FTickableGameObject//, public GameSp
 		private:
 			UGSRTSession* proxy;
 		};
+		bool CanSend(int32 opCode) const;
+		const gsstl::vector<int>& ToPeerIds(const TArray<int32>& peerIds);
+
+		UGSRTData* AcquireReceivedData();
+		void ReleaseReceivedData(UGSRTData* data);
+
+		/// recycled UGSRTData instances for OnDataDelegate. Referenced from here, so they are not garbage collected.
+		UPROPERTY(Transient)
+		TArray<UGSRTData*> receivedDataPool;
+
 		TUniquePtr<RTSessionListenerProxy> sessionListener;
-        TUniquePtr<GameSparks::RT::IRTSession> session;
-		gsstl::recursive_mutex sessionMutex;
-		bool started = false;
+        TUniquePtr<GameSparks::RT::IRTSession> session; // set once by CreateRTSession()
+		mutable gsstl::recursive_mutex sessionMutex;
+
+		/// scratch buffers reused by the send functions, guarded by sessionMutex
+		gsstl::vector<int> sendPeerIds;
+		System::Bytes sendPayload;
+
+		/// read by IsTickable() every frame without taking sessionMutex
+		FThreadSafeBool started;
 };
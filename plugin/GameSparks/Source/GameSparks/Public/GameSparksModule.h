@@ -10,6 +10,9 @@
 #include "../Private/GameSparksComponent.h"
 
 
+class UGSMessageListeners;
+class UGSMessageListenersObject;
+
 DECLARE_LOG_CATEGORY_EXTERN(UGameSparksModuleLog, Log, All);
 
 DECLARE_MULTICAST_DELEGATE_OneParam(FOnGameSparksAvailable, bool /* available */);
@@ -59,6 +62,16 @@ public:
     const GameSparks::Core::GS& GetGSInstance() const { return GS; }
     
     void RegisterListeners();
+
+	/// UGSMessageListeners components and UGSMessageListenersObject instances register themselves here,
+	/// so that incoming messages are only dispatched to live listeners instead of scanning all objects.
+	void AddMessageListener(UGSMessageListeners* Listener);
+	void RemoveMessageListener(UGSMessageListeners* Listener);
+	void AddMessageListener(UGSMessageListenersObject* Listener);
+	void RemoveMessageListener(UGSMessageListenersObject* Listener);
+
+	const TArray<TWeakObjectPtr<UGSMessageListeners>>& GetMessageListenerComponents() const { return MessageListenerComponents; }
+	const TArray<TWeakObjectPtr<UGSMessageListenersObject>>& GetMessageListenerObjects() const { return MessageListenerObjects; }
     
 	/// returns true, iff the GameSparks instance is ready to be used
 	bool IsInitialized() const;
@@ -84,5 +97,11 @@ private:
     GameSparks::Core::GS GS;
     bool isInitialised = false;
 
+	/** FPlatformTime::Seconds() of the last call to GS.Update(). Updates are skipped while the SDK is idle. */
+	double LastUpdateTime = 0;
+
 	class FOnlineFactoryGameSparks* GameSparksFactory = 0;
+
+	TArray<TWeakObjectPtr<UGSMessageListeners>> MessageListenerComponents;
+	TArray<TWeakObjectPtr<UGSMessageListenersObject>> MessageListenerObjects;
 };
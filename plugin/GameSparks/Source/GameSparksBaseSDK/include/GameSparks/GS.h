@@ -6,6 +6,8 @@
 #include "IGSPlatform.h"
 #include "GSRequest.h"
 #include "GSConnection.h"
+#include "GSHistogram.h"
+#include "GSRequestMetrics.h"
 #include <GameSparks/GSLeakDetector.h>
 #include <GameSparks/GSLinking.h>
 #include <cassert>
@@ -116,6 +118,20 @@ namespace GameSparks
                 t_OnPersistentQueueLoadedCallback OnPersistentQueueLoadedCallback;
 
 
+				/*!
+					Enables or disables the network thread mode. This has to be called before Initialise()
+					and affects all connections created afterwards.
+
+					When enabled, each connection owns a background thread which performs the WebSocket I/O
+					(including TLS and the websocket framing) and parses the received JSON. The parsed responses
+					and messages are handed to the thread calling Update() and delivered from there, so all
+					callbacks are still invoked from within Update().
+				 */
+				void SetNetworkThreadEnabled(bool enabled) { m_NetworkThreadEnabled = enabled; }
+
+				/// True if connections created by this instance perform their I/O on a network thread.
+				bool GetNetworkThreadEnabled() const { return m_NetworkThreadEnabled; }
+
 				/// Initialize this GS instance. This has to be called before calling any other member functions.
 				void Initialise(IGSPlatform* gSPlatform);
 
@@ -156,6 +172,59 @@ namespace GameSparks
 				/// @param deltaTimeInSeconds the time since the last call to Update() in seconds
 				void Update(Seconds deltaTimeInSeconds);
 
+				/*!
+					Limits the time Update() spends delivering received responses and messages.
+
+					Update() stops delivering, when maxMessages were delivered or maxSeconds have elapsed,
+					whatever comes first. The remaining responses and messages are delivered by the following
+					calls to Update(). At least one message is delivered per call, so that the SDK always makes progress.
+					Pass 0 to disable a limit. By default the number of messages is not limited and the time is limited to 2ms.
+				 */
+				void SetDispatchBudget(int maxMessages, Seconds maxSeconds);
+
+				/// histogram of the time each call to Update() spent receiving and delivering responses and messages.
+				/// Only calls that delivered at least one message are recorded.
+				const GSHistogram& GetDispatchTimeHistogram() const { return m_DispatchTimeHistogram; }
+
+				/// removes all samples from the dispatch time histogram
+				void ResetDispatchTimeHistogram() { m_DispatchTimeHistogram.Reset(); }
+
+				/// latency histograms, error and timeout counts, queue wait times and durable retries per request class,
+				/// recorded since the last call to ResetRequestMetrics().
+				const GSRequestMetrics& GetRequestMetrics() const { return m_RequestMetrics; }
+
+				/// removes all samples from the request metrics
+				void ResetRequestMetrics() { m_RequestMetrics.Reset(); }
+
+				#if defined(GS_USE_STD_FUNCTION)
+					typedef gsstl::function<void(GS&, const GSRequestMetrics&)> t_RequestMetricsCallback;
+				#else
+					typedef void(*t_RequestMetricsCallback)(GS&, const GSRequestMetrics&);
+				#endif /* GS_USE_STD_FUNCTION */
+
+				/*!
+					Called from within Update() every request metrics interval (see SetRequestMetricsInterval()) with a snapshot
+					of GetRequestMetrics(). The metrics are not reset, call ResetRequestMetrics() from the callback
+					to receive the metrics of each interval separately.
+				 */
+				t_RequestMetricsCallback OnRequestMetrics;
+
+				/// Sets the interval in which OnRequestMetrics is called. Defaults to 60 seconds. Pass 0 to disable the callback.
+				void SetRequestMetricsInterval(Seconds interval);
+
+				/*!
+					Returns the time in seconds until Update() has work to do, assuming nothing else happens in the meantime.
+
+					0 means that Update() has to be called right away, e.g. because received messages wait to be delivered,
+					a request is queued or the websocket has input to read. A connected instance becomes idle between messages
+					with and without the network thread (see SetNetworkThreadEnabled()). The deadlines are collected by Update(),
+					so this is cheap enough to be called every frame.
+					If nothing is scheduled at all, gsstl::numeric_limits<Seconds>::max() is returned.
+
+					Calling Update() earlier is always fine. If calls are skipped, the time that passed has to be passed to the next call.
+				 */
+				Seconds GetTimeUntilUpdateRequired() const;
+
 	            /*!
 	                Registers MessageListener via GS.SetMessageListener(OnAchievementEarnedMessage)
 	                if you pass null, the MessageListener is unregistered.
@@ -232,13 +301,18 @@ namespace GameSparks
 	            /// change user-data to *to* for all requests that currently have user-data *from*
 	            /// If the request was already delivered, but the response is outstanding, the callbacks
             	/// wont be called. This is usefully if the object userData is pointing to gets destroyed
+				/// The cost does not depend on the number of outstanding requests.
 				void ChangeUserDataForRequests(const void *from, void* to);
 			private:
 				friend class GSConnection;
 				friend class ::TestSerializeRequestQueue_Test_Test;
 
+				void AttachUserDataHandle(GSRequest& request);
+				void ClearUserDataHandles();
+
 				void OnWebSocketClientError(const easywsclient::WSError& errorMessage, GSConnection* connection);
 				void OnMessageReceived(const gsstl::string& message, GSConnection& connection);
+				void OnMessageReceived(GSObject& response, GSConnection& connection);
 				gsstl::string GetServiceUrl() const { return m_ServiceUrl; }
 				void SetAvailability(bool available);
 				Seconds GetRequestTimeoutSeconds();
@@ -247,6 +321,13 @@ namespace GameSparks
 
 				void NetworkChange(bool available);
 				void UpdateConnections(Seconds deltaTimeInSeconds);
+				bool HasDispatchBudget() const;
+				IGSProfiler* GetProfiler() const;
+				void ReportProfilerCounters(IGSProfiler& profiler) const;
+				void OnRequestSent(GSRequest& request);
+				void OnRequestCompleted(const GSRequest& request, const GSObject& response);
+				void ReportRequestMetrics(Seconds deltaTimeInSeconds);
+				Seconds ComputeTimeUntilUpdateRequired() const;
 				void Stop(bool termiante);
 				void NewConnection();
 				void Handshake(GSObject& response, GSConnection& connection);
@@ -282,6 +363,11 @@ namespace GameSparks
 
 				t_PersistentQueue m_PersistentQueue;
 
+				/// user-data handles of sent requests, indexed by the user-data they currently point to.
+				/// the entries do not hold a reference, a handle erases its entry when it is deleted.
+				typedef GSRequest::UserDataHandle::Index t_UserDataHandles;
+				t_UserDataHandles m_UserDataHandles;
+
 				long m_RequestCounter;
 
 				// BS: we might want to change this to a state enum. they appear to be mutually exclusive.
@@ -290,11 +376,22 @@ namespace GameSparks
 				bool m_Initialized;
 				bool m_durableQueuePaused; // internal value
 				bool m_durableQueueRunning; // user controlled value
+				bool m_NetworkThreadEnabled;
+
+				int m_DispatchBudgetMessages;
+				Seconds m_DispatchBudgetSeconds;
+				int m_DispatchedMessages; // during the current call to Update()
+				gsstl::chrono::steady_clock::time_point m_DispatchStart;
+				GSHistogram m_DispatchTimeHistogram;
+				GSRequestMetrics m_RequestMetrics;
+				Seconds m_RequestMetricsInterval;
+				Seconds m_RequestMetricsDueIn;
 				gsstl::string m_SessionId;
 
 				int m_connectionAttempts;
 				Seconds m_mustBeConnectedIn;
 				Seconds m_sendNextDurableRequestIn;
+				Seconds m_TimeUntilUpdateRequired; // as of the end of the last Update(), 0 after anything was queued since
 
 	            /*
 	                MessageListeners
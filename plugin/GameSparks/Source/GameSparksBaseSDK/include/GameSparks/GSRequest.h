@@ -29,6 +29,16 @@ namespace GameSparks
 					typedef void(*t_Callback)(GS&, const GSObject&);
 				#endif /* GS_USE_STD_FUNCTION */
 
+				/// scheduling class of a request. All requests share a single websocket; frames of a higher
+				/// priority are written first, but lower priorities are not starved by a steady stream of them.
+				enum Priority
+				{
+					PRIORITY_INTERACTIVE = 0, ///< latency sensitive, e.g. requests the player is waiting for
+					PRIORITY_NORMAL,          ///< the default
+					PRIORITY_BACKGROUND,      ///< bulk and telemetry traffic, durable requests
+					PRIORITY_COUNT
+				};
+
 				bool operator==(const GSRequest& other) const;
 
                 bool HasCallbacks() const
@@ -63,13 +73,26 @@ namespace GameSparks
 
 				const void* GetUserData() const
 				{
-					return m_userData;
+					// once sent, the user-data is read through the shared handle, see GS::ChangeUserDataForRequests()
+					return m_callbacks ? m_callbacks.get()->GetUserData() : m_userData;
 				}
 
 				float getExpiresInSeconds() const
 				{
 					return m_expiresInSeconds;
 				}
+
+				/// the priority is only used for scheduling on the client, it is not sent to the server
+				void SetPriority(Priority priority)
+				{
+					assert(priority >= PRIORITY_INTERACTIVE && priority < PRIORITY_COUNT);
+					m_Priority = priority;
+				}
+
+				Priority GetPriority() const
+				{
+					return m_Priority;
+				}
 			private:
 				// TODO: check if this works/is needed
 				bool GetDurable() const { return m_Durable; }
@@ -93,6 +116,11 @@ namespace GameSparks
 				bool m_Durable;
 				Seconds m_expiresInSeconds = Seconds(-1);
 				int m_durableAttempts = 1;
+				Priority m_Priority = PRIORITY_NORMAL;
+
+				// for GS::GetRequestMetrics(). Default constructed if unknown, e.g. for durable requests restored from disk.
+				gsstl::chrono::steady_clock::time_point m_QueuedAt; ///< when GS::Send() was called
+				gsstl::chrono::steady_clock::time_point m_SentAt; ///< when the request was handed to a connection
 
 				/*
 					This class is here so that it can be implemented in GSTypedRequest.
@@ -102,14 +130,67 @@ namespace GameSparks
 					This whole construct is needed, because we cannot depend on stl-function
 					We need to support raw function pointers as well.
 				*/
+				/*
+					Reference counted indirection to the user-data of sent requests. All copies of a
+					request that was sent with user-data refer to the same handle, which is also
+					indexed by GS. This allows GS::ChangeUserDataForRequests() to re-target all of them
+					with a single assignment instead of searching every queue.
+					The index does not hold a reference: the handle removes itself from it, once the
+					last copy of its requests is gone, i.e. the response was delivered or the request
+					timed out.
+				*/
+				struct UserDataHandle
+				{
+					typedef gsstl::map<const void*, UserDataHandle*> Index;
+
+					UserDataHandle(void* userData_, Index* index_) : userData(userData_), refCount(1), index(index_), forward(0) {}
+
+					static UserDataHandle* Retain(UserDataHandle* handle)
+					{
+						if (handle) ++handle->refCount;
+						return handle;
+					}
+
+					static void Release(UserDataHandle* handle)
+					{
+						if (handle && --handle->refCount == 0)
+						{
+							if (handle->index)
+							{
+								Index::iterator entry = handle->index->find(handle->userData);
+								if (entry != handle->index->end() && entry->second == handle) handle->index->erase(entry);
+							}
+							Release(handle->forward);
+							delete handle;
+						}
+					}
+
+					void* GetUserData() const
+					{
+						const UserDataHandle* handle = this;
+						while (handle->forward) handle = handle->forward;
+						return handle->userData;
+					}
+
+					void* userData;
+					int refCount;
+					Index* index; ///< where the handle is indexed by userData, 0 if it is not
+					UserDataHandle* forward; ///< the handle this one was merged into, holds a reference
+				};
+
 				struct BaseCallbacks
 				{
-                    BaseCallbacks() : m_userData() {}
-                    virtual ~BaseCallbacks() {}
+                    BaseCallbacks() : m_userData(), m_userDataHandle() {}
+                    virtual ~BaseCallbacks() { UserDataHandle::Release(m_userDataHandle); }
 					virtual void OnSucess(GS& gsInstance, const GSObject& response) = 0;
 					virtual void OnError (GS& gsInstance, const GSObject& response) = 0;
 					virtual BaseCallbacks* Clone() const = 0;
+
+					/// the user-data passed to the response callbacks
+					void* GetUserData() const { return m_userDataHandle ? m_userDataHandle->GetUserData() : m_userData; }
+
                     void* m_userData;
+					UserDataHandle* m_userDataHandle; ///< set by GS, when the request is sent
                     GS_LEAK_DETECTOR(BaseCallbacks)
 				};
 
@@ -134,7 +215,11 @@ namespace GameSparks
 
 						// copy constructor (this is the interesting part)
 						BaseCallbacksPtr(const BaseCallbacksPtr& other)
-						: ptr( other.ptr ? other.ptr->Clone() : 0) {}
+						: ptr( other.ptr ? other.ptr->Clone() : 0)
+						{
+							// copies of a sent request share the user-data handle
+							if (ptr) ptr->m_userDataHandle = UserDataHandle::Retain(other.ptr->m_userDataHandle);
+						}
 
 						// assignment operator
 						BaseCallbacksPtr& operator=(BaseCallbacksPtr other)
@@ -149,6 +234,11 @@ namespace GameSparks
 							return ptr;
 						}
 
+						const BaseCallbacks* get() const
+						{
+							return ptr;
+						}
+
 						// conversion to bool (e.g. wrapped pointer not null)
 						operator bool () const
 						{
@@ -99,6 +99,13 @@ namespace GameSparks
 					return *this;
 				}
 
+				/// sets the scheduling priority of this request. see GSRequest::Priority
+				GSTypedRequest<RequestType, ResponseType>& SetPriority(GSRequest::Priority priority)
+				{
+					m_Request.SetPriority(priority);
+					return *this;
+				}
+
 				/// <summary>
 				/// Sets the playerId for this request.
 				/// This will only have an effect if you are using a server style credential, i.e. one with "Player" set to off.
@@ -124,7 +131,7 @@ namespace GameSparks
 								if ( m_onSuccess )
                                 {
                                     ResponseType typedResponse(response); // the constructor of ResponseType takes a GSObject
-                                    typedResponse.m_userData = m_userData;
+                                    typedResponse.m_userData = GetUserData();
                                     m_onSuccess( gsInstance, typedResponse );
                                 }
 							}
@@ -134,7 +141,7 @@ namespace GameSparks
 								if ( m_onError )
                                 {
                                     ResponseType typedResponse(response); // the constructor of ResponseType takes a GSObject
-                                    typedResponse.m_userData = m_userData;
+                                    typedResponse.m_userData = GetUserData();
                                     m_onError( gsInstance, typedResponse );
                                 }
 							}
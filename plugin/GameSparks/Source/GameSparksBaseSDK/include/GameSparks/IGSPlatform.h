@@ -8,6 +8,7 @@
 #include <GameSparks/GSLeakDetector.h>
 #include <GameSparks/GSPlatformDeduction.h>
 #include "GSTime.h"
+#include "GSProfiler.h"
 #include <cassert>
 
 #if !defined(GS_USE_IN_MEMORY_PERSISTENT_STORAGE)
@@ -121,6 +122,10 @@ namespace GameSparks
 				//! If you need more sophisticated logging, this is the method you should override
 				virtual void DebugMsg(const gsstl::string& message) const = 0;
 
+				//! returns the profiler the SDK reports its timing scopes and counters to, null if there is none.
+				//! override this to attach the SDK to the profiler of your engine. see IGSProfiler.
+				virtual IGSProfiler* GetProfiler() const { return 0; }
+
 				/// returns the request timeout in seconds.
 				virtual Seconds GetRequestTimeoutSeconds() const { return m_RequestTimeoutSeconds; }
 
@@ -4,6 +4,8 @@
 #include "./Forwards.hpp"
 #include "./GSLinking.hpp"
 #include "../GameSparks/gsstl.h"
+#include "../GameSparks/GSProfiler.h"
+#include "../System/Bytes.hpp"
 //#include <string>
 #include <functional>
 #include <map>
@@ -48,6 +50,65 @@ namespace GameSparks {
 			/// sets the session listener to listen for session related events.
 			GameSparksRTSessionBuilder& SetListener(IRTSessionListener* listener);
 
+			/// sets the profiler the session reports its timing scopes to. it has to outlive the session.
+			GameSparksRTSessionBuilder& SetProfiler(GameSparks::Core::IGSProfiler* profiler);
+
+			/// reliable packets are collected and sent together by IRTSession::Update(), or as soon as at least
+			/// bytes are waiting. pass 0 to send each reliable packet right away. defaults to 1400 bytes.
+			GameSparksRTSessionBuilder& SetReliableFlushThreshold(int bytes);
+
+			/// reliable packets with the given opCode are sent right away (together with the packets collected before them)
+			/// instead of waiting for the next call to IRTSession::Update(). use this for latency critical messages.
+			GameSparksRTSessionBuilder& AddImmediateFlushOpCode(int opCode);
+
+			/// unreliable packets sent between two calls to IRTSession::Update() are packed into as few datagrams of
+			/// at most bytes as possible, and sent by Update(). pass 0 to send each unreliable packet in its own datagram
+			/// right away. defaults to GameSparksRT::MAX_MESSAGE_SIZE_BYTES, the size of the receive buffer of the fast connection.
+			GameSparksRTSessionBuilder& SetMaxDatagramSize(int bytes);
+
+			/// IRTSession::Update() passes the received messages to IRTSessionListener::OnPacket() until maxMessages were delivered
+			/// or maxMilliseconds passed. the remaining messages are delivered by the next calls. the commands that drive the
+			/// connection state (login, players connecting and disconnecting) are run ahead of the waiting messages, the messages
+			/// of a disconnected player are dropped. 0 means no limit, the default, everything is run in the order it arrived.
+			GameSparksRTSessionBuilder& SetUpdateBudget(int maxMessages, int maxMilliseconds = 0);
+
+			/// an UNRELIABLE_SEQUENCED message that is still waiting for IRTSession::Update() is dropped, when a newer one with
+			/// the same opCode arrives from the same peer, so that only the newest is delivered. useful with SetUpdateBudget().
+			GameSparksRTSessionBuilder& EnableSequencedCollapse();
+
+			/*!
+				Enables sending unreliable messages that do not fit into a single datagram (see GameSparksRT::MAX_MESSAGE_SIZE_BYTES)
+				over the fast connection. Such messages are split into fragments, which are sent as packets with the given opCode.
+				The receiver delivers the message once all of its fragments arrived. If a fragment is lost, the whole message is dropped.
+				UNRELIABLE_SEQUENCED is honored among the fragmented messages of a peer.
+
+				opCode is reserved for the fragments and has to be the same for all peers of the match. Messages larger than
+				maxMessageSize are neither sent nor accepted in fragments.
+			 */
+			GameSparksRTSessionBuilder& EnableFragmentation(int opCode, int maxMessageSize = 16384);
+
+			/*!
+				Enables IRTSession::SendCompressed(). Compressed messages are sent as packets with the given opCode, which is
+				reserved for them and has to be the same for all peers of the match, as does the dictionary. A dictionary built
+				from captured payloads with GameSparksRT::TrainCompressionDictionary() improves the compression of small messages a lot.
+
+				Messages larger than maxMessageSize (before compression) are neither sent nor accepted compressed.
+			 */
+			GameSparksRTSessionBuilder& EnableCompression(int opCode, const System::Bytes& dictionary = System::Bytes(), int maxMessageSize = 65536);
+
+			/*!
+				Enables IRTSession::SendDelta(). Delta packets are sent with the given opCode, which is reserved for them and has to
+				be the same for all peers of the match.
+
+				The sender keeps a baseline per opCode. RELIABLE sends carry the slots changed since the previous reliable send.
+				Unreliable sends carry the slots changed since the baseline, which is refreshed by sending the full data reliably
+				every keyframeInterval unreliable sends, and on the first send of an opCode. Messages in which every slot changed
+				are sent as they are.
+
+				A receiver that misses a baseline, e.g. because it joined late, drops the deltas and requests the baseline from the sender.
+			 */
+			GameSparksRTSessionBuilder& EnableDeltaEncoding(int opCode, int keyframeInterval = 30);
+
 			/// Build the IRTSession. caller owns the return value. make sure to put it into a std::unique_ptr or std::shared_ptr (or delete it manually).
 			IRTSession* Build() const;
 		private:
@@ -58,6 +119,20 @@ namespace GameSparks {
 				gsstl::string host;
 				gsstl::string port;
 				IRTSessionListener* listener = nullptr;
+				GameSparks::Core::IGSProfiler* profiler = nullptr;
+				int reliableFlushThreshold = 1400;
+				gsstl::vector<int> immediateFlushOpCodes;
+				int maxDatagramSize = -1; // MAX_MESSAGE_SIZE_BYTES, which is not declared yet
+				int maxMessagesPerUpdate = 0;
+				int maxMillisecondsPerUpdate = 0;
+				bool collapseSequencedMessages = false;
+				int fragmentOpCode = 0;
+				int maxFragmentedMessageSize = 0;
+				int compressionOpCode = 0;
+				System::Bytes compressionDictionary;
+				int maxCompressedMessageSize = 0;
+				int deltaOpCode = 0;
+				int deltaKeyframeInterval = 0;
 			};
 			Pimpl* pimpl;
 	};
@@ -80,6 +155,15 @@ namespace GameSparks {
 
 			static GameSparksRTSessionBuilder SessionBuilder();
 
+			/// builds a dictionary of at most maxSize bytes for GameSparksRTSessionBuilder::EnableCompression() from
+			/// representative payloads, e.g. captured in IRTSessionListener::OnPacket().
+			static System::Bytes TrainCompressionDictionary(const gsstl::vector<System::Bytes>& samples, int maxSize = 4096);
+
+			/// the largest payload an unreliable packet without RTData can carry to targetPlayers target players (0 for
+			/// all peers) in a single datagram. larger unreliable packets exceed the receive buffer of the peers, unless
+			/// fragmentation is enabled via GameSparksRTSessionBuilder::EnableFragmentation().
+			static int MaxDatagramPayloadSize(int targetPlayers);
+
 			/// <summary>
 			/// Log level.
 			/// </summary>
@@ -2,6 +2,7 @@
 #define _GAMESPARKSRT_PACKET_EXT_HPP_
 
 #include "../Forwards.hpp"
+#include "../RTVector.hpp"
 #include "System/Nullable.hpp"
 #include "System/FailableForward.hpp"
 #include "../GSLinking.hpp"
@@ -9,6 +10,17 @@
 //#include <string>
 #include <cstdint>
 
+namespace System {
+
+	/// RTData holds its values in RTVals, so it is still incomplete where RTVal declares its Nullable<RTData>
+	template <>
+	struct NullableOnHeap<GameSparks::RT::RTData>
+	{
+		static const bool value = true;
+	};
+
+}
+
 namespace GameSparks { namespace RT {
 
 	/// protocol related classes
@@ -29,6 +41,10 @@ namespace GameSparks { namespace RT {
             /// return true, if any of the values is set
             explicit operator bool() const;
 
+            /// true, if both hold the same type and value
+            bool operator == (const RTVal& o) const;
+            bool operator != (const RTVal& o) const { return !(*this == o); }
+
             friend gsstl::ostream& operator << (gsstl::ostream& os, const RTVal&);
 		private:
             friend class RTValSerializer;
@@ -36,7 +52,7 @@ namespace GameSparks { namespace RT {
             friend RTData;
 
 			static System::Failable<void> DeserializeLengthDelimited(System::IO::Stream& stream, System::IO::BinaryReader& br, RTVal& instance);
-			System::Failable<void> SerializeLengthDelimited(System::IO::Stream& stream);
+			System::Failable<void> SerializeLengthDelimited(System::IO::Stream& stream) const;
 
 			//TODO: compacter storage, by using type enum and union (or something like boost::variant)
 			System::Nullable<int64_t> long_val;
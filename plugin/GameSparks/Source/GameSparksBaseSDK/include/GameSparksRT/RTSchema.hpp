@@ -0,0 +1,498 @@
+#ifndef _GAMESPARKSRT_RTSCHEMA_HPP_
+#define _GAMESPARKSRT_RTSCHEMA_HPP_
+
+#include "System/Bytes.hpp"
+#include "System/ArraySegment.hpp"
+#include "../GameSparks/gsstl.h"
+
+#include <cassert>
+#include <cmath>
+#include <cstring>
+#include <cstdint>
+#include <type_traits>
+
+namespace GameSparks { namespace RT {
+
+	/*!
+	 * Appends bit fields to a byte buffer, least significant bit first. Used by RTSchema.
+	 */
+	class RTBitWriter
+	{
+		public:
+			/// appends to bytes, which has to outlive the writer. call Flush() when done.
+			explicit RTBitWriter(System::Bytes& bytes_)
+			:bytes(bytes_)
+			,scratch(0)
+			,scratchBits(0)
+			{}
+
+			~RTBitWriter()
+			{
+				assert(scratchBits == 0 && "Flush() not called");
+			}
+
+			/// writes the lower bits (at most 32) of value
+			void WriteBits(uint32_t value, int bits)
+			{
+				assert(bits >= 0 && bits <= 32);
+				if (bits == 0)
+				{
+					return;
+				}
+				scratch |= uint64_t(value & (uint32_t(0xFFFFFFFFu) >> (32 - bits))) << scratchBits;
+				scratchBits += bits;
+				while (scratchBits >= 8)
+				{
+					bytes.push_back(System::Byte(scratch));
+					scratch >>= 8;
+					scratchBits -= 8;
+				}
+			}
+
+			void WriteBool(bool value)
+			{
+				WriteBits(value ? 1 : 0, 1);
+			}
+
+			/// writes value in groups of 7 bits, each followed by a continuation bit
+			void WriteVarInt(uint64_t value)
+			{
+				while (value >= 0x80)
+				{
+					WriteBits(uint32_t(value & 0x7F) | 0x80, 8);
+					value >>= 7;
+				}
+				WriteBits(uint32_t(value), 8);
+			}
+
+			/// pads the last byte with zeros
+			void Flush()
+			{
+				if (scratchBits > 0)
+				{
+					bytes.push_back(System::Byte(scratch));
+					scratch = 0;
+					scratchBits = 0;
+				}
+			}
+
+		private:
+			RTBitWriter(const RTBitWriter&);
+			RTBitWriter& operator=(const RTBitWriter&);
+
+			System::Bytes& bytes;
+			uint64_t scratch;
+			int scratchBits;
+	};
+
+	/*!
+	 * Reads the bit fields written by RTBitWriter. Reading past the end yields zeros and sets IsOverrun().
+	 */
+	class RTBitReader
+	{
+		public:
+			RTBitReader(const System::Byte* data_, int size_)
+			:data(data_)
+			,size(size_)
+			,position(0)
+			,scratch(0)
+			,scratchBits(0)
+			,overrun(false)
+			{}
+
+			explicit RTBitReader(const System::ArraySegment<System::Byte>& segment)
+			:data(segment.Array().empty() ? nullptr : &segment.Array()[0] + segment.Offset())
+			,size(segment.Count())
+			,position(0)
+			,scratch(0)
+			,scratchBits(0)
+			,overrun(false)
+			{}
+
+			uint32_t ReadBits(int bits)
+			{
+				assert(bits >= 0 && bits <= 32);
+				if (bits == 0)
+				{
+					return 0;
+				}
+				while (scratchBits < bits)
+				{
+					if (position == size)
+					{
+						overrun = true;
+						return 0;
+					}
+					scratch |= uint64_t(data[position++]) << scratchBits;
+					scratchBits += 8;
+				}
+				const uint32_t value = uint32_t(scratch & (uint64_t(0xFFFFFFFFu) >> (32 - bits)));
+				scratch >>= bits;
+				scratchBits -= bits;
+				return value;
+			}
+
+			bool ReadBool()
+			{
+				return ReadBits(1) != 0;
+			}
+
+			uint64_t ReadVarInt()
+			{
+				uint64_t value = 0;
+				for (int shift = 0; shift < 64; shift += 7)
+				{
+					const uint32_t group = ReadBits(8);
+					value |= uint64_t(group & 0x7F) << shift;
+					if ((group & 0x80) == 0)
+					{
+						return value;
+					}
+				}
+				overrun = true; // more than ten groups
+				return 0;
+			}
+
+			/// skips the padding of the current byte, e.g. to read the next object written after RTBitWriter::Flush()
+			void AlignToByte()
+			{
+				scratch = 0;
+				scratchBits = 0;
+			}
+
+			/// true, if a read went past the end of the data
+			bool IsOverrun() const { return overrun; }
+
+			/// true, if all bytes have been consumed
+			bool IsAtEnd() const { return position == size; }
+
+		private:
+			const System::Byte* data;
+			int size;
+			int position;
+			uint64_t scratch;
+			int scratchBits;
+			bool overrun;
+	};
+
+	/*!
+	 * Field descriptors for RTSchema. Each names a member of the struct and the way it is packed.
+	 * Use GS_RT_SCHEMA_MEMBER to name the member, e.g.
+	 *
+	 * @code
+	 * struct Vec3 { float x, y, z; };
+	 * struct Quat { float x, y, z, w; };
+	 * struct Entity { uint32_t id; Vec3 position; Quat rotation; int16_t health; bool firing; };
+	 *
+	 * typedef RTSchema<Entity,
+	 *     Schema::VarInt<GS_RT_SCHEMA_MEMBER(Entity, id)>,
+	 *     Schema::QuantizedVector3<GS_RT_SCHEMA_MEMBER(Entity, position), -1024, 1024, 100>, // 1 cm over +-10 m
+	 *     Schema::SmallestThree<GS_RT_SCHEMA_MEMBER(Entity, rotation), 10>,
+	 *     Schema::Range<GS_RT_SCHEMA_MEMBER(Entity, health), 0, 1000>,
+	 *     Schema::Bool<GS_RT_SCHEMA_MEMBER(Entity, firing)>
+	 * > EntitySchema; // 105 bits per entity with an id below 128
+	 * @endcode
+	 */
+	namespace Schema {
+
+		/// number of bits needed to store values from 0 to MaxValue
+		template <uint64_t MaxValue>
+		struct BitsFor
+		{
+			enum { value = 1 + BitsFor<(MaxValue >> 1)>::value };
+		};
+
+		template <>
+		struct BitsFor<0>
+		{
+			enum { value = 0 };
+		};
+
+		inline uint32_t Quantize(float value, float min, float stepsPerUnit, uint32_t maxStep)
+		{
+			if (!(value > min)) // also maps NaN to min
+			{
+				return 0;
+			}
+			const float step = (value - min) * stepsPerUnit + 0.5f;
+			return step >= float(maxStep) ? maxStep : uint32_t(step);
+		}
+
+		inline float Dequantize(uint32_t step, float min, float max, float stepsPerUnit)
+		{
+			const float value = min + float(step) / stepsPerUnit;
+			return value < max ? value : max;
+		}
+
+		/// a bool, 1 bit
+		template <typename Struct, typename T, T Struct::*Member>
+		struct Bool
+		{
+			static const int MAX_BITS = 1;
+
+			static void Write(const Struct& s, RTBitWriter& writer) { writer.WriteBool(s.*Member != T()); }
+			static void Read(RTBitReader& reader, Struct& s) { s.*Member = T(reader.ReadBool()); }
+		};
+
+		/// an integer, 8 bits per 7 bits of its value. signed values are zigzag encoded, so that small negative values stay short.
+		/// use this for ids and counters without a known range.
+		template <typename Struct, typename T, T Struct::*Member>
+		struct VarInt
+		{
+			static_assert(std::is_integral<T>::value, "VarInt requires an integral member");
+			static const int MAX_BITS = (sizeof(T) * 8 + 6) / 7 * 8;
+
+			static void Write(const Struct& s, RTBitWriter& writer)
+			{
+				writer.WriteVarInt(std::is_signed<T>::value ? ZigZag(int64_t(s.*Member)) : uint64_t(s.*Member));
+			}
+
+			static void Read(RTBitReader& reader, Struct& s)
+			{
+				const uint64_t value = reader.ReadVarInt();
+				s.*Member = std::is_signed<T>::value ? T(UnZigZag(value)) : T(value);
+			}
+
+			static uint64_t ZigZag(int64_t value) { return (uint64_t(value) << 1) ^ uint64_t(value >> 63); }
+			static int64_t UnZigZag(uint64_t value) { return int64_t(value >> 1) ^ -int64_t(value & 1); }
+		};
+
+		/// an integer between Min and Max (inclusive), clamped on write
+		template <typename Struct, typename T, T Struct::*Member, int64_t Min, int64_t Max>
+		struct Range
+		{
+			static_assert(std::is_integral<T>::value || std::is_enum<T>::value, "Range requires an integral or enum member");
+			static_assert(Min < Max && uint64_t(Max - Min) <= 0xFFFFFFFFu, "Range has to span less than 2^32 values");
+			static const int MAX_BITS = BitsFor<uint64_t(Max - Min)>::value;
+
+			static void Write(const Struct& s, RTBitWriter& writer)
+			{
+				const int64_t value = int64_t(s.*Member);
+				writer.WriteBits(uint32_t((value < Min ? Min : value > Max ? Max : value) - Min), MAX_BITS);
+			}
+
+			static void Read(RTBitReader& reader, Struct& s)
+			{
+				const int64_t value = Min + int64_t(reader.ReadBits(MAX_BITS));
+				s.*Member = T(value > Max ? Max : value);
+			}
+		};
+
+		/// a float, uncompressed
+		template <typename Struct, typename T, T Struct::*Member>
+		struct Float
+		{
+			static const int MAX_BITS = 32;
+
+			static void Write(const Struct& s, RTBitWriter& writer)
+			{
+				float value = float(s.*Member);
+				uint32_t bits;
+				memcpy(&bits, &value, sizeof(bits));
+				writer.WriteBits(bits, 32);
+			}
+
+			static void Read(RTBitReader& reader, Struct& s)
+			{
+				const uint32_t bits = reader.ReadBits(32);
+				float value;
+				memcpy(&value, &bits, sizeof(value));
+				s.*Member = T(value);
+			}
+		};
+
+		/// a float between Min and Max, clamped on write and stored with a precision of 1 / StepsPerUnit
+		template <typename Struct, typename T, T Struct::*Member, int Min, int Max, int StepsPerUnit>
+		struct QuantizedFloat
+		{
+			static_assert(Min < Max && StepsPerUnit > 0, "invalid QuantizedFloat range");
+			static_assert(uint64_t(int64_t(Max) - Min) * StepsPerUnit <= 0xFFFFFFFFu, "QuantizedFloat needs more than 32 bits");
+			static const uint32_t MAX_STEP = uint32_t(uint64_t(int64_t(Max) - Min) * StepsPerUnit);
+			static const int MAX_BITS = BitsFor<MAX_STEP>::value;
+
+			static void Write(const Struct& s, RTBitWriter& writer)
+			{
+				writer.WriteBits(Quantize(float(s.*Member), float(Min), float(StepsPerUnit), MAX_STEP), MAX_BITS);
+			}
+
+			static void Read(RTBitReader& reader, Struct& s)
+			{
+				s.*Member = T(Dequantize(reader.ReadBits(MAX_BITS), float(Min), float(Max), float(StepsPerUnit)));
+			}
+		};
+
+		/// a vector with float members x, y and z, each quantized like QuantizedFloat
+		template <typename Struct, typename T, T Struct::*Member, int Min, int Max, int StepsPerUnit>
+		struct QuantizedVector3
+		{
+			static_assert(Min < Max && StepsPerUnit > 0, "invalid QuantizedVector3 range");
+			static_assert(uint64_t(int64_t(Max) - Min) * StepsPerUnit <= 0xFFFFFFFFu, "QuantizedVector3 needs more than 32 bits per component");
+			static const uint32_t MAX_STEP = uint32_t(uint64_t(int64_t(Max) - Min) * StepsPerUnit);
+			static const int COMPONENT_BITS = BitsFor<MAX_STEP>::value;
+			static const int MAX_BITS = 3 * COMPONENT_BITS;
+
+			static void Write(const Struct& s, RTBitWriter& writer)
+			{
+				const T& v = s.*Member;
+				writer.WriteBits(Quantize(float(v.x), float(Min), float(StepsPerUnit), MAX_STEP), COMPONENT_BITS);
+				writer.WriteBits(Quantize(float(v.y), float(Min), float(StepsPerUnit), MAX_STEP), COMPONENT_BITS);
+				writer.WriteBits(Quantize(float(v.z), float(Min), float(StepsPerUnit), MAX_STEP), COMPONENT_BITS);
+			}
+
+			static void Read(RTBitReader& reader, Struct& s)
+			{
+				T& v = s.*Member;
+				v.x = Dequantize(reader.ReadBits(COMPONENT_BITS), float(Min), float(Max), float(StepsPerUnit));
+				v.y = Dequantize(reader.ReadBits(COMPONENT_BITS), float(Min), float(Max), float(StepsPerUnit));
+				v.z = Dequantize(reader.ReadBits(COMPONENT_BITS), float(Min), float(Max), float(StepsPerUnit));
+			}
+		};
+
+		/*!
+		 * A unit quaternion with float members x, y, z and w, compressed "smallest three": the index of the largest component
+		 * (2 bits) and the other three components with ComponentBits each. The largest component is restored from the unit
+		 * length. Its sign is not stored, as q and -q represent the same rotation. 10 bits per component give an error of about 0.1 degrees.
+		 */
+		template <typename Struct, typename T, T Struct::*Member, int ComponentBits>
+		struct SmallestThree
+		{
+			static_assert(ComponentBits >= 2 && ComponentBits <= 30, "invalid number of bits per quaternion component");
+			static const int MAX_BITS = 2 + 3 * ComponentBits;
+			static const uint32_t MAX_STEP = (uint32_t(1) << ComponentBits) - 1;
+
+			static void Write(const Struct& s, RTBitWriter& writer)
+			{
+				const T& q = s.*Member;
+				float c[4] = { float(q.x), float(q.y), float(q.z), float(q.w) };
+
+				int largest = 0;
+				for (int i = 1; i != 4; ++i)
+				{
+					if (std::fabs(c[i]) > std::fabs(c[largest]))
+					{
+						largest = i;
+					}
+				}
+
+				const float sign = c[largest] < 0 ? -1.0f : 1.0f;
+				const float range = 0.70710678f; // the three smaller components of a unit quaternion are within +-1/sqrt(2)
+				const float stepsPerUnit = float(MAX_STEP) / (2 * range);
+
+				writer.WriteBits(uint32_t(largest), 2);
+				for (int i = 0; i != 4; ++i)
+				{
+					if (i != largest)
+					{
+						writer.WriteBits(Quantize(c[i] * sign, -range, stepsPerUnit, MAX_STEP), ComponentBits);
+					}
+				}
+			}
+
+			static void Read(RTBitReader& reader, Struct& s)
+			{
+				const float range = 0.70710678f;
+				const float stepsPerUnit = float(MAX_STEP) / (2 * range);
+
+				const int largest = int(reader.ReadBits(2));
+				float c[4];
+				float sum = 0;
+				for (int i = 0; i != 4; ++i)
+				{
+					if (i != largest)
+					{
+						c[i] = Dequantize(reader.ReadBits(ComponentBits), -range, range, stepsPerUnit);
+						sum += c[i] * c[i];
+					}
+				}
+				c[largest] = sum < 1 ? std::sqrt(1 - sum) : 0;
+
+				T& q = s.*Member;
+				q.x = c[0];
+				q.y = c[1];
+				q.z = c[2];
+				q.w = c[3];
+			}
+		};
+
+		template <typename... Fields>
+		struct FieldList;
+
+		template <>
+		struct FieldList<>
+		{
+			static const int MAX_BITS = 0;
+
+			template <typename Struct> static void Write(const Struct&, RTBitWriter&) {}
+			template <typename Struct> static void Read(RTBitReader&, Struct&) {}
+		};
+
+		template <typename Field, typename... Fields>
+		struct FieldList<Field, Fields...>
+		{
+			static const int MAX_BITS = Field::MAX_BITS + FieldList<Fields...>::MAX_BITS;
+
+			template <typename Struct>
+			static void Write(const Struct& s, RTBitWriter& writer)
+			{
+				Field::Write(s, writer);
+				FieldList<Fields...>::Write(s, writer);
+			}
+
+			template <typename Struct>
+			static void Read(RTBitReader& reader, Struct& s)
+			{
+				Field::Read(reader, s);
+				FieldList<Fields...>::Read(reader, s);
+			}
+		};
+	}
+
+	/// expands to the struct, type and pointer of a member, as expected by the field descriptors in the Schema namespace
+	#define GS_RT_SCHEMA_MEMBER(Struct, member) Struct, decltype(Struct::member), &Struct::member
+
+	/*!
+	 * Packs the fields of a struct into as few bits as their descriptors (see the Schema namespace) allow, e.g. for
+	 * IRTSession::SendBytes(). Fields are packed in the order of the descriptors, without tags, so sender and receiver
+	 * have to use the same schema.
+	 *
+	 * Several structs can be written to the same RTBitWriter back to back, e.g. the entities of a snapshot preceded by their
+	 * count (RTBitWriter::WriteVarInt()). They are only padded to a full byte by RTBitWriter::Flush().
+	 */
+	template <typename Struct, typename... Fields>
+	class RTSchema
+	{
+		public:
+			/// the maximum size of an encoded struct in bits
+			static const int MAX_BITS = Schema::FieldList<Fields...>::MAX_BITS;
+
+			static void Encode(const Struct& s, RTBitWriter& writer)
+			{
+				Schema::FieldList<Fields...>::Write(s, writer);
+			}
+
+			/// returns false, if reader ran out of data. s is partially assigned in that case.
+			static bool Decode(RTBitReader& reader, Struct& s)
+			{
+				Schema::FieldList<Fields...>::Read(reader, s);
+				return !reader.IsOverrun();
+			}
+
+			/// appends s, padded to a full byte, to bytes
+			static void Encode(const Struct& s, System::Bytes& bytes)
+			{
+				RTBitWriter writer(bytes);
+				Encode(s, writer);
+				writer.Flush();
+			}
+
+			/// decodes a struct encoded by Encode(const Struct&, System::Bytes&)
+			static bool Decode(const System::ArraySegment<System::Byte>& bytes, Struct& s)
+			{
+				RTBitReader reader(bytes);
+				return Decode(reader, s);
+			}
+	};
+
+}} /* namespace GameSparks.RT */
+
+#endif /* _GAMESPARKSRT_RTSCHEMA_HPP_ */
@@ -7,9 +7,107 @@
 //#include <ostream>
 #include "../GameSparksRT/GSLinking.hpp"
 #include "../GameSparks/gsstl.h"
+#include <type_traits>
+#include <cassert>
+#include <new>
 
 namespace System {
 
+    /// true for the types a Nullable keeps on the heap. specialized for types, which are still incomplete where a
+    /// Nullable of them is declared, like RTData in RTVal. everything else is stored in place.
+    template <class T>
+    struct NullableOnHeap
+    {
+        static const bool value = false;
+    };
+
+    namespace Detail
+    {
+        /// the value of a Nullable, allocated on the heap
+        template <class T, bool Inline>
+        class NullableStorage
+        {
+            public:
+                NullableStorage() : val(nullptr) {}
+                ~NullableStorage() { delete val; }
+
+                T* Get() const { return val; }
+
+                /// only called on empty storage, by the constructors of Nullable
+                void Set(const T& v)
+                {
+                    assert(!val);
+                    val = new T(v);
+                }
+
+                void Swap(NullableStorage& o)
+                {
+                    using gsstl::swap;
+                    swap(val, o.val);
+                }
+            private:
+                NullableStorage(const NullableStorage&);
+                NullableStorage& operator=(const NullableStorage&);
+
+                T* val;
+        };
+
+        /// the value of a Nullable, stored in place, so that e.g. reading a Failable<Key> or copying an RTData with
+        /// strings and vectors does not allocate.
+        template <class T>
+        class NullableStorage<T, true>
+        {
+            public:
+                NullableStorage() : hasValue(false) {}
+                ~NullableStorage() { Reset(); }
+
+                T* Get() const { return hasValue ? const_cast<T*>(reinterpret_cast<const T*>(&val)) : nullptr; }
+
+                /// only called on empty storage, by the constructors of Nullable
+                void Set(const T& v)
+                {
+                    assert(!hasValue);
+                    new (&val) T(v);
+                    hasValue = true;
+                }
+
+                /// by moving, as the values may not be assignable, like Key
+                void Swap(NullableStorage& o)
+                {
+                    NullableStorage tmp;
+                    tmp.Take(*this);
+                    Take(o);
+                    o.Take(tmp);
+                }
+            private:
+                NullableStorage(const NullableStorage&);
+                NullableStorage& operator=(const NullableStorage&);
+
+                /// moves the value of o, if any, into this empty storage and empties o
+                void Take(NullableStorage& o)
+                {
+                    assert(!hasValue);
+                    if (o.hasValue)
+                    {
+                        new (&val) T(gsstl::move(*o.Get()));
+                        hasValue = true;
+                        o.Reset();
+                    }
+                }
+
+                void Reset()
+                {
+                    if (hasValue)
+                    {
+                        Get()->~T();
+                        hasValue = false;
+                    }
+                }
+
+                typename std::aligned_storage<sizeof(T), std::alignment_of<T>::value>::type val;
+                bool hasValue;
+        };
+    }
 
     /*! Represents a value type that can be assigned null. This is similar to boost::optional<T>.
      *
@@ -30,31 +128,25 @@ namespace System {
             typedef T value_type;
 
             /// constructs a nulled instance
-            Nullable() /* noexcept */
-            :val(nullptr) { }
+            Nullable() /* noexcept */ { }
 
             /// copy constructor
             Nullable(const Nullable& o)
-            :val(o.HasValue()?new T(*o.val):nullptr) { }
+            {
+                if (o.HasValue()) storage.Set(o.Value());
+            }
 
             /// copy construct a nullable from a T.
             Nullable(const T& v)
-            :val(nullptr)
             {
-                assert(val != &v);
-                delete val;
-                val = new T(v);
+                storage.Set(v);
             }
 
             /// copy construct from a compatible type
             template <typename CompatibleType>
             Nullable(const Nullable<CompatibleType>& o)
-            :val(o.HasValue()?new T(*o.val):nullptr) { }
-
-            /// destructor
-            ~Nullable()
             {
-                delete val;
+                if (o.HasValue()) storage.Set(o.Value());
             }
 
             /// copy constructor
@@ -66,8 +158,7 @@ namespace System {
 
             friend void swap(Nullable& a, Nullable& b)
             {
-                using gsstl::swap;
-                swap(a.val, b.val);
+                a.storage.Swap(b.storage);
             }
 
             const T* operator ->() const { return &Value(); }
@@ -75,26 +166,26 @@ namespace System {
             const T& operator *() const  { return Value(); }
             T& operator *()              { return Value(); }
 
-            //explicit operator bool() const /* noexcept */ { return val != nullptr; }
+            //explicit operator bool() const /* noexcept */ { return HasValue(); }
 
             /// returns the value. make sure to check via HasValue() first or use GetValueOrDefault().
             T const& Value() const
             {
-                assert(val);
-                return *val;
+                assert(HasValue());
+                return *storage.Get();
             }
 
             /// returns the value. make sure to check via HasValue() first or use GetValueOrDefault().
             T& Value()
             {
-                assert(val);
-                return *val;
+                assert(HasValue());
+                return *storage.Get();
             }
 
             /// return true, if this value is not null.
             bool HasValue() const
             {
-                return val != nullptr;
+                return storage.Get() != nullptr;
             }
 
             /// returns the value or if it is not set returns the default value.
@@ -107,20 +198,21 @@ namespace System {
             /// comparison operator
             bool operator == (const Nullable<T>& o) const
             {
-                return (!val && !o.val) || (*val == *o.val);
+                if (!HasValue() || !o.HasValue()) return HasValue() == o.HasValue();
+                return Value() == o.Value();
             }
 
             /// comparison operator
             bool operator == (const T& o) const
             {
-                if(!val) return false;
-                return (*val == o);
+                if(!HasValue()) return false;
+                return (Value() == o);
             }
 
             /*friend bool operator == (const T& a, const Nullable<T>& b)
             {
-                if(!b.val) return false;
-                return a == *b.val;
+                if(!b.HasValue()) return false;
+                return a == b.Value();
             }*/
 
             /// ostream operator for debug output.
@@ -131,8 +223,7 @@ namespace System {
                 return os;
             }
         private:
-            template<typename U> friend class Nullable;
-            T* val;
+            Detail::NullableStorage<T, !NullableOnHeap<T>::value> storage;
     };
 } // namespace std
 
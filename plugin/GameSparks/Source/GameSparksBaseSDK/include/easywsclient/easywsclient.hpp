@@ -73,6 +73,10 @@ public:
 
 	virtual void abort() = 0;
 
+	/// true, if recv() would not block: data or an error is waiting. checked without blocking.
+	/// sockets that cannot tell return true.
+	virtual bool readable() { return true; }
+
 	gsstl::string get_error_string() { return error_string; }
 	virtual ~BaseSocket() {}
 
@@ -128,6 +132,17 @@ namespace easywsclient {
 		virtual void close() = 0;
 		virtual readyStateValues getReadyState() const = 0;
 
+		/// number of bytes queued by send() that have not been written to the socket yet.
+		/// implementations that hand every frame to the OS right away return 0.
+		virtual size_t getBufferedAmount() const { return 0; }
+
+		/// number of bytes received from the socket that have not been dispatched yet.
+		virtual size_t getReceivedAmount() const { return 0; }
+
+		/// true, if poll() or dispatch() have something to do: connecting, buffered frames or input waiting on the socket.
+		/// checked without blocking. implementations that cannot tell return true until the websocket is closed.
+		virtual bool needsPoll() const { return getReadyState() != CLOSED; }
+
 		void dispatch(WSMessageCallback messageCallback, WSErrorCallback errorCallback, void* userData) {
 			_dispatch(messageCallback, errorCallback, userData);
 		}
@@ -35,6 +35,7 @@ GS::GS()
     , GameSparksAuthenticated()
     , OnNonce()
     , OnPersistentQueueLoadedCallback()
+    , OnRequestMetrics()
     , m_GSPlatform(NULL)
     , m_RequestCounter(0)
     , m_Ready(false)
@@ -42,10 +43,17 @@ GS::GS()
     , m_Initialized(false)
     , m_durableQueuePaused(false)
     , m_durableQueueRunning(true)
+    , m_NetworkThreadEnabled(false)
+    , m_DispatchBudgetMessages(0)
+    , m_DispatchBudgetSeconds(0.002f)
+    , m_DispatchedMessages(0)
+    , m_RequestMetricsInterval(60.0f)
+    , m_RequestMetricsDueIn(60.0f)
     , m_SessionId("")
 	, m_connectionAttempts(1)
 	, m_mustBeConnectedIn(0.0f)
     , m_sendNextDurableRequestIn(0.0f)
+    , m_TimeUntilUpdateRequired(0.0f)
 {
 	/*
 		If this assertion fails, your compiler fails to initialize
@@ -67,6 +75,7 @@ GS::~GS()
 	m_Connections.clear();
 
 	ClearAllMessageListeners();
+	ClearUserDataHandles();
 }
 
 void GS::ClearAllMessageListeners()
@@ -82,6 +91,7 @@ void GS::Initialise(IGSPlatform* gSPlatform)
 {
 	m_Initialized = true;
 	m_Paused = false;
+	m_TimeUntilUpdateRequired = 0;
 	m_GSPlatform = gSPlatform;
 	m_ServiceUrl = buildServiceUrl(m_GSPlatform);
 
@@ -135,6 +145,7 @@ void GS::Stop(bool termiante)
 		if (termiante) connection->Terminate();
 		else connection->Stop();
 	}
+	m_TimeUntilUpdateRequired = 0;
 
 
 	SetAvailability(false);
@@ -144,7 +155,18 @@ void GS::OnMessageReceived(const gsstl::string& message, GSConnection& connectio
 {
 	GS_CODE_TIMING_ASSERT();
 
+	IGSProfiler* profiler = GetProfiler();
+	if (profiler) profiler->BeginScope(IGSProfiler::SCOPE_JSON_PARSE);
 	GSObject response = GSObject::FromJSON(message);
+	if (profiler) profiler->EndScope(IGSProfiler::SCOPE_JSON_PARSE);
+
+	OnMessageReceived(response, connection);
+}
+
+void GS::OnMessageReceived(GSObject& response, GSConnection& connection)
+{
+	GS_CODE_TIMING_ASSERT();
+	GSProfilerScope profilerScope(GetProfiler(), IGSProfiler::SCOPE_CALLBACK_DISPATCH);
 
 	if (response.ContainsKey("connectUrl"))
 	{
@@ -274,14 +296,20 @@ void GameSparks::Core::GS::SendDurable(GSRequest& request)
 {
 	request.AddString("requestId", GetUniqueRequestId(true));
     request.m_durableAttempts = 0;
+	request.m_QueuedAt = gsstl::chrono::steady_clock::now();
 	request.m_expiresInSeconds = 0.0f;//GSClientConfig::instance().getRequestTimeout() + GSClientConfig::instance().ComputeSleepPeriod(request.m_durableAttempts);
 	m_PersistentQueue.push_front(request);
+	m_TimeUntilUpdateRequired = 0;
 	WritePersistentQueue();
 }
 
 void GameSparks::Core::GS::Send(GSRequest& request)
 {
     assert(request.m_expiresInSeconds > Seconds(0));
+	AttachUserDataHandle(request);
+	request.m_QueuedAt = gsstl::chrono::steady_clock::now();
+	m_TimeUntilUpdateRequired = 0;
+
 	if (request.GetDurable())
 	{
 		SendDurable(request);
@@ -299,7 +327,13 @@ void GameSparks::Core::GS::Send(GSRequest& request)
 	}
 	else
 	{
-		m_SendQueue.push_back(request);
+		// keep the queue ordered by priority, so that the most urgent requests go out first once connected
+		t_SendQueue::iterator position = m_SendQueue.begin();
+		while (position != m_SendQueue.end() && position->GetPriority() <= request.GetPriority())
+		{
+			++position;
+		}
+		m_SendQueue.insert(position, request);
 	}
 }
 
@@ -309,9 +343,213 @@ void GS::Update(Seconds deltaTimeInSeconds)
 	if (m_Initialized)
 	{
 		m_mustBeConnectedIn -= deltaTimeInSeconds;
+
+		m_DispatchedMessages = 0;
+		m_DispatchStart = gsstl::chrono::steady_clock::now();
 		UpdateConnections(deltaTimeInSeconds);
+		if (m_DispatchedMessages > 0)
+		{
+			m_DispatchTimeHistogram.Add(gsstl::chrono::duration_cast<gsstl::chrono::microseconds>(gsstl::chrono::steady_clock::now() - m_DispatchStart).count() / 1000000.0f);
+		}
+
 		ProcessQueues(deltaTimeInSeconds);
+		ReportRequestMetrics(deltaTimeInSeconds);
+
+		if (IGSProfiler* profiler = GetProfiler())
+		{
+			ReportProfilerCounters(*profiler);
+		}
+
+		m_TimeUntilUpdateRequired = ComputeTimeUntilUpdateRequired();
+	}
+}
+
+IGSProfiler* GS::GetProfiler() const
+{
+	return m_GSPlatform ? m_GSPlatform->GetProfiler() : 0;
+}
+
+void GS::ReportProfilerCounters(IGSProfiler& profiler) const
+{
+	long long counters[IGSProfiler::COUNTER_COUNT] = {};
+
+	counters[IGSProfiler::COUNTER_SEND_QUEUE] = m_SendQueue.size();
+	counters[IGSProfiler::COUNTER_DURABLE_QUEUE] = m_PersistentQueue.size();
+
+	for (t_ConnectionContainer::const_iterator it = m_Connections.begin(); it != m_Connections.end(); ++it)
+	{
+		(*it)->AddProfilerCounters(counters);
+	}
+
+	for (int i = 0; i != IGSProfiler::COUNTER_COUNT; ++i)
+	{
+		profiler.SetCounter(static_cast<IGSProfiler::Counter>(i), counters[i]);
+	}
+}
+
+void GS::SetRequestMetricsInterval(Seconds interval)
+{
+	m_RequestMetricsInterval = interval;
+	m_RequestMetricsDueIn = interval;
+	m_TimeUntilUpdateRequired = 0;
+}
+
+void GS::ReportRequestMetrics(Seconds deltaTimeInSeconds)
+{
+	if (!OnRequestMetrics || m_RequestMetricsInterval <= 0)
+	{
+		return;
+	}
+
+	m_RequestMetricsDueIn -= deltaTimeInSeconds;
+	if (m_RequestMetricsDueIn <= 0)
+	{
+		m_RequestMetricsDueIn = m_RequestMetricsInterval;
+		OnRequestMetrics(*this, m_RequestMetrics);
+	}
+}
+
+static Seconds SecondsSince(const gsstl::chrono::steady_clock::time_point& start, const gsstl::chrono::steady_clock::time_point& now)
+{
+	return gsstl::chrono::duration_cast<gsstl::chrono::microseconds>(now - start).count() / 1000000.0f;
+}
+
+void GS::OnRequestSent(GSRequest& request)
+{
+	const gsstl::chrono::steady_clock::time_point now = gsstl::chrono::steady_clock::now();
+	const bool retry = request.GetDurable() && request.m_durableAttempts > 1;
+
+	// a retry has been waiting for its backoff, not for a connection
+	const bool queueWaitKnown = !retry && request.m_QueuedAt != gsstl::chrono::steady_clock::time_point();
+	m_RequestMetrics.AddSent(request.GetType().GetValueOrDefault(""), queueWaitKnown ? SecondsSince(request.m_QueuedAt, now) : Seconds(-1));
+
+	if (retry)
+	{
+		m_RequestMetrics.AddDurableRetry(request.GetType().GetValueOrDefault(""));
+	}
+
+	request.m_SentAt = now;
+}
+
+void GS::OnRequestCompleted(const GSRequest& request, const GSObject& response)
+{
+	GSRequestMetrics::Outcome outcome = GSRequestMetrics::OUTCOME_SUCCESS;
+	if (response.ContainsKey("error"))
+	{
+		// CancelRequest() reports timeouts as ClientError
+		outcome = response.GetType().GetValueOrDefault("") == "ClientError" ? GSRequestMetrics::OUTCOME_TIMEOUT : GSRequestMetrics::OUTCOME_ERROR;
+	}
+
+	const bool sent = request.m_SentAt != gsstl::chrono::steady_clock::time_point();
+	m_RequestMetrics.AddCompleted(request.GetType().GetValueOrDefault(""), outcome, sent ? SecondsSince(request.m_SentAt, gsstl::chrono::steady_clock::now()) : 0);
+}
+
+void GS::SetDispatchBudget(int maxMessages, Seconds maxSeconds)
+{
+	m_DispatchBudgetMessages = maxMessages;
+	m_DispatchBudgetSeconds = maxSeconds;
+}
+
+bool GS::HasDispatchBudget() const
+{
+	if (m_DispatchedMessages == 0)
+	{
+		return true;
+	}
+
+	if (m_DispatchBudgetMessages > 0 && m_DispatchedMessages >= m_DispatchBudgetMessages)
+	{
+		return false;
+	}
+
+	if (m_DispatchBudgetSeconds > 0 &&
+		gsstl::chrono::steady_clock::now() - m_DispatchStart >= gsstl::chrono::microseconds(static_cast<long long>(m_DispatchBudgetSeconds * 1000000.0f)))
+	{
+		return false;
+	}
+
+	return true;
+}
+
+Seconds GS::GetTimeUntilUpdateRequired() const
+{
+	if (!m_Initialized)
+	{
+		return gsstl::numeric_limits<Seconds>::max();
+	}
+
+	// the only work that arrives between two updates without a call into GS
+	for (t_ConnectionContainer::const_iterator it = m_Connections.begin(); it != m_Connections.end(); ++it)
+	{
+		if ((*it)->HasWork())
+		{
+			return 0;
+		}
+	}
+
+	return m_TimeUntilUpdateRequired;
+}
+
+Seconds GS::ComputeTimeUntilUpdateRequired() const
+{
+	Seconds next = gsstl::numeric_limits<Seconds>::max();
+
+	// ConnectIfRequired() and TrimOldConnections() act on this timer. while paused, e.g. after Disconnect(),
+	// no connection is made, so there is nothing to wait for.
+	if (!m_Paused && (m_Connections.empty() || m_Connections[0]->m_Stopped || !m_Connections[0]->GetReady()))
+	{
+		next = gsstl::min(next, m_mustBeConnectedIn);
+	}
+
+	for (t_ConnectionContainer::const_iterator it = m_Connections.begin(); it != m_Connections.end(); ++it)
+	{
+		const GSConnection* connection = *it;
+
+		if (connection->HasWork() || (connection->m_Stopped && connection->m_PendingRequests.empty()))
+		{
+			return 0;
+		}
+
+		if (connection->IsWebSocketConnectionAlive())
+		{
+			// keep alive
+			next = gsstl::min(next, Seconds(60) - connection->m_lastActivity);
+		}
+
+		for (GSConnection::t_RequestMap::const_iterator request = connection->m_PendingRequests.begin(); request != connection->m_PendingRequests.end(); ++request)
+		{
+			next = gsstl::min(next, request->second.m_expiresInSeconds);
+		}
+	}
+
+	if (OnRequestMetrics && m_RequestMetricsInterval > 0)
+	{
+		next = gsstl::min(next, m_RequestMetricsDueIn);
+	}
+
+	const bool ready = !m_Connections.empty() && m_Connections[0]->GetReady();
+
+	if (!m_SendQueue.empty())
+	{
+		if (ready)
+		{
+			return 0;
+		}
+		next = gsstl::min(next, m_SendQueue.front().m_expiresInSeconds);
+	}
+
+	// durable requests are only (re-)sent while connected. this ignores the limit of concurrent durable requests,
+	// which can only cause an early update.
+	if (ready && m_durableQueueRunning && !m_durableQueuePaused)
+	{
+		for (t_PersistentQueue::const_iterator request = m_PersistentQueue.begin(); request != m_PersistentQueue.end(); ++request)
+		{
+			const Seconds due = request->m_expiresInSeconds > m_sendNextDurableRequestIn ? request->m_expiresInSeconds : m_sendNextDurableRequestIn;
+			next = gsstl::min(next, due);
+		}
 	}
+
+	return next > 0 ? next : 0;
 }
 
 void GameSparks::Core::GS::DebugLog(const gsstl::string& message)
@@ -451,6 +689,7 @@ void GameSparks::Core::GS::CancelRequest(GSRequest& request)
 	error.AddObject("error", GSRequestData().AddString("error", "timeout"));
 	error.AddString("requestId", request.GetString("requestId").GetValue());
 
+	OnRequestCompleted(request, error);
 	request.Complete(error);
 }
 
@@ -518,6 +757,7 @@ void GameSparks::Core::GS::ProcessReceivedResponse(const GSObject& response, GSC
 		{
 			GSRequest request = findIt->second;
 			connection->m_PendingRequests.erase(findIt);
+			OnRequestCompleted(request, response);
 
 			if (request.GetDurable())
 			{
@@ -566,6 +806,7 @@ bool GameSparks::Core::GS::GetDurableQueueRunning()
 void GameSparks::Core::GS::SetDurableQueueRunning(bool value)
 {
 	m_durableQueueRunning = value;
+	m_TimeUntilUpdateRequired = 0;
 }
 
 bool StringEndsWith(const gsstl::string& str, const gsstl::string& pattern)
@@ -636,6 +877,7 @@ void GameSparks::Core::GS::ProcessPersistentQueue(Seconds deltaTimeInSeconds)
 			{
 				request.m_durableAttempts++;
 				request.m_expiresInSeconds = GSClientConfig::instance().getRequestTimeout() + GSClientConfig::instance().ComputeSleepPeriod(request.m_durableAttempts);
+				request.SetPriority(GSRequest::PRIORITY_BACKGROUND); // durable requests are retried until they succeed, they must not delay interactive ones
 				m_Connections[0]->SendImmediate(request);
                 durableRequestsInFlight++;
                 m_sendNextDurableRequestIn = GSClientConfig::instance().getDurableDrainInterval();
@@ -685,6 +927,7 @@ void GameSparks::Core::GS::Reconnect()
 {
 	GS_CODE_TIMING_ASSERT();
 	m_Paused = false;
+	m_TimeUntilUpdateRequired = 0;
 	ConnectIfRequired();
 }
 
@@ -800,34 +1043,65 @@ void GS::ChangeUserDataForRequests(const void *from, void* to)
 	assert(m_Initialized);
 	assert(this->m_GSPlatform);
 
-	// erase from send queue
-	for (t_SendQueue::iterator i = m_SendQueue.begin(); i != m_SendQueue.end(); ++i)
+	// all requests sent with user-data *from* share a single handle, so there is no need to walk the queues
+	t_UserDataHandles::iterator it = m_UserDataHandles.find(from);
+	if (it == m_UserDataHandles.end())
 	{
-		if (i->GetUserData() == from)
-		{
-			i->SetUserData(to);
-		}
+		return;
 	}
 
-	for (t_PersistentQueue::iterator i = m_PersistentQueue.begin(); i != m_PersistentQueue.end(); ++i)
+	GSRequest::UserDataHandle* handle = it->second;
+	m_UserDataHandles.erase(it);
+	handle->userData = to;
+
+	if (to == 0)
 	{
-		if (i->GetUserData() == from)
-		{
-			i->SetUserData(to);
-		}
+		// the callbacks will not be called, there is nothing left to re-target
+		handle->index = 0;
+		return;
 	}
 
-	// also change it it on all pending requests in all connections
-	for (t_ConnectionContainer::iterator i = m_Connections.begin(); i != m_Connections.end(); ++i)
+	t_UserDataHandles::iterator existing = m_UserDataHandles.find(to);
+	if (existing == m_UserDataHandles.end())
 	{
-		for (GSConnection::t_RequestMap::iterator j = (*i)->m_PendingRequests.begin(); j != (*i)->m_PendingRequests.end(); ++j)
-		{
-			if (j->second.GetUserData() == from)
-			{
-				j->second.SetUserData(to);
-			}
-		}
+		m_UserDataHandles.insert(t_UserDataHandles::value_type(to, handle));
+	}
+	else
+	{
+		// merge into the handle of *to*, so that re-targeting *to* later covers the requests of both
+		handle->index = 0;
+		handle->forward = GSRequest::UserDataHandle::Retain(existing->second);
+	}
+}
+
+void GS::AttachUserDataHandle(GSRequest& request)
+{
+	if (!request.m_callbacks || request.m_callbacks->m_userDataHandle || request.m_userData == 0)
+	{
+		return;
+	}
+
+	t_UserDataHandles::iterator it = m_UserDataHandles.find(request.m_userData);
+	if (it == m_UserDataHandles.end())
+	{
+		// the reference of the new handle belongs to the request
+		GSRequest::UserDataHandle* handle = new GSRequest::UserDataHandle(request.m_userData, &m_UserDataHandles);
+		m_UserDataHandles.insert(t_UserDataHandles::value_type(request.m_userData, handle));
+		request.m_callbacks->m_userDataHandle = handle;
+		return;
+	}
+
+	request.m_callbacks->m_userDataHandle = GSRequest::UserDataHandle::Retain(it->second);
+}
+
+void GS::ClearUserDataHandles()
+{
+	// requests may outlive this instance, their handles must not touch the index anymore
+	for (t_UserDataHandles::iterator it = m_UserDataHandles.begin(); it != m_UserDataHandles.end(); ++it)
+	{
+		it->second->index = 0;
 	}
+	m_UserDataHandles.clear();
 }
 
 
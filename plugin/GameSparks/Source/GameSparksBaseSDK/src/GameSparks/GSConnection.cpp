@@ -9,6 +9,48 @@ using namespace GameSparks;
 using namespace GameSparks::Core;
 using namespace easywsclient;
 
+namespace
+{
+	/// how long the network thread sleeps, if there was nothing to receive
+	const int NetworkThreadIdleMilliseconds = 5;
+
+	/// easywsclient dispatches a single frame per call. this limits how many frames
+	/// the network thread takes from the receive buffer, before it hands them over.
+	const int NetworkThreadMaxFramesPerPoll = 64;
+
+	/// frames are only moved from the send lanes to the websocket while less than this is
+	/// waiting in its send buffer. keeping the buffer short is what allows an interactive
+	/// request to overtake bulk traffic that was queued before it.
+	const size_t SendLaneMaxBufferedBytes = 16 * 1024;
+
+	/// after a waiting lane was passed over this many times, it gets the next frame
+	/// regardless of priority, so that background traffic keeps making progress.
+	const int SendLaneStarvationLimit = 8;
+
+	/// raw frame (or error) collected by the network thread while it holds the websocket lock
+	struct NetworkThreadFrame
+	{
+		gsstl::string message;
+		WSError error;
+	};
+
+	typedef gsstl::list<NetworkThreadFrame> t_NetworkThreadFrames;
+
+	void OnNetworkThreadMessage(const gsstl::string& message, void* userData)
+	{
+		t_NetworkThreadFrames* frames = static_cast<t_NetworkThreadFrames*>(userData);
+		frames->push_back(NetworkThreadFrame());
+		frames->back().message = message;
+	}
+
+	void OnNetworkThreadError(const WSError& error, void* userData)
+	{
+		t_NetworkThreadFrames* frames = static_cast<t_NetworkThreadFrames*>(userData);
+		frames->push_back(NetworkThreadFrame());
+		frames->back().error = error;
+	}
+}
+
 
 GameSparks::Core::GSConnection::GSConnection(GS* gs, IGSPlatform* gsPlatform)
 	: m_GS(gs)
@@ -17,7 +59,14 @@ GameSparks::Core::GSConnection::GSConnection(GS* gs, IGSPlatform* gsPlatform)
 	, m_Initialized(false)
 	, m_Stopped(false)
     , m_lastActivity(0)
+	, m_UseNetworkThread(gs->GetNetworkThreadEnabled())
+	, m_NetworkThreadRunning(false)
 {
+	for (int i = 0; i != GSRequest::PRIORITY_COUNT; ++i)
+	{
+		m_SendLaneSkips[i] = 0;
+	}
+
 	m_URL = gs->GetServiceUrl();
 	/*m_URL += "?deviceOS=" + m_GSPlatform->GetDeviceOS();
 	m_URL += "&deviceID=" + m_GSPlatform->GetDeviceId();
@@ -36,7 +85,15 @@ void GameSparks::Core::GSConnection::EnsureConnected()
 	// connect
 	if (m_WebSocket == NULL)
 	{
-		m_WebSocket = WebSocket::from_url(m_URL.c_str());
+		{
+			gsstl::lock_guard<gsstl::mutex> lock(m_WebSocketMutex);
+			m_WebSocket = WebSocket::from_url(m_URL.c_str());
+		}
+
+		if (m_UseNetworkThread && m_WebSocket != NULL)
+		{
+			StartNetworkThread();
+		}
 	}
 }
 
@@ -55,6 +112,15 @@ void GameSparks::Core::GSConnection::Stop()
 
 void GameSparks::Core::GSConnection::Close()
 {
+	// the network thread must not touch the socket while it's closed and deleted
+	StopNetworkThread();
+
+	for (int i = 0; i != GSRequest::PRIORITY_COUNT; ++i)
+	{
+		m_SendLanes[i].clear();
+		m_SendLaneSkips[i] = 0;
+	}
+
 	if (m_WebSocket != NULL &&
 		(m_WebSocket->getReadyState() == WebSocket::OPEN || m_WebSocket->getReadyState() == WebSocket::CONNECTING))
 	{
@@ -83,12 +149,77 @@ void GameSparks::Core::GSConnection::SendImmediate(GSRequest& request)
 			request.AddString("requestId", m_GS->GetUniqueRequestId());
 		}
 
+		m_GS->OnRequestSent(request);
 		m_PendingRequests.insert(t_RequestMapPair(request.GetString("requestId").GetValue(), request));
 	}
 
 	m_GS->DebugLog("Send immediate request: " + request.GetJSON());
     m_lastActivity = 0;
-	m_WebSocket->send(request.GetJSON().c_str());
+
+	if (m_UseNetworkThread)
+	{
+		gsstl::lock_guard<gsstl::mutex> lock(m_WebSocketMutex);
+		QueueFrame(request);
+	}
+	else
+	{
+		QueueFrame(request);
+	}
+}
+
+void GSConnection::QueueFrame(const GSRequest& request)
+{
+	if (request.GetType().GetValue() == ".AuthenticatedConnectRequest")
+	{
+		// the handshake has to be the first frame on the connection
+		m_WebSocket->send(request.GetJSON().c_str());
+		return;
+	}
+
+	m_SendLanes[request.GetPriority()].push_back(request.GetJSON());
+	FlushSendLanes();
+}
+
+void GSConnection::FlushSendLanes()
+{
+	if (m_WebSocket == NULL || m_WebSocket->getReadyState() != WebSocket::OPEN)
+	{
+		return;
+	}
+
+	while (m_WebSocket->getBufferedAmount() < SendLaneMaxBufferedBytes)
+	{
+		// strict priority, unless a lower priority lane has been waiting for too long
+		int lane = -1;
+		for (int i = 0; i != GSRequest::PRIORITY_COUNT; ++i)
+		{
+			if (m_SendLanes[i].empty()) continue;
+
+			if (lane == -1)
+			{
+				lane = i;
+			}
+			else if (m_SendLaneSkips[i] >= SendLaneStarvationLimit)
+			{
+				lane = i;
+				break;
+			}
+		}
+
+		if (lane == -1)
+		{
+			break;
+		}
+
+		for (int i = lane + 1; i != GSRequest::PRIORITY_COUNT; ++i)
+		{
+			if (!m_SendLanes[i].empty()) ++m_SendLaneSkips[i];
+		}
+		m_SendLaneSkips[lane] = 0;
+
+		m_WebSocket->send(m_SendLanes[lane].front());
+		m_SendLanes[lane].pop_front();
+	}
 }
 
 bool GameSparks::Core::GSConnection::GetReady() const
@@ -111,20 +242,78 @@ void GameSparks::Core::GSConnection::OnError(const gsstl::string& errorMessage)
 
 GameSparks::Core::GSConnection::~GSConnection()
 {
+	StopNetworkThread();
 	delete m_WebSocket;
 	m_WebSocket = nullptr;
 }
 
 bool GameSparks::Core::GSConnection::IsWebSocketConnectionAlive() const
 {
+	if (m_UseNetworkThread)
+	{
+		// frames received before the socket closed still have to be delivered
+		gsstl::lock_guard<gsstl::mutex> lock(m_ReceivedMutex);
+		if (!m_Received.empty())
+		{
+			return true;
+		}
+	}
+
 	return m_WebSocket != NULL && m_WebSocket->getReadyState() != WebSocket::CLOSED;
 }
 
+void GameSparks::Core::GSConnection::AddProfilerCounters(long long* counters)
+{
+	counters[IGSProfiler::COUNTER_PENDING_REQUESTS] += m_PendingRequests.size();
+
+	if (m_UseNetworkThread)
+	{
+		gsstl::lock_guard<gsstl::mutex> lock(m_ReceivedMutex);
+		counters[IGSProfiler::COUNTER_RECEIVED_QUEUE] += m_Received.size();
+	}
+
+	if (m_UseNetworkThread)
+	{
+		gsstl::lock_guard<gsstl::mutex> lock(m_WebSocketMutex);
+		AddWebSocketProfilerCounters(counters);
+	}
+	else
+	{
+		AddWebSocketProfilerCounters(counters);
+	}
+}
+
+void GameSparks::Core::GSConnection::AddWebSocketProfilerCounters(long long* counters) const
+{
+	for (int i = 0; i != GSRequest::PRIORITY_COUNT; ++i)
+	{
+		counters[IGSProfiler::COUNTER_SEND_LANES] += m_SendLanes[i].size();
+	}
+
+	if (m_WebSocket != NULL)
+	{
+		counters[IGSProfiler::COUNTER_WEBSOCKET_TX_BYTES] += m_WebSocket->getBufferedAmount();
+		counters[IGSProfiler::COUNTER_WEBSOCKET_RX_BYTES] += m_WebSocket->getReceivedAmount();
+	}
+}
+
+bool GameSparks::Core::GSConnection::HasWork() const
+{
+	if (m_UseNetworkThread)
+	{
+		gsstl::lock_guard<gsstl::mutex> lock(m_ReceivedMutex);
+		return !m_Received.empty();
+	}
+
+	return m_WebSocket != NULL && m_WebSocket->needsPoll();
+}
+
 void GSConnection::OnWebSocketCallback(const gsstl::string& message, void* userData)
 {
 	GS_CODE_TIMING_ASSERT();
 	GSConnection *connectionObj = static_cast<GSConnection *>(userData);
 	connectionObj->m_GS->DebugLog("WebSocket callback: " + message);
+	connectionObj->m_GS->m_DispatchedMessages++;
 	connectionObj->GetGSInstance()->OnMessageReceived(message, *connectionObj);
 }
 
@@ -144,20 +333,38 @@ bool GSConnection::Update(float deltaTime)
 {
     m_lastActivity += deltaTime;
 
+	if (m_UseNetworkThread)
+	{
+		return UpdateFromNetworkThread();
+	}
+
 	if (m_WebSocket != NULL)
 	{
 		if (m_WebSocket->getReadyState() != WebSocket::CLOSED)
 		{
 			{
+				GSProfilerScope profilerScope(m_GS->GetProfiler(), IGSProfiler::SCOPE_WEBSOCKET_POLL);
 				m_WebSocket->poll(0, OnWebSocketError, this);
 			}
 			if (m_Stopped) return false;
 
+			// poll() wrote (part of) the send buffer to the socket, refill it from the lanes
+			FlushSendLanes();
+
+			// easywsclient dispatches a single frame per call, so keep going until
+			// the receive buffer is drained or the dispatch budget of this update is used up
 			{
-				m_WebSocket->dispatch(OnWebSocketCallback, OnWebSocketError, this);
-			}
+				GSProfilerScope profilerScope(m_GS->GetProfiler(), IGSProfiler::SCOPE_WEBSOCKET_DISPATCH);
+				while (m_GS->HasDispatchBudget())
+				{
+					int dispatched = m_GS->m_DispatchedMessages;
+					m_WebSocket->dispatch(OnWebSocketCallback, OnWebSocketError, this);
 
-			if (m_Stopped) return false;
+					if (m_Stopped) return false;
+
+					if (m_GS->m_DispatchedMessages == dispatched) break;
+				}
+			}
             
             if(m_lastActivity > 60)
 			{
@@ -176,3 +383,145 @@ bool GSConnection::Update(float deltaTime)
 
 	return true;
 }
+
+
+void GSConnection::StartNetworkThread()
+{
+	{
+		gsstl::lock_guard<gsstl::mutex> lock(m_WebSocketMutex);
+		if (m_NetworkThreadRunning) return;
+		m_NetworkThreadRunning = true;
+	}
+
+	m_NetworkThread = gsstl::thread(NetworkThreadMain, this);
+}
+
+void GSConnection::StopNetworkThread()
+{
+	{
+		gsstl::lock_guard<gsstl::mutex> lock(m_WebSocketMutex);
+		m_NetworkThreadRunning = false;
+	}
+
+	if (m_NetworkThread.joinable())
+	{
+		m_NetworkThread.join();
+	}
+}
+
+void GSConnection::NetworkThreadMain(GSConnection* self)
+{
+	for (;;)
+	{
+		t_NetworkThreadFrames frames;
+
+		{
+			gsstl::lock_guard<gsstl::mutex> lock(self->m_WebSocketMutex);
+
+			if (!self->m_NetworkThreadRunning)
+			{
+				break;
+			}
+
+			if (self->m_WebSocket != NULL && self->m_WebSocket->getReadyState() != WebSocket::CLOSED)
+			{
+				IGSProfiler* profiler = self->m_GS->GetProfiler();
+				{
+					GSProfilerScope profilerScope(profiler, IGSProfiler::SCOPE_WEBSOCKET_POLL);
+					self->m_WebSocket->poll(0, OnNetworkThreadError, &frames);
+					self->FlushSendLanes();
+				}
+
+				GSProfilerScope profilerScope(profiler, IGSProfiler::SCOPE_WEBSOCKET_DISPATCH);
+				for (int i = 0; i != NetworkThreadMaxFramesPerPoll; ++i)
+				{
+					t_NetworkThreadFrames::size_type before = frames.size();
+					self->m_WebSocket->dispatch(OnNetworkThreadMessage, OnNetworkThreadError, &frames);
+					if (frames.size() == before) break;
+				}
+			}
+		}
+
+		if (frames.empty())
+		{
+			gsstl::this_thread::sleep_for(gsstl::chrono::milliseconds(NetworkThreadIdleMilliseconds));
+			continue;
+		}
+
+		// the json is parsed outside of the websocket lock, so that the game thread can keep sending
+		GSProfilerScope profilerScope(self->m_GS->GetProfiler(), IGSProfiler::SCOPE_JSON_PARSE);
+		t_ReceivedItems items;
+		for (t_NetworkThreadFrames::iterator frame = frames.begin(); frame != frames.end(); ++frame)
+		{
+			if (frame->error.code == WSError::ALL_OK)
+			{
+				items.push_back(ReceivedItem(frame->message, GSObject::FromJSON(frame->message), WSError::ALL_OK, ""));
+			}
+			else
+			{
+				items.push_back(ReceivedItem("", GSObject(gsstl::string()), frame->error.code, frame->error.message));
+			}
+		}
+
+		gsstl::lock_guard<gsstl::mutex> lock(self->m_ReceivedMutex);
+		self->m_Received.splice(self->m_Received.end(), items);
+	}
+}
+
+bool GSConnection::UpdateFromNetworkThread()
+{
+	t_ReceivedItems items;
+	{
+		gsstl::lock_guard<gsstl::mutex> lock(m_ReceivedMutex);
+		items.swap(m_Received);
+	}
+
+	GSProfilerScope profilerScope(items.empty() ? 0 : m_GS->GetProfiler(), IGSProfiler::SCOPE_WEBSOCKET_DISPATCH);
+	while (!items.empty() && m_GS->HasDispatchBudget())
+	{
+		ReceivedItem& item = items.front();
+
+		if (item.errorCode != WSError::ALL_OK)
+		{
+			OnWebSocketError(WSError(static_cast<WSError::Code>(item.errorCode), item.errorMessage), this);
+		}
+		else
+		{
+			m_GS->DebugLog("WebSocket callback: " + item.message);
+			m_GS->m_DispatchedMessages++;
+			m_GS->OnMessageReceived(item.response, *this);
+		}
+
+		items.pop_front();
+
+		if (m_Stopped)
+		{
+			break;
+		}
+	}
+
+	if (!items.empty())
+	{
+		// keep what's left for the next update, just like the frames left in the websockets receive buffer
+		gsstl::lock_guard<gsstl::mutex> lock(m_ReceivedMutex);
+		m_Received.splice(m_Received.begin(), items);
+	}
+
+	if (m_Stopped)
+	{
+		return false;
+	}
+
+	if (m_lastActivity > 60)
+	{
+		m_lastActivity = 0;
+
+		gsstl::lock_guard<gsstl::mutex> lock(m_WebSocketMutex);
+		if (m_WebSocket != NULL && m_WebSocket->getReadyState() == WebSocket::OPEN)
+		{
+			m_WebSocket->send(" ");
+		}
+	}
+
+	return true;
+}
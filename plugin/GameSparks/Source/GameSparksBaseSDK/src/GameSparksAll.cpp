@@ -217,11 +217,14 @@ extern "C"
 #	endif
 #	include "GameSparksRT/Connection/WebSocketConnection.cpp"
 #	include "GameSparksRT/GameSparksRT.cpp"
+#	include "GameSparksRT/Proto/Fragmentation.cpp"
+#	include "GameSparksRT/Proto/LZCodec.cpp"
 #	include "GameSparksRT/Proto/LimitedPositionStream.cpp"
 #	include "GameSparksRT/Proto/Packet.cpp"
 #	include "GameSparksRT/Proto/PositionStream.cpp"
 #	include "GameSparksRT/Proto/ReusableBinaryWriter.cpp"
 #	include "GameSparksRT/Proto/RTData.Serializer.cpp"
+#	include "GameSparksRT/Proto/RTDataDelta.cpp"
 #	include "GameSparksRT/Proto/RTVal.cpp"
 #	include "GameSparksRT/RTData.cpp"
 #	include "GameSparksRT/RTSessionImpl.cpp"
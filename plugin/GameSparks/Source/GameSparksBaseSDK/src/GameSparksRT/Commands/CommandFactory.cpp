@@ -37,6 +37,21 @@ System::Failable<IRTCommand*> CommandFactory::GetCommand(int opCode, int sender,
                 GS_RETURN_OR_CATCH(PlayerDisconnectMessage::Deserialize(lps));
             default:
             {
+                if(opCode != 0 && opCode == session.FragmentOpCode()){
+                    GS_RETURN_OR_CATCH(session.OnFragmentReceived(sender, lps, (int)limit));
+                }
+                if(opCode != 0 && opCode == session.DeltaOpCode()){
+                    if(session.ShouldExecute(sender, sequence)){
+                        GS_RETURN_OR_CATCH(session.OnDeltaReceived(sender, lps, (int)limit, data));
+                    }
+                    return nullptr;
+                }
+                if(opCode != 0 && opCode == session.CompressionOpCode()){
+                    if(session.ShouldExecute(sender, sequence)){
+                        GS_RETURN_OR_CATCH(session.OnCompressedReceived(sender, lps, (int)limit));
+                    }
+                    return nullptr;
+                }
                 if(session.ShouldExecute(sender, sequence)){
                     GS_RETURN_OR_CATCH(CustomCommand::Deserialize(opCode, sender, lps, data, (int)limit, session));
                 }
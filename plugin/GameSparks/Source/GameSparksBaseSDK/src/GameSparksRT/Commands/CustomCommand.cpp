@@ -6,20 +6,26 @@
 namespace GameSparks { namespace RT {
 
 
-System::Failable<CustomCommand*> CustomCommand::Deserialize(int opCode, int sender, System::IO::Stream& lps, const RTData& data, int limit, const IRTSessionInternal& session)
+System::Failable<CustomCommand*> CustomCommand::Deserialize(int opCode, int sender, System::IO::Stream& lps, const RTData& data, int limit, IRTSessionInternal& session)
 {
-    gsstl::unique_ptr<CustomCommand> instance(new CustomCommand(opCode, sender, data, limit, session));
+    gsstl::unique_ptr<CustomCommand> instance(session.PopCustomCommand());
+    instance->opCode = opCode;
+    instance->sender = sender;
+    instance->data = data;
+    if (instance->payload.capacity() < static_cast<size_t>(limit))
+    {
+        session.OnPayloadAllocated();
+    }
+    instance->payload.resize(limit); // keeps the capacity of a pooled instance
     GS_CALL_OR_THROW(lps.Read(instance->payload, 0, limit));
     return instance.release();
 }
 
 
-CustomCommand::CustomCommand(int opCode_, int sender_, const RTData& data_, int limit_, const IRTSessionInternal& session_)
+CustomCommand::CustomCommand(const IRTSessionInternal& session_)
 :session(session_)
-,opCode(opCode_)
-,sender(sender_)
-,data(data_)
-,payload(limit_)
+,opCode(0)
+,sender(0)
 {
 }
 
@@ -36,4 +42,9 @@ void CustomCommand::Execute()
     }
 }
 
+gsstl::unique_ptr<CustomCommand> IRTSessionInternal::PopCustomCommand()
+{
+    return gsstl::unique_ptr<CustomCommand>(new CustomCommand(*this));
+}
+
 }} /* namespace GameSparks.RT */
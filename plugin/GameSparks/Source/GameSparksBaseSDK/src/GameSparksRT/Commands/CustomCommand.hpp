@@ -12,10 +12,17 @@ namespace GameSparks { namespace RT {
 	class CustomCommand : public IRTCommand
 	{
 		public:
-			static System::Failable<CustomCommand*> Deserialize(int opCode, int sender, System::IO::Stream& lps, const RTData& data, int limit, const IRTSessionInternal& session);
+			/// the instance is taken from the pool of session, see IRTSessionInternal::PopCustomCommand()
+			static System::Failable<CustomCommand*> Deserialize(int opCode, int sender, System::IO::Stream& lps, const RTData& data, int limit, IRTSessionInternal& session);
+
+			/// an empty command, to be filled by Deserialize()
+			explicit CustomCommand(const IRTSessionInternal& session);
 			virtual void Execute() override;
+			virtual CustomCommand* asCustomCommand() override { return this; }
+
+			int OpCode() const { return opCode; }
+			int Sender() const { return sender; }
 		private:
-			CustomCommand(int opCode, int sender, const RTData& data, int limit, const IRTSessionInternal& session);
 			const IRTSessionInternal& session;
 			int opCode, sender;
 			RTData data;
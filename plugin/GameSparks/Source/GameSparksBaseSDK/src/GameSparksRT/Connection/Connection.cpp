@@ -41,7 +41,7 @@ System::Failable<void> Connection::OnPacketReceived(Proto::Packet& p)
                 p.Command->Execute ();
             }
         } else {
-            session->SubmitAction (p.Command);
+            session->SubmitAction (p.Command, p.SequenceNumber.HasValue());
         }
 
     } else {
@@ -50,7 +50,7 @@ System::Failable<void> Connection::OnPacketReceived(Proto::Packet& p)
             System::IO::MemoryStream emptyStream;
             GS_ASSIGN_OR_THROW(tmp, CustomCommand::Deserialize(p.OpCode, p.Sender.GetValueOrDefault(0), emptyStream, p.Data, 0, *session));
             gsstl::unique_ptr<IRTCommand> cmd(tmp);
-            session->SubmitAction ( cmd );
+            session->SubmitAction ( cmd, p.SequenceNumber.HasValue() );
         }
     }
     return {};
@@ -5,6 +5,7 @@
 #include "../../System/IAsyncResult.hpp"
 #include "../../System/Net/Sockets/TcpClient.hpp"
 #include "../Proto/Packet.hpp"
+#include "../../System/IO/MemoryStream.hpp"
 
 namespace GameSparks { namespace RT { namespace Connection {
 
@@ -12,15 +13,26 @@ namespace GameSparks { namespace RT { namespace Connection {
 	{
 		public:
 			ReliableConnection  (const gsstl::string& remotehost, const gsstl::string& remoteport, IRTSessionInternal* session);
+			/// encodes request into the output buffer. It is sent by the next call to Flush().
 			virtual System::Failable<int> Send(const Commands::RTRequest& request) override;
 			virtual void StopInternal() override;
 
+			/// sends everything in the output buffer with a single write
+			void Flush();
+
+			/// number of bytes waiting in the output buffer
+			int GetBufferedBytes();
+
 			void Poll();
 		private:
 			void ConnectCallback(System::IAsyncResult result);
 			System::Failable<bool> read(PositionStream& stream, Proto::Packet& p);
 
 			System::Net::Sockets::TcpClient client;
+
+			// Send() is called by the game thread and by the connect thread (login)
+			gsstl::recursive_mutex outputMutex;
+			System::IO::MemoryStream output;
 	};
 
 }}} /* namespace GameSparks.RT.Connection */
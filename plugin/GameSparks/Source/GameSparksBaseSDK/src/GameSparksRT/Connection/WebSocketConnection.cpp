@@ -166,6 +166,7 @@ System::Failable<bool> WebSocketConnection::read(PositionStream& stream, Packet&
 		return false;
 	}
 
+	Core::GSProfilerScope profilerScope(session ? session->GetProfiler() : nullptr, Core::IGSProfiler::SCOPE_RT_PACKET_DECODE);
 	GS_CALL_OR_THROW(Packet::DeserializeLengthDelimited(stream, stream.BinaryReader, p));
 	//p.Session = session;
 	p.Reliable = p.Reliable.GetValueOrDefault(true);
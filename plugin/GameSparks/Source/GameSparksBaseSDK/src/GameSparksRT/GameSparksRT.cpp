@@ -3,6 +3,7 @@
 //#include <ostream>
 //#include <iostream>
 #include "./RTSessionImpl.hpp"
+#include "./Proto/Packet.hpp"
 
 namespace GameSparks { namespace RT {
 
@@ -52,10 +53,77 @@ GameSparksRTSessionBuilder& GameSparksRTSessionBuilder::SetListener(IRTSessionLi
     return *this;
 }
 
+GameSparksRTSessionBuilder& GameSparksRTSessionBuilder::SetProfiler(GameSparks::Core::IGSProfiler* profiler_){
+    this->pimpl->profiler = profiler_;
+    return *this;
+}
+
+GameSparksRTSessionBuilder& GameSparksRTSessionBuilder::SetReliableFlushThreshold(int bytes){
+    assert(bytes >= 0);
+    this->pimpl->reliableFlushThreshold = bytes;
+    return *this;
+}
+
+GameSparksRTSessionBuilder& GameSparksRTSessionBuilder::AddImmediateFlushOpCode(int opCode){
+    this->pimpl->immediateFlushOpCodes.push_back(opCode);
+    return *this;
+}
+
+GameSparksRTSessionBuilder& GameSparksRTSessionBuilder::SetMaxDatagramSize(int bytes){
+    assert(bytes >= 0);
+    this->pimpl->maxDatagramSize = bytes;
+    return *this;
+}
+
+GameSparksRTSessionBuilder& GameSparksRTSessionBuilder::SetUpdateBudget(int maxMessages, int maxMilliseconds){
+    assert(maxMessages >= 0);
+    assert(maxMilliseconds >= 0);
+    this->pimpl->maxMessagesPerUpdate = maxMessages;
+    this->pimpl->maxMillisecondsPerUpdate = maxMilliseconds;
+    return *this;
+}
+
+GameSparksRTSessionBuilder& GameSparksRTSessionBuilder::EnableSequencedCollapse(){
+    this->pimpl->collapseSequencedMessages = true;
+    return *this;
+}
+
+GameSparksRTSessionBuilder& GameSparksRTSessionBuilder::EnableFragmentation(int opCode, int maxMessageSize){
+    assert(opCode > 0);
+    assert(maxMessageSize > 0);
+    this->pimpl->fragmentOpCode = opCode;
+    this->pimpl->maxFragmentedMessageSize = maxMessageSize;
+    return *this;
+}
+
+GameSparksRTSessionBuilder& GameSparksRTSessionBuilder::EnableCompression(int opCode, const System::Bytes& dictionary, int maxMessageSize){
+    assert(opCode > 0);
+    assert(maxMessageSize > 0);
+    this->pimpl->compressionOpCode = opCode;
+    this->pimpl->compressionDictionary = dictionary;
+    this->pimpl->maxCompressedMessageSize = maxMessageSize;
+    return *this;
+}
+
+GameSparksRTSessionBuilder& GameSparksRTSessionBuilder::EnableDeltaEncoding(int opCode, int keyframeInterval){
+    assert(opCode > 0);
+    assert(keyframeInterval > 0);
+    this->pimpl->deltaOpCode = opCode;
+    this->pimpl->deltaKeyframeInterval = keyframeInterval;
+    return *this;
+}
+
 /// you own the return value. make sure to put it into a std::unique_ptr or std::shared_ptr (or delete it manually).
 IRTSession* GameSparksRTSessionBuilder::Build() const{
-    IRTSession* session = new RTSessionImpl (pimpl->connectToken, pimpl->host, pimpl->port, pimpl->port);
+    RTSessionImpl* session = new RTSessionImpl (pimpl->connectToken, pimpl->host, pimpl->port, pimpl->port);
     session->SessionListener = pimpl->listener;
+    session->SetProfiler(pimpl->profiler);
+    session->SetReliableFlushPolicy(pimpl->reliableFlushThreshold, pimpl->immediateFlushOpCodes);
+    session->SetFragmentation(pimpl->fragmentOpCode, pimpl->maxFragmentedMessageSize);
+    session->SetCompression(pimpl->compressionOpCode, pimpl->compressionDictionary, pimpl->maxCompressedMessageSize);
+    session->SetDeltaEncoding(pimpl->deltaOpCode, pimpl->deltaKeyframeInterval);
+    session->SetMaxDatagramSize(pimpl->maxDatagramSize < 0 ? int(GameSparksRT::MAX_MESSAGE_SIZE_BYTES) : pimpl->maxDatagramSize);
+    session->SetUpdateBudget(pimpl->maxMessagesPerUpdate, pimpl->maxMillisecondsPerUpdate, pimpl->collapseSequencedMessages);
     if(pimpl->listener)
 		pimpl->listener->session = session;
     return session;
@@ -91,4 +159,12 @@ GameSparksRTSessionBuilder GameSparksRT::SessionBuilder() {
     return RT::GameSparksRTSessionBuilder();
 }
 
+System::Bytes GameSparksRT::TrainCompressionDictionary(const gsstl::vector<System::Bytes>& samples, int maxSize) {
+    return Proto::LZCodec::TrainDictionary(samples, maxSize);
+}
+
+int GameSparksRT::MaxDatagramPayloadSize(int targetPlayers) {
+    return int(MAX_MESSAGE_SIZE_BYTES) - Proto::Packet::MaxOverhead(targetPlayers);
+}
+
 }} /* namespace GameSparks.RT */
@@ -0,0 +1,56 @@
+#ifndef _GAMESPARKSRT_LZCODEC_HPP_
+#define _GAMESPARKSRT_LZCODEC_HPP_
+
+#include "../../../include/GameSparks/gsstl.h"
+#include "../../../include/System/Bytes.hpp"
+#include "../../System/Failable.hpp"
+
+namespace GameSparks { namespace RT { namespace Proto {
+
+	/*!
+		A small LZ77 codec for realtime payloads, see GameSparksRTSessionBuilder::EnableCompression().
+
+		The compressed block is a sequence of
+
+			token (uint8: literal count << 4 | match length - 4) | [literal count - 15 as 255 runs] | literals |
+			offset (uint16 little endian) | [match length - 19 as 255 runs]
+
+		where the last sequence consists of the literals only. Matches may reach back into the dictionary, which acts as
+		if it preceded the data. Both sides have to use the same dictionary.
+
+		Compress() reuses internal buffers and is not thread safe, Decompress() is.
+	*/
+	class LZCodec
+	{
+		public:
+			enum
+			{
+				MIN_MATCH = 4,
+				MAX_OFFSET = 65535,
+				HASH_BITS = 12
+			};
+
+			explicit LZCodec(const System::Bytes& dictionary = System::Bytes());
+
+			const System::Bytes& GetDictionary() const { return dictionary; }
+
+			/// appends the compressed form of size bytes at input to output
+			void Compress(const System::Byte* input, int size, System::Bytes& output);
+
+			/// decompresses size bytes at input into output, which is cleared first. fails, if the input is malformed
+			/// or does not decompress to exactly decompressedSize bytes.
+			System::Failable<void> Decompress(const System::Byte* input, int size, int decompressedSize, System::Bytes& output) const;
+
+			/// builds a dictionary of at most maxSize bytes from the byte sequences that occur most often in samples
+			static System::Bytes TrainDictionary(const gsstl::vector<System::Bytes>& samples, int maxSize);
+
+		private:
+			System::Bytes dictionary;
+			gsstl::vector<int> dictionaryTable; // hash table of the dictionary positions, the start of each Compress()
+			gsstl::vector<int> table;
+			System::Bytes window; // dictionary followed by the input
+	};
+
+}}} /* namespace GameSparks.RT.Proto */
+
+#endif /* _GAMESPARKSRT_LZCODEC_HPP_ */
@@ -25,6 +25,16 @@ namespace GameSparks { namespace RT { namespace Proto {
 				return (BytesRead >= limit) ? -1 : PositionStream::ReadByte ();
 			}
 
+			const unsigned char* ReadSpan(int& available) override
+			{
+				const unsigned char* span = PositionStream::ReadSpan(available);
+				if (available > limit - BytesRead)
+				{
+					available = limit > BytesRead ? limit - BytesRead : 0;
+				}
+				return span;
+			}
+
 			void SkipToEnd()
 			{
 				if (BytesRead < limit) {
@@ -4,52 +4,52 @@
 #include "../Commands/Requests/RTRequest.hpp"
 #include "ProtocolBufferException.hpp"
 #include "../../System/IO/EndOfStreamException.hpp"
+#include "../IRTSessionInternal.hpp"
+#include "../Pools/ObjectPool.hpp"
 
 namespace GameSparks { namespace RT { namespace Proto {
 
 System::Failable<void> Packet::Serialize(System::IO::Stream& stream, const Packet& instance)
 {
-    // Key for field: 1, Varint
-    GS_CALL_OR_THROW(stream.WriteByte(8));
-    GS_CALL_OR_THROW(::GameSparks::RT::Proto::ProtocolParser::WriteZInt32(stream, instance.OpCode));
-    if (instance.SequenceNumber.HasValue())
-    {
-        // Key for field: 2, Varint
-        GS_CALL_OR_THROW(stream.WriteByte(16));
-        GS_CALL_OR_THROW(::GameSparks::RT::Proto::ProtocolParser::WriteUInt64(stream,(uint64_t) instance.SequenceNumber.Value()));
-    }
-    if (instance.RequestId.HasValue())
-    {
-        // Key for field: 3, Varint
-        GS_CALL_OR_THROW(stream.WriteByte(24));
-        GS_CALL_OR_THROW(::GameSparks::RT::Proto::ProtocolParser::WriteUInt64(stream,(uint64_t) instance.RequestId.Value()));
-    }
-    if (!instance.TargetPlayers.empty())
-    {
+    // the fields up to the key of Data are encoded in one go, instead of byte by byte through the stream
+    const int headerSize = 1 + Varint::MAX_VARINT32_SIZE
+        + (3 + int(instance.TargetPlayers.size())) * (1 + Varint::MAX_VARINT64_SIZE)
+        + 2
+        + 1;
+
+    GS_CALL_OR_THROW(ProtocolParser::WriteEncoded(stream, headerSize, [&instance](Varint::byte*& pos, Varint::byte* end) -> bool {
+        // Key for field: 1, Varint
+        bool ok = Varint::WriteKey(pos, end, 1, int(Wire::Varint)) && Varint::WriteZInt32(pos, end, instance.OpCode);
+        if (instance.SequenceNumber.HasValue())
+        {
+            // Key for field: 2, Varint
+            ok = ok && Varint::WriteKey(pos, end, 2, int(Wire::Varint)) && Varint::WriteUInt64(pos, end, (uint64_t)instance.SequenceNumber.Value());
+        }
+        if (instance.RequestId.HasValue())
+        {
+            // Key for field: 3, Varint
+            ok = ok && Varint::WriteKey(pos, end, 3, int(Wire::Varint)) && Varint::WriteUInt64(pos, end, (uint64_t)instance.RequestId.Value());
+        }
         for (const auto& i4 : instance.TargetPlayers)
         {
             // Key for field: 4, Varint
-            GS_CALL_OR_THROW(stream.WriteByte(32));
-            GS_CALL_OR_THROW(::GameSparks::RT::Proto::ProtocolParser::WriteUInt64(stream,(uint64_t)i4));
+            ok = ok && Varint::WriteKey(pos, end, 4, int(Wire::Varint)) && Varint::WriteUInt64(pos, end, (uint64_t)i4);
         }
-    }
-    if (instance.Sender.HasValue())
-    {
-        // Key for field: 5, Varint
-        GS_CALL_OR_THROW(stream.WriteByte(40));
-        GS_CALL_OR_THROW(::GameSparks::RT::Proto::ProtocolParser::WriteUInt64(stream,(uint64_t) instance.Sender.Value()));
-    }
-    if (instance.Reliable.HasValue())
-    {
-        // Key for field: 6, Varint
-        GS_CALL_OR_THROW(stream.WriteByte(48));
-        GS_CALL_OR_THROW(::GameSparks::RT::Proto::ProtocolParser::WriteBool(stream, instance.Reliable.Value()));
-    }
-    //if(true/*instance.Data*/)
-	{
-        GS_CALL_OR_THROW(stream.WriteByte(114));
-        GS_CALL_OR_THROW(RTData::WriteRTData(stream, instance.Data));
-    }
+        if (instance.Sender.HasValue())
+        {
+            // Key for field: 5, Varint
+            ok = ok && Varint::WriteKey(pos, end, 5, int(Wire::Varint)) && Varint::WriteUInt64(pos, end, (uint64_t)instance.Sender.Value());
+        }
+        if (instance.Reliable.HasValue())
+        {
+            // Key for field: 6, Varint
+            ok = ok && Varint::WriteKey(pos, end, 6, int(Wire::Varint)) && Varint::WriteUInt32(pos, end, instance.Reliable.Value() ? 1 : 0);
+        }
+        // Key for field: 14, LengthDelimited
+        return ok && Varint::WriteKey(pos, end, 14, int(Wire::LengthDelimited));
+    }));
+
+    GS_CALL_OR_THROW(RTData::WriteRTData(stream, instance.Data));
     GS_CALL_OR_THROW(instance.WritePayload(stream));
     return {};
 }
@@ -57,27 +57,29 @@ System::Failable<void> Packet::Serialize(System::IO::Stream& stream, const Packe
 
 System::Failable<int> Packet::SerializeLengthDelimited(System::IO::Stream &stream, const Packet &instance)
 {
-    System::IO::MemoryStream ms;// = PooledObjects.MemoryStreamPool.Pop ();
-
-    GS_CALL_OR_THROW(Serialize(ms, instance));
-    const auto& data = ms.GetBuffer();
-    //int64_t pos = ms.Position();
-    GS_CALL_OR_THROW(GameSparks::RT::Proto::ProtocolParser::WriteUInt32(stream, (unsigned int)ms.Position()));
-    GS_CALL_OR_THROW(stream.Write(data, 0, (int)ms.Position()));
-    return ms.Position();
+    Pools::Pooled<System::IO::MemoryStream> ms(instance.Session ? instance.Session->ScratchStreams() : nullptr);
+    GS_CALL_OR_THROW(ms->SetLength(0));
+
+    GS_CALL_OR_THROW(Serialize(*ms, instance));
+    const auto& data = ms->GetBuffer();
+    //int64_t pos = ms->Position();
+    GS_CALL_OR_THROW(GameSparks::RT::Proto::ProtocolParser::WriteUInt32(stream, (unsigned int)ms->Position()));
+    GS_CALL_OR_THROW(stream.Write(data, 0, (int)ms->Position()));
+    return ms->Position();
 }
 
 System::Failable<void> Packet::WritePayload(System::IO::Stream &stream) const
 {
     if (Request != nullptr) {
         // Key for field: 15, LengthDelimited
-        System::IO::MemoryStream ms;// = PooledObjects.MemoryStreamPool.Pop();
+        Pools::Pooled<System::IO::MemoryStream> ms(Session ? Session->ScratchStreams() : nullptr);
+        GS_CALL_OR_THROW(ms->SetLength(0));
 
-            GS_CALL_OR_THROW(Request->Serialize (ms));
-            auto written = ms.GetBuffer();
-            if (ms.Position() > 0) {
+            GS_CALL_OR_THROW(Request->Serialize (*ms));
+            const auto& written = ms->GetBuffer();
+            if (ms->Position() > 0) {
                 GS_CALL_OR_THROW(stream.WriteByte (122));
-                GS_CALL_OR_THROW(::GameSparks::RT::Proto::ProtocolParser::WriteBytes (stream, written, (int)ms.Position()));
+                GS_CALL_OR_THROW(::GameSparks::RT::Proto::ProtocolParser::WriteBytes (stream, written, (int)ms->Position()));
             }
     } else {
         if (!Payload.empty())
@@ -13,13 +13,23 @@ System::Failable<int> PositionStream::Read(System::Bytes& buffer, int offset, in
 
 System::Failable<int> PositionStream::ReadByte()
 {
-    System::Bytes readByte(1);
-    GS_ASSIGN_OR_THROW(read, Read (readByte, 0, 1));
+    GS_ASSIGN_OR_THROW(read, stream.ReadByte());
 
-    if (read == 1) {
-        return readByte [0];
+    if (read != -1) {
+        ++BytesRead;
     }
-    return -1;
+    return read;
+}
+
+const unsigned char* PositionStream::ReadSpan(int& available)
+{
+    return stream.ReadSpan(available);
+}
+
+void PositionStream::Advance(int count)
+{
+    stream.Advance(count);
+    BytesRead += count;
 }
 
 int PositionStream::Position() const {
@@ -27,6 +27,9 @@ namespace GameSparks { namespace RT {
 			virtual System::Failable<int> Read(System::Bytes& buffer, int offset, int count) override;
 			virtual System::Failable<int> ReadByte() override;
 
+			virtual const unsigned char* ReadSpan(int& available) override;
+			virtual void Advance(int count) override;
+
 			virtual int Position() const override;
 			virtual System::Failable<void> Position(
 				const int /*pos*/) override {
@@ -11,6 +11,7 @@
 #include "../../System/IO/IOException.hpp"
 #include "../../System/String.hpp"
 #include "./ProtocolBufferException.hpp"
+#include "./Varint.hpp"
 
 namespace GameSparks { namespace RT { namespace Proto {
 
@@ -112,30 +113,40 @@ namespace GameSparks { namespace RT { namespace Proto {
 			//VarInt length
             GS_ASSIGN_OR_THROW(length, ReadUInt32(stream));
 
-			System::IO::MemoryStream ms;// = PooledObjects.MemoryStreamPool.Pop ();
-
-			bytes buffer(length);// = PooledObjects.ByteBufferPool.Pop ();
-
-			uint read = 0;
-
-			while (read < length) {
-				GS_ASSIGN_OR_THROW(r, stream.Read(buffer, 0, gsstl::min<int>(length - read, int(buffer.size()))));
-                if (r == 0)
-					return ::GameSparks::RT::Proto::ProtocolBufferException("Expected " + System::String::ToString(length - read) + " got " + System::String::ToString(read));
-				GS_CALL_OR_THROW(ms.Write (buffer, 0, r));
-				read += r;
+			int available = 0;
+			if (const byte* begin = stream.ReadSpan(available))
+			{
+				if (uint(available) < length)
+					return ::GameSparks::RT::Proto::ProtocolBufferException("Expected " + System::String::ToString(length) + " got " + System::String::ToString(available));
+				gsstl::string ret(reinterpret_cast<const char*>(begin), length);
+				stream.Advance(int(length));
+				return ret;
 			}
 
-			gsstl::string ret = System::Text::Encoding::UTF8::GetString(ms.GetBuffer(), 0, (int)ms.Position());
+			// streams without a span, like the reliable connection, are read byte by byte into the string, so that
+			// short strings do not allocate
+			gsstl::string ret;
+			ret.reserve(length);
 
-			//PooledObjects.ByteBufferPool.Push (buffer);
-			//PooledObjects.MemoryStreamPool.Push (ms);
+			while (ret.size() < length) {
+				GS_ASSIGN_OR_THROW(b, stream.ReadByte());
+				if (b == -1)
+					return ::GameSparks::RT::Proto::ProtocolBufferException("Expected " + System::String::ToString(length - uint(ret.size())) + " got " + System::String::ToString(ret.size()));
+				ret.push_back(char(b));
+			}
 			return ret;
         }
 
-        static System::Failable<void> WriteString(System::IO::Stream& stream, string val)
+        static System::Failable<void> WriteString(System::IO::Stream& stream, const string& val)
         {
-            GS_CALL_OR_THROW(WriteBytes(stream, System::Text::Encoding::UTF8::GetBytes(val)));
+            const uint length = (uint)val.size();
+            GS_CALL_OR_THROW(WriteEncoded(stream, Varint::MAX_VARINT32_SIZE + int(length), [&](byte*& pos, byte* end) -> bool {
+                if (!Varint::WriteUInt32(pos, end, length))
+                    return false;
+                memcpy(pos, val.data(), length);
+                pos += length;
+                return true;
+            }));
             return {};
         }
 
@@ -165,6 +176,16 @@ namespace GameSparks { namespace RT { namespace Proto {
         /// </summary>
         static System::Failable<void> ReadSkipVarInt(System::IO::Stream& stream)
         {
+            int available = 0;
+            if (const byte* begin = stream.ReadSpan(available))
+            {
+                const byte* pos = begin;
+                if (Varint::SkipVarint(pos, begin + available) != Varint::OK)
+                    GS_THROW(System::IO::IOException("System::IO::Stream& ended too early"));
+                stream.Advance(int(pos - begin));
+                return {};
+            }
+
 			for (;;)
             {
                 GS_ASSIGN_OR_THROW(b, stream.ReadByte());
@@ -182,7 +203,7 @@ namespace GameSparks { namespace RT { namespace Proto {
         static System::Failable<int> ReadZInt32(System::IO::Stream& stream)
         {
             GS_ASSIGN_OR_THROW(val, ReadUInt32(stream));
-            return (int)(val >> 1) ^ ((int)(val << 31) >> 31);
+            return Varint::DecodeZigZag32(val);
         }
 
         /// <summary>
@@ -190,7 +211,7 @@ namespace GameSparks { namespace RT { namespace Proto {
         /// </summary>
         static System::Failable<void> WriteZInt32(System::IO::Stream& stream, int val)
         {
-            GS_CALL_OR_THROW(WriteUInt32(stream, (uint)((val << 1) ^ (val >> 31))));
+            GS_CALL_OR_THROW(WriteUInt32(stream, Varint::EncodeZigZag32(val)));
             return {};
         }
 
@@ -201,6 +222,9 @@ namespace GameSparks { namespace RT { namespace Proto {
         static System::Failable<uint> ReadUInt32(System::IO::Stream& stream)
         {
             uint val = 0;
+            GS_ASSIGN_OR_THROW(decoded, DecodeInPlace(stream, &Varint::ReadUInt32, val, "Got larger VarInt than 32bit unsigned"));
+            if (decoded)
+                return val;
 
             for (int n = 0; n < 5; n++)
             {
@@ -227,6 +251,14 @@ namespace GameSparks { namespace RT { namespace Proto {
         /// </summary>
         static System::Failable<void> WriteUInt32(System::IO::Stream& stream, uint val)
         {
+            if (byte* begin = stream.WriteSpan(Varint::MAX_VARINT32_SIZE))
+            {
+                byte* pos = begin;
+                Varint::WriteUInt32(pos, begin + Varint::MAX_VARINT32_SIZE, val);
+                stream.Commit(int(pos - begin));
+                return {};
+            }
+
             byte b;
 			for (;;)
             {
@@ -252,8 +284,7 @@ namespace GameSparks { namespace RT { namespace Proto {
         static System::Failable<int64_t> ReadZInt64(System::IO::Stream& stream)
         {
             GS_ASSIGN_OR_THROW(val, ReadUInt64(stream));
-            // https://github.com/google/protobuf/blob/24fe6ba750bf8a247d41fc589460dce1bdd697a1/ruby/ext/google/protobuf_c/upb.h#L7703
-            return (val >> 1) ^ -(int64_t)(val & 1);
+            return Varint::DecodeZigZag64(val);
         }
 
         /// <summary>
@@ -261,7 +292,7 @@ namespace GameSparks { namespace RT { namespace Proto {
         /// </summary>
         static System::Failable<void> WriteZInt64(System::IO::Stream& stream, int64_t val)
         {
-            GS_CALL_OR_THROW(WriteUInt64(stream, (uint64_t)((val << 1) ^ (val >> 63))));
+            GS_CALL_OR_THROW(WriteUInt64(stream, Varint::EncodeZigZag64(val)));
             return {};
         }
 
@@ -271,6 +302,9 @@ namespace GameSparks { namespace RT { namespace Proto {
         static System::Failable<uint64_t> ReadUInt64(System::IO::Stream& stream)
         {
             uint64_t val = 0;
+            GS_ASSIGN_OR_THROW(decoded, DecodeInPlace(stream, &Varint::ReadUInt64, val, "Got larger VarInt than 64 bit unsigned"));
+            if (decoded)
+                return val;
 
             for (int n = 0; n < 10; n++)
             {
@@ -297,6 +331,14 @@ namespace GameSparks { namespace RT { namespace Proto {
         /// </summary>
         static System::Failable<void> WriteUInt64(System::IO::Stream& stream, uint64_t val)
         {
+            if (byte* begin = stream.WriteSpan(Varint::MAX_VARINT64_SIZE))
+            {
+                byte* pos = begin;
+                Varint::WriteUInt64(pos, begin + Varint::MAX_VARINT64_SIZE, val);
+                stream.Commit(int(pos - begin));
+                return {};
+            }
+
             byte b;
 			for (;;)
             {
@@ -334,7 +376,57 @@ namespace GameSparks { namespace RT { namespace Proto {
             return {};
         }
 
+        /// <summary>
+        /// Encodes at most size bytes with encode(pos, end), see Varint. In place, if the stream supports
+        /// Stream::WriteSpan(), through a temporary buffer otherwise.
+        /// </summary>
+        template <typename Encoder>
+        static System::Failable<void> WriteEncoded(System::IO::Stream& stream, int size, const Encoder& encode)
+        {
+            if (byte* begin = stream.WriteSpan(size))
+            {
+                byte* pos = begin;
+                const bool encoded = encode(pos, begin + size);
+                assert(encoded && "size is too small");
+                (void)encoded;
+                stream.Commit(int(pos - begin));
+                return {};
+            }
+
+            bytes buffer(size);
+            byte* pos = buffer.data();
+            const bool encoded = encode(pos, pos + size);
+            assert(encoded && "size is too small");
+            (void)encoded;
+            GS_CALL_OR_THROW(stream.Write(buffer, 0, int(pos - buffer.data())));
+            return {};
+        }
+
 		private:
+		/// <summary>
+		/// Decodes value with read in place, if the stream supports Stream::ReadSpan(). Returns false if it
+		/// does not, the caller has to read byte by byte then.
+		/// </summary>
+		template <typename T>
+		static System::Failable<bool> DecodeInPlace(System::IO::Stream& stream, Varint::Result (*read)(const byte*&, const byte*, T&), T& value, const char* overflowMessage)
+		{
+			int available = 0;
+			const byte* begin = stream.ReadSpan(available);
+			if (!begin)
+				return false;
+
+			const byte* pos = begin;
+			switch (read(pos, begin + available, value))
+			{
+				case Varint::OK:
+					stream.Advance(int(pos - begin));
+					return true;
+				case Varint::Truncated:
+					GS_THROW(System::IO::IOException("System::IO::Stream& ended too early"));
+				default:
+					GS_THROW(ProtocolBufferException(overflowMessage));
+			}
+		}
 	};
 
 }}} /* namespace GameSparks.RT.Proto */
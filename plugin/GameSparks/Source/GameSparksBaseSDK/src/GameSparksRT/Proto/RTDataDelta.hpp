@@ -0,0 +1,137 @@
+#ifndef _GAMESPARKSRT_RTDATADELTA_HPP_
+#define _GAMESPARKSRT_RTDATADELTA_HPP_
+
+#include "../../../include/GameSparks/gsstl.h"
+#include "../../../include/System/Bytes.hpp"
+#include "../../../include/GameSparksRT/RTData.hpp"
+#include "../../System/Failable.hpp"
+
+namespace GameSparks { namespace RT { namespace Proto {
+
+	/*!
+		Delta encoding of RTData against per opCode baselines, see GameSparksRTSessionBuilder::EnableDeltaEncoding().
+
+		A delta packet is sent with the delta opCode. Its RTData holds the slots that changed, its payload the header:
+
+			kind (uint8) | opCode (int32) | baseline id (uint16) | removed slot count (uint8) | removed slot indices (uint8 each)
+
+		All integers are little endian.
+	*/
+	class RTDataDelta
+	{
+		public:
+			enum Kind
+			{
+				KEYFRAME = 0,       ///< full data, becomes the baseline with the given id and is delivered
+				DELTA = 1,          ///< changes relative to the baseline with the given id, which stays the baseline
+				DELTA_ADVANCE = 2,  ///< changes relative to the baseline with the given id, the result becomes baseline id + 1. sent reliably.
+				RESYNC_REQUEST = 3, ///< the receiver misses the baseline of opCode and asks the sender for it
+				BASELINE = 4        ///< full data, the answer to RESYNC_REQUEST. becomes the baseline and is delivered, as it carries
+				                    ///< the reliable changes the receiver dropped while it missed the baseline.
+			};
+
+			struct Header
+			{
+				Kind kind = KEYFRAME;
+				int opCode = 0;
+				uint16_t baselineId = 0;
+				gsstl::vector<System::Byte> removed;
+			};
+
+			static void WriteHeader(System::Bytes& bytes, const Header& header);
+			static System::Failable<void> ReadHeader(const System::Bytes& bytes, Header& header);
+
+			/// sets the slots of current that differ from baseline in changed, and adds the slots set in baseline,
+			/// but not in current, to removed. returns the number of changed and removed slots.
+			static int Diff(const RTData& baseline, const RTData& current, RTData& changed, gsstl::vector<System::Byte>& removed);
+
+			/// the inverse of Diff()
+			static void Apply(RTData& baseline, const RTData& changed, const gsstl::vector<System::Byte>& removed);
+
+			/// number of slots set in data
+			static int CountSlots(const RTData& data);
+	};
+
+	/*!
+		The sending side of the delta encoding. Tracks the baseline of each opCode.
+
+		Reliable sends are encoded against the previous reliable send and advance the baseline. Unreliable sends are encoded
+		against the baseline without changing it. The baseline is refreshed by a reliable keyframe every keyframeInterval
+		unreliable sends, so that unreliable deltas stay small. The baselines are shared by all peers, so only sends to all
+		peers may be encoded. Not thread safe.
+	*/
+	class DeltaEncoder
+	{
+		public:
+			enum Mode
+			{
+				SEND_PLAIN,    ///< delta encoding does not pay off, send the data as it is
+				SEND_KEYFRAME, ///< send header and slots reliably
+				SEND_DELTA     ///< send header and slots with the intent of the message
+			};
+
+			explicit DeltaEncoder(int keyframeInterval = 30) : keyframeInterval(keyframeInterval) {}
+
+			void SetKeyframeInterval(int interval) { keyframeInterval = interval; }
+
+			/// decides how data is sent with opCode and fills header and slots accordingly
+			Mode Encode(int opCode, bool reliable, const RTData& data, RTDataDelta::Header& header, RTData& slots);
+
+			/// fills header and slots with the current baseline of opCode, to answer a resync request. false if there is none.
+			bool GetBaseline(int opCode, RTDataDelta::Header& header, RTData& slots) const;
+
+			/// makes the next send of each opCode a keyframe, e.g. because a peer joined that has none of the baselines
+			void Reset();
+
+		private:
+			struct Baseline
+			{
+				uint16_t id = 0;
+				RTData data;
+				int unreliableSends = 0; // since the baseline was set
+				bool needsKeyframe = false;
+			};
+
+			int keyframeInterval;
+			gsstl::map<int, Baseline> baselines;
+	};
+
+	/*!
+		The receiving side of the delta encoding. Tracks the baselines per sender and opCode. Not thread safe.
+	*/
+	class DeltaDecoder
+	{
+		public:
+			enum Result
+			{
+				DELIVER, ///< data holds the reconstructed message
+				DROP,    ///< nothing to deliver
+				RESYNC   ///< nothing to deliver, the baseline is missing. ask the sender for it.
+			};
+
+			Result Decode(int sender, const RTDataDelta::Header& header, const RTData& slots, RTData& data,
+						  const gsstl::chrono::steady_clock::time_point& now);
+
+			/// drops the baselines of sender, e.g. because the peer disconnected
+			void Clear(int sender);
+
+		private:
+			struct Baseline
+			{
+				bool valid = false;
+				uint16_t id = 0;
+				RTData data;
+				bool missing = false; // unreliable deltas against a newer baseline arrived
+				gsstl::chrono::steady_clock::time_point missingSince;
+				bool requested = false;
+				gsstl::chrono::steady_clock::time_point requestedAt;
+			};
+
+			Result RequestResync(Baseline& baseline, const gsstl::chrono::steady_clock::time_point& now);
+
+			gsstl::map<gsstl::pair<int, int>, Baseline> baselines; // by sender and opCode
+	};
+
+}}} /* namespace GameSparks.RT.Proto */
+
+#endif /* _GAMESPARKSRT_RTDATADELTA_HPP_ */
@@ -44,7 +44,7 @@ System::Failable<void> RTVal::DeserializeLengthDelimited(System::IO::Stream &str
 }
 
 
-System::Failable<void> RTVal::SerializeLengthDelimited(System::IO::Stream &stream) {
+System::Failable<void> RTVal::SerializeLengthDelimited(System::IO::Stream &stream) const {
     assert(this);
     GS_CALL_OR_THROW(RTValSerializer::WriteRTVal (stream, *this));
     return {};
@@ -60,4 +60,27 @@ RTVal::operator bool() const {
         vec_val.HasValue();
 }
 
+// unlike Nullable::operator==, this is also safe if only one of them has a value
+template <typename T>
+static bool SameValue(const System::Nullable<T>& a, const System::Nullable<T>& b) {
+    return a.HasValue() == b.HasValue() && (!a.HasValue() || a.Value() == b.Value());
+}
+
+static bool SameValue(const System::Nullable<RTVector>& a, const System::Nullable<RTVector>& b) {
+    return a.HasValue() == b.HasValue() && (!a.HasValue() || (
+        SameValue(a.Value().x, b.Value().x) &&
+        SameValue(a.Value().y, b.Value().y) &&
+        SameValue(a.Value().z, b.Value().z) &&
+        SameValue(a.Value().w, b.Value().w)));
+}
+
+bool RTVal::operator==(const RTVal& o) const {
+    return SameValue(long_val, o.long_val) &&
+        SameValue(float_val, o.float_val) &&
+        SameValue(double_val, o.double_val) &&
+        SameValue(data_val, o.data_val) &&
+        SameValue(string_val, o.string_val) &&
+        SameValue(vec_val, o.vec_val);
+}
+
 }}} /* namespace GameSparks.RT.Proto */
@@ -0,0 +1,313 @@
+#ifndef _GAMESPARKSRT_VARINT_HPP_
+#define _GAMESPARKSRT_VARINT_HPP_
+
+#include <cstdint>
+#include <cstring>
+
+/// set to 0 to decode varints of more than one byte with the plain byte loop
+#ifndef GS_RT_BRANCH_REDUCED_VARINT
+#	define GS_RT_BRANCH_REDUCED_VARINT 1
+#endif
+
+namespace GameSparks { namespace RT { namespace Proto {
+
+	/*!
+		The protocol buffer primitives on a raw byte span [pos, end). Readers advance pos past the decoded value and
+		return OK, on failure pos is left unchanged. Writers advance pos past the encoded value and return false,
+		if it does not fit, with pos unchanged. No virtual calls, no allocations, see ProtocolParser for the
+		Stream based interface.
+	*/
+	namespace Varint
+	{
+		typedef unsigned char byte;
+
+		enum Result
+		{
+			OK,
+			Truncated, // the span ended within the value
+			Overflow   // the varint does not fit into the requested type
+		};
+
+		enum
+		{
+			MAX_VARINT32_SIZE = 5,
+			MAX_VARINT64_SIZE = 10
+		};
+
+		inline uint32_t EncodeZigZag32(int32_t value) { return (uint32_t(value) << 1) ^ uint32_t(value >> 31); }
+		inline int32_t DecodeZigZag32(uint32_t value) { return int32_t(value >> 1) ^ -int32_t(value & 1); }
+		inline uint64_t EncodeZigZag64(int64_t value) { return (uint64_t(value) << 1) ^ uint64_t(value >> 63); }
+		inline int64_t DecodeZigZag64(uint64_t value) { return int64_t(value >> 1) ^ -int64_t(value & 1); }
+
+		/// the number of bytes value takes as varint
+		inline int SizeOf(uint64_t value)
+		{
+			int size = 1;
+			while (value >= 0x80)
+			{
+				value >>= 7;
+				++size;
+			}
+			return size;
+		}
+
+		inline bool WriteUInt64(byte*& pos, byte* end, uint64_t value)
+		{
+			if (end - pos < MAX_VARINT64_SIZE && end - pos < SizeOf(value))
+			{
+				return false;
+			}
+			byte* p = pos;
+			while (value >= 0x80)
+			{
+				*p++ = byte(value | 0x80);
+				value >>= 7;
+			}
+			*p++ = byte(value);
+			pos = p;
+			return true;
+		}
+
+		inline bool WriteUInt32(byte*& pos, byte* end, uint32_t value) { return WriteUInt64(pos, end, value); }
+		inline bool WriteZInt32(byte*& pos, byte* end, int32_t value) { return WriteUInt64(pos, end, EncodeZigZag32(value)); }
+		inline bool WriteZInt64(byte*& pos, byte* end, int64_t value) { return WriteUInt64(pos, end, EncodeZigZag64(value)); }
+
+		/// the key of a field, wireType is a ProtocolParser Wire
+		inline bool WriteKey(byte*& pos, byte* end, uint32_t field, int wireType)
+		{
+			return WriteUInt32(pos, end, (field << 3) | uint32_t(wireType));
+		}
+
+		inline bool WriteFixed32(byte*& pos, byte* end, uint32_t value)
+		{
+			if (end - pos < 4)
+			{
+				return false;
+			}
+			for (int i = 0; i < 4; ++i)
+			{
+				*pos++ = byte(value >> (8 * i));
+			}
+			return true;
+		}
+
+		inline bool WriteFixed64(byte*& pos, byte* end, uint64_t value)
+		{
+			if (end - pos < 8)
+			{
+				return false;
+			}
+			for (int i = 0; i < 8; ++i)
+			{
+				*pos++ = byte(value >> (8 * i));
+			}
+			return true;
+		}
+
+		inline bool WriteFloat(byte*& pos, byte* end, float value)
+		{
+			uint32_t bits;
+			memcpy(&bits, &value, sizeof(bits));
+			return WriteFixed32(pos, end, bits);
+		}
+
+		inline bool WriteDouble(byte*& pos, byte* end, double value)
+		{
+			uint64_t bits;
+			memcpy(&bits, &value, sizeof(bits));
+			return WriteFixed64(pos, end, bits);
+		}
+
+		namespace Detail
+		{
+			inline uint64_t LoadFixed64(const byte* p)
+			{
+				// compilers turn this into a single load on little endian targets
+				return uint64_t(p[0]) | uint64_t(p[1]) << 8 | uint64_t(p[2]) << 16 | uint64_t(p[3]) << 24 |
+					uint64_t(p[4]) << 32 | uint64_t(p[5]) << 40 | uint64_t(p[6]) << 48 | uint64_t(p[7]) << 56;
+			}
+
+			/// decodes a varint of up to 8 bytes from the 8 bytes at pos without a loop. returns false for longer ones.
+			inline bool ReadUInt64BranchReduced(const byte*& pos, uint64_t& value)
+			{
+				const uint64_t word = LoadFixed64(pos);
+
+				// the high bit of the last byte is clear
+				const uint64_t stops = ~word & 0x8080808080808080ULL;
+				if (stops == 0)
+				{
+					return false;
+				}
+				const uint64_t lastStop = stops & (0 - stops);
+				// the stop bit is bit 8 * n + 7 for a varint of n + 1 bytes, multiplying by 2^(8 * n) moves byte 7 - n
+				// of the constant, which is n + 1, to the top.
+				const int size = int(((lastStop >> 7) * 0x0102030405060708ULL) >> 56);
+
+				// drop the bytes after the varint and the continuation bits, then close the gaps between the 7 bit groups
+				uint64_t bits = word & ((lastStop << 1) - 1) & 0x7f7f7f7f7f7f7f7fULL;
+				bits = (bits & 0x007f007f007f007fULL) | ((bits & 0x7f007f007f007f00ULL) >> 1);
+				bits = (bits & 0x00003fff00003fffULL) | ((bits & 0x3fff00003fff0000ULL) >> 2);
+				bits = (bits & 0x000000000fffffffULL) | ((bits & 0x0fffffff00000000ULL) >> 4);
+
+				value = bits;
+				pos += size;
+				return true;
+			}
+		}
+
+		inline Result ReadUInt64(const byte*& pos, const byte* end, uint64_t& value)
+		{
+			if (pos < end && *pos < 0x80)
+			{
+				value = *pos++;
+				return OK;
+			}
+
+			#if GS_RT_BRANCH_REDUCED_VARINT
+			if (end - pos >= 8 && Detail::ReadUInt64BranchReduced(pos, value))
+			{
+				return OK;
+			}
+			#endif
+
+			uint64_t val = 0;
+			const byte* p = pos;
+			for (int n = 0; n < MAX_VARINT64_SIZE; ++n)
+			{
+				if (p == end)
+				{
+					return Truncated;
+				}
+				const byte b = *p++;
+
+				// the 10th byte holds the highest bit only
+				if (n == MAX_VARINT64_SIZE - 1 && (b & 0xFE) != 0)
+				{
+					return Overflow;
+				}
+				val |= uint64_t(b & 0x7F) << (7 * n);
+				if ((b & 0x80) == 0)
+				{
+					value = val;
+					pos = p;
+					return OK;
+				}
+			}
+			return Overflow;
+		}
+
+		inline Result ReadUInt32(const byte*& pos, const byte* end, uint32_t& value)
+		{
+			const byte* p = pos;
+			uint64_t val;
+			Result result = ReadUInt64(p, end, val);
+			if (result != OK)
+			{
+				return result;
+			}
+			if (p - pos > MAX_VARINT32_SIZE || (val >> 32) != 0)
+			{
+				return Overflow;
+			}
+			value = uint32_t(val);
+			pos = p;
+			return OK;
+		}
+
+		inline Result ReadZInt32(const byte*& pos, const byte* end, int32_t& value)
+		{
+			uint32_t val;
+			Result result = ReadUInt32(pos, end, val);
+			if (result == OK)
+			{
+				value = DecodeZigZag32(val);
+			}
+			return result;
+		}
+
+		inline Result ReadZInt64(const byte*& pos, const byte* end, int64_t& value)
+		{
+			uint64_t val;
+			Result result = ReadUInt64(pos, end, val);
+			if (result == OK)
+			{
+				value = DecodeZigZag64(val);
+			}
+			return result;
+		}
+
+		/// splits a key into field and wireType, a ProtocolParser Wire
+		inline Result ReadKey(const byte*& pos, const byte* end, uint32_t& field, int& wireType)
+		{
+			uint32_t key;
+			Result result = ReadUInt32(pos, end, key);
+			if (result == OK)
+			{
+				field = key >> 3;
+				wireType = int(key & 0x07);
+			}
+			return result;
+		}
+
+		/// moves pos past a varint without decoding it
+		inline Result SkipVarint(const byte*& pos, const byte* end)
+		{
+			for (const byte* p = pos; p != end;)
+			{
+				if ((*p++ & 0x80) == 0)
+				{
+					pos = p;
+					return OK;
+				}
+			}
+			return Truncated;
+		}
+
+		inline Result ReadFixed32(const byte*& pos, const byte* end, uint32_t& value)
+		{
+			if (end - pos < 4)
+			{
+				return Truncated;
+			}
+			value = uint32_t(pos[0]) | uint32_t(pos[1]) << 8 | uint32_t(pos[2]) << 16 | uint32_t(pos[3]) << 24;
+			pos += 4;
+			return OK;
+		}
+
+		inline Result ReadFixed64(const byte*& pos, const byte* end, uint64_t& value)
+		{
+			if (end - pos < 8)
+			{
+				return Truncated;
+			}
+			value = Detail::LoadFixed64(pos);
+			pos += 8;
+			return OK;
+		}
+
+		inline Result ReadFloat(const byte*& pos, const byte* end, float& value)
+		{
+			uint32_t bits;
+			Result result = ReadFixed32(pos, end, bits);
+			if (result == OK)
+			{
+				memcpy(&value, &bits, sizeof(value));
+			}
+			return result;
+		}
+
+		inline Result ReadDouble(const byte*& pos, const byte* end, double& value)
+		{
+			uint64_t bits;
+			Result result = ReadFixed64(pos, end, bits);
+			if (result == OK)
+			{
+				memcpy(&value, &bits, sizeof(value));
+			}
+			return result;
+		}
+	}
+
+}}} /* namespace GameSparks.RT.Proto */
+
+#endif /* _GAMESPARKSRT_VARINT_HPP_ */
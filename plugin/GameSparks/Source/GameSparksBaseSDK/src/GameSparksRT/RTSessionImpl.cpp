@@ -5,9 +5,14 @@
 #include "Commands/LogCommand.hpp"
 #include "Commands/ActionCommand.hpp"
 #include "Commands/CommandFactory.hpp"
+#include "Commands/CustomCommand.hpp"
+#include "Commands/Results/PlayerDisconnectMessage.hpp"
+#include "Proto/Packet.hpp"
+#include "Proto/ProtocolBufferException.hpp"
 #include "../System/Threading/Thread.hpp"
 #include "../GameSparks/GSClientConfig.h"
 #include <iostream>
+#include <cassert>
 
 #if GS_RT_OVER_WS
 #	include "Connection/WebSocketConnection.hpp"
@@ -83,6 +88,67 @@ int RTSessionImpl::SendBytes(int opCode, GameSparksRT::DeliveryIntent deliveryIn
 int RTSessionImpl::SendRTDataAndBytes(int opCode, GameSparksRT::DeliveryIntent intent,
                                       const System::ArraySegment<System::Byte> &payload, const RTData &data,
                                       const gsstl::vector<int> &targetPlayers)
+{
+    return SendPacket(opCode, intent, payload, data, targetPlayers, opCode);
+}
+
+
+int RTSessionImpl::SendCompressed(int opCode, GameSparksRT::DeliveryIntent intent,
+                                  const System::ArraySegment<System::Byte> &payload, const RTData &data,
+                                  const gsstl::vector<int> &targetPlayers)
+{
+    if(opCode != 0 && compressionOpCode != 0)
+    {
+        // compressedMessage is guarded by sendMutex
+        gsstl::lock_guard<gsstl::recursive_mutex> lock(sendMutex);
+        GS_TRY
+        {
+            GS_ASSIGN_OR_CATCH(compressed, Compress(opCode, payload, data));
+            if(compressed)
+            {
+                static const RTData noData;
+                return SendPacket(compressionOpCode, intent, compressedMessage, noData, targetPlayers, opCode);
+            }
+        }
+        GS_CATCH(e)
+        {
+            (void)e;
+            return 0;
+        }
+    }
+    return SendPacket(opCode, intent, payload, data, targetPlayers, opCode);
+}
+
+
+int RTSessionImpl::SendDelta(int opCode, GameSparksRT::DeliveryIntent intent, const RTData &data,
+                             const gsstl::vector<int> &targetPlayers)
+{
+    // the baselines are shared by all peers, a send to some of them would leave the others behind
+    if(opCode == 0 || deltaOpCode == 0 || !targetPlayers.empty())
+    {
+        return SendRTData(opCode, intent, data, targetPlayers);
+    }
+
+    // the encoder state and deltaMessage are guarded by sendMutex
+    gsstl::lock_guard<gsstl::recursive_mutex> lock(sendMutex);
+    switch(deltaEncoder.Encode(opCode, intent == GameSparksRT::DeliveryIntent::RELIABLE, data, deltaHeader, deltaSlots))
+    {
+        case Proto::DeltaEncoder::SEND_KEYFRAME:
+            Proto::RTDataDelta::WriteHeader(deltaMessage, deltaHeader);
+            return SendPacket(deltaOpCode, GameSparksRT::DeliveryIntent::RELIABLE, deltaMessage, deltaSlots, targetPlayers, opCode);
+        case Proto::DeltaEncoder::SEND_DELTA:
+            Proto::RTDataDelta::WriteHeader(deltaMessage, deltaHeader);
+            return SendPacket(deltaOpCode, intent, deltaMessage, deltaSlots, targetPlayers, opCode);
+        case Proto::DeltaEncoder::SEND_PLAIN:
+        default:
+            return SendRTData(opCode, intent, data, targetPlayers);
+    }
+}
+
+
+int RTSessionImpl::SendPacket(int opCode, GameSparksRT::DeliveryIntent intent,
+                              const System::ArraySegment<System::Byte> &payload, const RTData &data,
+                              const gsstl::vector<int> &targetPlayers, int messageOpCode)
 {
     if(opCode == 0)
     {
@@ -90,16 +156,28 @@ int RTSessionImpl::SendRTDataAndBytes(int opCode, GameSparksRT::DeliveryIntent i
         return 0;
     }
 
-    CustomRequest csr(opCode, intent, payload, data, targetPlayers);
     GS_TRY
     {
+        CustomRequest csr(opCode, intent, payload, data, targetPlayers);
 		#if !GS_RT_OVER_WS
         if(intent != GameSparksRT::DeliveryIntent::RELIABLE && GetConnectState() >= GameSparksRT::ConnectState::ReliableAndFastSend )
         {
             gsstl::lock_guard<gsstl::recursive_mutex> lock(sendMutex);
             if(fastConnection)
             {
-                GS_RETURN_RESULT_OR_CATCH(fastConnection->Send(csr));
+                if(fragmentOpCode != 0)
+                {
+                    GS_ASSIGN_OR_CATCH(sentInFragments, SendFragmented(opCode, intent, payload, data, targetPlayers));
+                    if(sentInFragments < 0)
+                    {
+                        return 0; // too large, it would not fit into a single datagram either
+                    }
+                    if(sentInFragments > 0)
+                    {
+                        return sentInFragments;
+                    }
+                }
+                GS_RETURN_RESULT_OR_CATCH(fastConnection->Queue(csr));
             }
             else
             {
@@ -113,7 +191,14 @@ int RTSessionImpl::SendRTDataAndBytes(int opCode, GameSparksRT::DeliveryIntent i
             gsstl::lock_guard<gsstl::recursive_mutex> lock(sendMutex);
             if(reliableConnection && GetConnectState() >= GameSparksRT::ConnectState::ReliableOnly)
             {
-                GS_RETURN_RESULT_OR_CATCH(reliableConnection->Send(csr));
+                GS_ASSIGN_OR_CATCH(sent, reliableConnection->Send(csr));
+				#if !GS_RT_OVER_WS
+                if(ShouldFlushImmediately(messageOpCode) || reliableConnection->GetBufferedBytes() >= reliableFlushThreshold)
+                {
+                    reliableConnection->Flush();
+                }
+				#endif
+                return sent;
             }
             else
             {
@@ -129,6 +214,222 @@ int RTSessionImpl::SendRTDataAndBytes(int opCode, GameSparksRT::DeliveryIntent i
     return 0;
 }
 
+#if !GS_RT_OVER_WS
+System::Failable<int> RTSessionImpl::SendFragmented(int opCode, GameSparksRT::DeliveryIntent intent,
+                                                    const System::ArraySegment<System::Byte> &payload, const RTData &data,
+                                                    const gsstl::vector<int> &targetPlayers)
+{
+    // leaves room for the packet around the fragment and its target players
+    const int chunkSize = int(GameSparksRT::MAX_MESSAGE_SIZE_BYTES) - Proto::Fragmentation::HEADER_SIZE - Proto::Packet::MaxOverhead(int(targetPlayers.size()));
+
+    // the size is computed up front, so that messages that fit into a single datagram are not serialized twice
+    const int size = Proto::Fragmentation::MessageSize(data, payload);
+    if (size <= chunkSize) {
+        return 0; // fits into a single datagram
+    }
+
+    const int count = chunkSize > 0 ? (size + chunkSize - 1) / chunkSize : 0;
+    if (size > maxFragmentedMessageSize || count <= 0 || count > Proto::Fragmentation::MAX_FRAGMENTS) {
+        Log("RTSessionImpl", GameSparksRT::LogLevel::LL_WARN, "message of {0} bytes with opCode {1} is too large to be sent in fragments", size, opCode);
+        return -1;
+    }
+
+    Pools::Pooled<System::IO::MemoryStream> scratch(&scratchStreams);
+    GS_CALL_OR_THROW(Proto::Fragmentation::WriteMessage(fragmentMessage, data, payload, *scratch));
+    assert(int(fragmentMessage.size()) == size);
+
+    static const RTData noData;
+    const uint16_t messageId = nextFragmentedMessageId++;
+    int sent = 0;
+    for (int index = 0; index != count; ++index) {
+        Proto::Fragmentation::WriteFragment(fragment, opCode, intent == GameSparksRT::DeliveryIntent::UNRELIABLE_SEQUENCED, messageId, index, count, fragmentMessage, chunkSize);
+        CustomRequest request(fragmentOpCode, GameSparksRT::DeliveryIntent::UNRELIABLE, fragment, noData, targetPlayers);
+        GS_ASSIGN_OR_THROW(bytes, fastConnection->Queue(request));
+        sent += bytes;
+    }
+    return sent;
+}
+#endif
+
+System::Failable<IRTCommand*> RTSessionImpl::OnFragmentReceived(int sender, System::IO::Stream& stream, int limit)
+{
+    // resize() keeps the capacity of the pooled buffers, so they only grow to the largest message received
+    Pools::Pooled<System::Bytes> received(&scratchBytes);
+    received->resize(limit);
+    GS_CALL_OR_THROW(stream.Read(*received, 0, limit));
+
+    int opCode = 0;
+    RTData data;
+    Pools::Pooled<System::Bytes> payload(&scratchBytes);
+    {
+        gsstl::lock_guard<gsstl::mutex> lock(reassemblerMutex);
+        GS_ASSIGN_OR_THROW(complete, reassembler.Add(sender, *received, opCode, data, *payload));
+        if (!complete) {
+            return nullptr;
+        }
+    }
+
+    if (opCode != 0 && opCode == compressionOpCode) {
+        return Decompress(sender, *payload);
+    }
+    if (opCode != 0 && opCode == deltaOpCode) {
+        return DecodeDelta(sender, *payload, data);
+    }
+    return CreateCustomCommand(opCode, sender, data, *payload);
+}
+
+System::Failable<IRTCommand*> RTSessionImpl::CreateCustomCommand(int opCode, int sender, const RTData& data, const System::Bytes& payload)
+{
+    Pools::Pooled<System::IO::MemoryStream> ms(&scratchStreams);
+    GS_CALL_OR_THROW(ms->SetLength(0));
+    GS_CALL_OR_THROW(ms->Write(payload, 0, int(payload.size())));
+    GS_CALL_OR_THROW(ms->Position(0));
+    GS_ASSIGN_OR_THROW(command, CustomCommand::Deserialize(opCode, sender, *ms, data, int(payload.size()), *this));
+    return command;
+}
+
+void RTSessionImpl::SetFragmentation(int opCode, int maxMessageSize) {
+    fragmentOpCode = opCode;
+    maxFragmentedMessageSize = maxMessageSize;
+    reassembler.SetMaxMessageSize(maxMessageSize);
+}
+
+// a compressed message is the opCode (int32) and the size (uint32) of the uncompressed message, both little endian,
+// followed by the message compressed by compressor. the uncompressed message is written by Proto::Fragmentation::WriteMessage().
+System::Failable<bool> RTSessionImpl::Compress(int opCode, const System::ArraySegment<System::Byte> &payload, const RTData &data)
+{
+    Pools::Pooled<System::IO::MemoryStream> scratch(&scratchStreams);
+    GS_CALL_OR_THROW(Proto::Fragmentation::WriteMessage(uncompressedMessage, data, payload, *scratch));
+    const int size = int(uncompressedMessage.size());
+    if (size > maxCompressedMessageSize) {
+        Log("RTSessionImpl", GameSparksRT::LogLevel::LL_WARN, "message of {0} bytes with opCode {1} is too large to be compressed", size, opCode);
+        return false;
+    }
+
+    compressedMessage.resize(8);
+    compressedMessage[0] = System::Byte(opCode);
+    compressedMessage[1] = System::Byte(opCode >> 8);
+    compressedMessage[2] = System::Byte(opCode >> 16);
+    compressedMessage[3] = System::Byte(opCode >> 24);
+    compressedMessage[4] = System::Byte(size);
+    compressedMessage[5] = System::Byte(size >> 8);
+    compressedMessage[6] = System::Byte(size >> 16);
+    compressedMessage[7] = System::Byte(size >> 24);
+    compressor.Compress(uncompressedMessage.data(), size, compressedMessage);
+
+    // the uncompressed message is about as large as data and payload sent directly
+    return int(compressedMessage.size()) < size;
+}
+
+System::Failable<IRTCommand*> RTSessionImpl::Decompress(int sender, const System::Bytes& message)
+{
+    if (message.size() < 8) {
+        GS_THROW(Proto::ProtocolBufferException("compressed message too short"));
+    }
+
+    const int opCode = int(uint32_t(message[0]) | (uint32_t(message[1]) << 8) | (uint32_t(message[2]) << 16) | (uint32_t(message[3]) << 24));
+    const int size = int(uint32_t(message[4]) | (uint32_t(message[5]) << 8) | (uint32_t(message[6]) << 16) | (uint32_t(message[7]) << 24));
+    if (size < 0 || size > maxCompressedMessageSize) {
+        GS_THROW(Proto::ProtocolBufferException("compressed message exceeds the maximum message size"));
+    }
+
+    Pools::Pooled<System::Bytes> uncompressed(&scratchBytes);
+    GS_CALL_OR_THROW(compressor.Decompress(message.data() + 8, int(message.size()) - 8, size, *uncompressed));
+
+    RTData data;
+    Pools::Pooled<System::Bytes> payload(&scratchBytes);
+    {
+        Pools::Pooled<BinaryWriteMemoryStream> scratch(&readStreams);
+        GS_CALL_OR_THROW(Proto::Fragmentation::ReadMessage(*uncompressed, data, *payload, *scratch));
+    }
+    if (opCode != 0 && opCode == deltaOpCode) {
+        return DecodeDelta(sender, *payload, data);
+    }
+    return CreateCustomCommand(opCode, sender, data, *payload);
+}
+
+System::Failable<IRTCommand*> RTSessionImpl::OnCompressedReceived(int sender, System::IO::Stream& stream, int limit)
+{
+    Pools::Pooled<System::Bytes> received(&scratchBytes);
+    received->resize(limit);
+    GS_CALL_OR_THROW(stream.Read(*received, 0, limit));
+    return Decompress(sender, *received);
+}
+
+void RTSessionImpl::SetCompression(int opCode, const System::Bytes& dictionary, int maxMessageSize) {
+    compressionOpCode = opCode;
+    maxCompressedMessageSize = maxMessageSize;
+    compressor = Proto::LZCodec(dictionary);
+}
+
+System::Failable<IRTCommand*> RTSessionImpl::OnDeltaReceived(int sender, System::IO::Stream& stream, int limit, const RTData& data)
+{
+    Pools::Pooled<System::Bytes> received(&scratchBytes);
+    received->resize(limit);
+    GS_CALL_OR_THROW(stream.Read(*received, 0, limit));
+    return DecodeDelta(sender, *received, data);
+}
+
+System::Failable<IRTCommand*> RTSessionImpl::DecodeDelta(int sender, const System::Bytes& headerBytes, const RTData& slots)
+{
+    Proto::RTDataDelta::Header header;
+    GS_CALL_OR_THROW(Proto::RTDataDelta::ReadHeader(headerBytes, header));
+
+    // the requests are answered and sent from Update(), not from the threads of the connections
+    if (header.kind == Proto::RTDataDelta::RESYNC_REQUEST) {
+        const int opCode = header.opCode;
+        return new ActionCommand([this, sender, opCode](){
+            Proto::RTDataDelta::Header baselineHeader;
+            RTData baseline;
+            gsstl::lock_guard<gsstl::recursive_mutex> lock(sendMutex);
+            if (deltaEncoder.GetBaseline(opCode, baselineHeader, baseline)) {
+                SendDeltaControl(sender, baselineHeader, baseline);
+            }
+        });
+    }
+
+    RTData data;
+    Proto::DeltaDecoder::Result result;
+    {
+        gsstl::lock_guard<gsstl::mutex> lock(deltaDecoderMutex);
+        result = deltaDecoder.Decode(sender, header, slots, data, gsstl::chrono::steady_clock::now());
+    }
+
+    switch (result) {
+        case Proto::DeltaDecoder::DELIVER:
+        {
+            static const System::Bytes noPayload;
+            return CreateCustomCommand(header.opCode, sender, data, noPayload);
+        }
+        case Proto::DeltaDecoder::RESYNC:
+        {
+            Log("RTSessionImpl", GameSparksRT::LogLevel::LL_DEBUG, "requesting the baseline of opCode {0} from peer {1}", header.opCode, sender);
+            const int opCode = header.opCode;
+            return new ActionCommand([this, sender, opCode](){
+                Proto::RTDataDelta::Header request;
+                request.kind = Proto::RTDataDelta::RESYNC_REQUEST;
+                request.opCode = opCode;
+                SendDeltaControl(sender, request, RTData());
+            });
+        }
+        case Proto::DeltaDecoder::DROP:
+        default:
+            return nullptr;
+    }
+}
+
+void RTSessionImpl::SendDeltaControl(int peerId, const Proto::RTDataDelta::Header& header, const RTData& slots)
+{
+    System::Bytes message;
+    Proto::RTDataDelta::WriteHeader(message, header);
+    SendPacket(deltaOpCode, GameSparksRT::DeliveryIntent::RELIABLE, message, slots, gsstl::vector<int>(1, peerId), deltaOpCode);
+}
+
+void RTSessionImpl::SetDeltaEncoding(int opCode, int keyframeInterval) {
+    deltaOpCode = opCode;
+    deltaEncoder.SetKeyframeInterval(keyframeInterval);
+}
+
 void RTSessionImpl::Stop() {
     Log("IRTSession", GameSparksRT::LogLevel::LL_DEBUG, "Stopped");
 
@@ -138,6 +439,11 @@ void RTSessionImpl::Stop() {
     gsstl::lock_guard<gsstl::recursive_mutex> lock(sendMutex);
 
 	#if !GS_RT_OVER_WS
+    if(reliableConnection)
+    {
+        reliableConnection->Flush();
+    }
+
 	if(fastConnection)
     {
         fastConnection->Stop ();
@@ -206,18 +512,84 @@ void RTSessionImpl::Update() {
     if(running)
         CheckConnection();
 
-    while(gsstl::unique_ptr<IRTCommand> toExecute = GetNextAction())
     {
-        toExecute->Execute ();
+        Core::GSProfilerScope profilerScope(profiler, Core::IGSProfiler::SCOPE_RT_ACTION_DRAIN);
+        // only filled with an update budget, see SubmitAction()
+        while(gsstl::unique_ptr<IRTCommand> toExecute = GetNextAction())
+        {
+            toExecute->Execute ();
+        }
+
+        // the messages are delivered within the budget, what is left is delivered by the next calls.
+        // at least one message is delivered per call, so that the queue drains eventually.
+        const auto deadline = gsstl::chrono::steady_clock::now() + gsstl::chrono::milliseconds(maxMillisecondsPerUpdate);
+        for (int delivered = 0; maxMessagesPerUpdate <= 0 || delivered < maxMessagesPerUpdate; ++delivered)
+        {
+            if (delivered != 0 && maxMillisecondsPerUpdate > 0 && gsstl::chrono::steady_clock::now() >= deadline)
+            {
+                break;
+            }
+
+            gsstl::unique_ptr<IRTCommand> toExecute = GetNextMessage();
+            if (!toExecute)
+            {
+                break;
+            }
+            toExecute->Execute ();
+            Recycle(gsstl::move(toExecute));
+        }
     }
 
     gsstl::lock_guard<gsstl::recursive_mutex> lock(sendMutex);
+	#if !GS_RT_OVER_WS
+    if(fastConnection)
+    {
+        System::Failable<void> flushed = fastConnection->Flush();
+        if(!flushed.isOK())
+        {
+            Log("RTSessionImpl", GameSparksRT::LogLevel::LL_DEBUG, flushed.GetException().Format());
+        }
+    }
+	#endif
+
     if(reliableConnection)
     {
+		#if !GS_RT_OVER_WS
+        reliableConnection->Flush();
+		#endif
         reliableConnection->Poll();
     }
 }
 
+bool RTSessionImpl::HasPendingWork() {
+    {
+        gsstl::lock_guard<gsstl::mutex> lock(actionQueueMutex);
+        if (!actionQueue.empty() || !messageQueue.empty())
+            return true;
+    }
+
+    // the connections receive on threads of their own and submit to the queues above. what is left for Update() is
+    // to flush the packets batched since the last call (or, over websockets, to poll).
+    {
+        gsstl::lock_guard<gsstl::recursive_mutex> lock(sendMutex);
+        #if GS_RT_OVER_WS
+        if (reliableConnection && reliableConnection->NeedsPoll())
+            return true;
+        #else
+        if (fastConnection && fastConnection->HasQueued())
+            return true;
+        if (reliableConnection && reliableConnection->GetBufferedBytes() > 0)
+            return true;
+        #endif
+    }
+
+    // CheckConnection() would reconnect
+    const bool isConnected =
+        GetConnectState() != GameSparksRT::ConnectState::Disconnected &&
+        GetConnectState() != GameSparksRT::ConnectState::Connecting;
+    return running && !isConnected && gsstl::chrono::steady_clock::now() > mustConnnectBy;
+}
+
 void RTSessionImpl::DoLog(const gsstl::string &tag, GameSparks::RT::GameSparksRT::LogLevel level, const gsstl::string &msg) {
     if(GameSparksRT::ShouldLog(tag, level))
     {
@@ -259,29 +631,133 @@ void RTSessionImpl::ConnectFast() {
 	#if !GS_RT_OVER_WS
 	Log("IRTSession", GameSparksRT::LogLevel::LL_DEBUG, "{0}: Creating new fastConnection to {1}", PeerId, FastPort());
     fastConnection.reset(new Connection::FastConnection (hostName, FastPort(), this, sendMutex));
+    fastConnection->SetMaxDatagramSize(maxDatagramSize);
 	#endif
 }
 
 bool RTSessionImpl::ShouldExecute(int peerId, System::Nullable<int> sequence) {
-    if (!sequence.HasValue()) {
-        return true;
-    } else if (!peerMaxSequenceNumbers.count(peerId)) {
-        peerMaxSequenceNumbers[peerId] = 0;
+    bool execute;
+    {
+        gsstl::lock_guard<gsstl::mutex> lock(peerSequencesMutex);
+        execute = peerSequences.Accept(peerId, sequence);
     }
 
-    if (peerMaxSequenceNumbers[peerId] > sequence.Value()) {
+    if (!execute) {
         Log ("IRTSession", GameSparksRT::LogLevel::LL_DEBUG, "Discarding sequence id {0} from peer {1}",
              sequence.Value(), peerId);
-        return false;
-    } else {
-        peerMaxSequenceNumbers [peerId] = sequence.Value();
-        return true;
     }
+    return execute;
 }
 
-void RTSessionImpl::SubmitAction(gsstl::unique_ptr<IRTCommand>& action) {
+void RTSessionImpl::SubmitAction(gsstl::unique_ptr<IRTCommand>& action, bool sequenced) {
     gsstl::lock_guard<gsstl::mutex> lock(actionQueueMutex);
-    actionQueue.push(gsstl::move(action));
+    const CustomCommand* message = action->asCustomCommand();
+    // without a budget everything is run in the order it arrived. with one, the commands that drive the connection state
+    // are run ahead of the messages that are still waiting. the messages of a peer that disconnected are dropped then,
+    // so that they do not reach the listener after its OnPlayerDisconnect().
+    if (!message && (maxMessagesPerUpdate > 0 || maxMillisecondsPerUpdate > 0)) {
+        if (const auto* disconnect = action->asPlayerDisconnectMessage()) {
+            DropQueuedMessages(disconnect->PeerId);
+        }
+        actionQueue.push(gsstl::move(action));
+        return;
+    }
+
+    // the nodes of the list are reused, so that queueing does not allocate
+    if (freeMessageNodes.empty()) {
+        messageQueue.push_back(QueuedMessage());
+    } else {
+        messageQueue.splice(messageQueue.end(), freeMessageNodes, freeMessageNodes.begin());
+    }
+    auto queued = --messageQueue.end();
+    queued->command = gsstl::move(action);
+    queued->newest = message && collapseSequencedMessages && sequenced;
+
+    if (queued->newest) {
+        // ShouldExecute() discarded older sequenced messages already, so a queued one with the same key is superseded.
+        // the keys stay in the map, with messageQueue.end() while no message of theirs is queued.
+        const auto key = gsstl::make_pair(message->Sender(), message->OpCode());
+        auto pos = newestSequencedMessages.find(key);
+        if (pos == newestSequencedMessages.end()) {
+            pos = newestSequencedMessages.insert(gsstl::make_pair(key, messageQueue.end())).first;
+        }
+        auto& newest = pos->second;
+        if (newest != messageQueue.end()) {
+            Recycle(gsstl::move(newest->command));
+            freeMessageNodes.splice(freeMessageNodes.end(), messageQueue, newest);
+        }
+        newest = queued;
+    }
+}
+
+void RTSessionImpl::DropQueuedMessages(int peerId) {
+    for (auto pos = messageQueue.begin(); pos != messageQueue.end();) {
+        const CustomCommand* message = pos->command->asCustomCommand();
+        if (!message || message->Sender() != peerId) {
+            ++pos;
+            continue;
+        }
+        if (pos->newest) {
+            newestSequencedMessages[gsstl::make_pair(message->Sender(), message->OpCode())] = messageQueue.end();
+        }
+        Recycle(gsstl::move(pos->command));
+        auto dropped = pos++;
+        freeMessageNodes.splice(freeMessageNodes.end(), messageQueue, dropped);
+    }
+}
+
+void RTSessionImpl::Recycle(gsstl::unique_ptr<IRTCommand> command) {
+    if (CustomCommand* message = command ? command->asCustomCommand() : nullptr) {
+        command.release();
+        customCommandPool.Push(gsstl::unique_ptr<CustomCommand>(message));
+    }
+}
+
+gsstl::unique_ptr<CustomCommand> RTSessionImpl::PopCustomCommand() {
+    return customCommandPool.Pop();
+}
+
+void RTSessionImpl::OnPayloadAllocated() {
+    gsstl::lock_guard<gsstl::mutex> lock(payloadAllocationsMutex);
+    ++payloadAllocations;
+}
+
+long long RTSessionImpl::GetPoolAllocations() const {
+    gsstl::lock_guard<gsstl::mutex> lock(payloadAllocationsMutex);
+    return customCommandPool.GetAllocations() + scratchStreams.GetAllocations() + readStreams.GetAllocations()
+        + scratchBytes.GetAllocations() + payloadAllocations;
+}
+
+void RTSessionImpl::OnFastDatagramSent(int packets) {
+    gsstl::lock_guard<gsstl::recursive_mutex> lock(sendMutex);
+    unreliablePacketsSent += packets;
+    ++unreliableDatagramsSent;
+}
+
+long long RTSessionImpl::GetUnreliablePacketsSent() const {
+    gsstl::lock_guard<gsstl::recursive_mutex> lock(sendMutex);
+    return unreliablePacketsSent;
+}
+
+long long RTSessionImpl::GetUnreliableDatagramsSent() const {
+    gsstl::lock_guard<gsstl::recursive_mutex> lock(sendMutex);
+    return unreliableDatagramsSent;
+}
+
+bool RTSessionImpl::GetPeerStats(int peerId, RTPeerStats& stats) const {
+    gsstl::lock_guard<gsstl::mutex> lock(peerSequencesMutex);
+    return peerSequences.GetStats(peerId, stats);
+}
+
+void RTSessionImpl::SetReliableFlushPolicy(int threshold, const gsstl::vector<int>& immediateOpCodes) {
+    reliableFlushThreshold = threshold;
+    immediateFlushOpCodes = immediateOpCodes;
+}
+
+bool RTSessionImpl::ShouldFlushImmediately(int opCode) const {
+    // internal messages like PlayerReadyMessage drive the connection state, they are never delayed
+    return opCode < 0 || reliableFlushThreshold <= 0 ||
+        gsstl::find(immediateFlushOpCodes.begin(), immediateFlushOpCodes.end(), opCode) != immediateFlushOpCodes.end();
 }
 
 gsstl::unique_ptr<IRTCommand> RTSessionImpl::GetNextAction() {
@@ -294,13 +770,44 @@ gsstl::unique_ptr<IRTCommand> RTSessionImpl::GetNextAction() {
     return {};
 }
 
+gsstl::unique_ptr<IRTCommand> RTSessionImpl::GetNextMessage() {
+    gsstl::lock_guard<gsstl::mutex> lock(actionQueueMutex);
+    if (messageQueue.empty()) {
+        return {};
+    }
+
+    QueuedMessage& front = messageQueue.front();
+    if (front.newest) {
+        const CustomCommand* message = front.command->asCustomCommand();
+        newestSequencedMessages[gsstl::make_pair(message->Sender(), message->OpCode())] = messageQueue.end();
+    }
+    auto ret = gsstl::move(front.command);
+    freeMessageNodes.splice(freeMessageNodes.end(), messageQueue, messageQueue.begin());
+    return ret;
+}
+
+void RTSessionImpl::SetUpdateBudget(int maxMessages, int maxMilliseconds, bool collapseSequenced) {
+    gsstl::lock_guard<gsstl::mutex> lock(actionQueueMutex);
+    maxMessagesPerUpdate = maxMessages;
+    maxMillisecondsPerUpdate = maxMilliseconds;
+    collapseSequencedMessages = collapseSequenced;
+}
 
 int RTSessionImpl::NextSequenceNumber() {
-    return sequenceNumber++;
+    return int(sequenceNumber++);
 }
 
 void RTSessionImpl::OnPlayerConnect(int peerId) {
     ResetSequenceForPeer (peerId);
+    {
+        // the new peer has none of our baselines and we have none of its
+        gsstl::lock_guard<gsstl::recursive_mutex> lock(sendMutex);
+        deltaEncoder.Reset();
+    }
+    {
+        gsstl::lock_guard<gsstl::mutex> lock(deltaDecoderMutex);
+        deltaDecoder.Clear(peerId);
+    }
     if (SessionListener != nullptr) {
         if (this->Ready) {
             SessionListener->OnPlayerConnect(peerId);
@@ -309,6 +816,15 @@ void RTSessionImpl::OnPlayerConnect(int peerId) {
 }
 
 void RTSessionImpl::OnPlayerDisconnect(int peerId) {
+    {
+        gsstl::lock_guard<gsstl::mutex> lock(reassemblerMutex);
+        reassembler.Clear(peerId);
+    }
+    {
+        gsstl::lock_guard<gsstl::mutex> lock(deltaDecoderMutex);
+        deltaDecoder.Clear(peerId);
+    }
+
     if (SessionListener != nullptr) {
         if (this->Ready) {
             SessionListener->OnPlayerDisconnect(peerId);
@@ -351,9 +867,8 @@ void RTSessionImpl::OnPacket(const RTPacket &/*packet*/)
 
 void RTSessionImpl::ResetSequenceForPeer (int peerId)
 {
-    if (peerMaxSequenceNumbers.count(peerId)) {
-        peerMaxSequenceNumbers[peerId] = 0;
-    }
+    gsstl::lock_guard<gsstl::mutex> lock(peerSequencesMutex);
+    peerSequences.Reset(peerId);
 }
 
 GameSparksRT::ConnectState RTSessionImpl::GetConnectState() const {
@@ -2,6 +2,7 @@
 #include "EndOfStreamException.hpp"
 #include "../ArgumentException.hpp"
 #include "../ArgumentOutOfRangeException.hpp"
+#include <cstring>
 
 namespace System { namespace IO {
 
@@ -9,7 +10,6 @@ namespace System { namespace IO {
 
         BinaryReader::BinaryReader(Stream &stream_)
         :stream(stream_)
-        ,_buffer(16)
         {
             if (!stream.CanRead())
             {
@@ -38,37 +38,34 @@ namespace System { namespace IO {
         }
 
         System::Failable<void> BinaryReader::FillBuffer(int numBytes) {
-            if ((numBytes < 0 || numBytes > static_cast<int>(_buffer.size())))
+            if ((numBytes < 0 || numBytes > static_cast<int>(sizeof(_buffer))))
             {
                 GS_THROW(ArgumentOutOfRangeException("ArgumentOutOfRangeException"));
             }
 
-            int bytesRead = 0;
-
-            // Need to find a good threshold for calling ReadByte() repeatedly
-            // vs. calling Read(byte[], int, int) for both buffered & unbuffered
-            // streams.
-            if (numBytes == 1)
+            int available = 0;
+            if (const unsigned char* span = stream.ReadSpan(available))
             {
-                GS_ASSIGN_OR_THROW(n, stream.ReadByte());
-                if (n == -1)
+                if (available < numBytes)
                 {
                     GS_THROW(EndOfStreamException("EndOfStreamException"));
                 }
-
-                _buffer[0] = (unsigned char)n;
+                memcpy(_buffer, span, numBytes);
+                stream.Advance(numBytes);
                 return {};
             }
 
-            do
+            // the buffer is a plain array, so that constructing a reader does not allocate; numBytes is at most 8.
+            for (int i = 0; i < numBytes; ++i)
             {
-                GS_ASSIGN_OR_THROW(n, stream.Read(_buffer, bytesRead, numBytes - bytesRead));
-                if (n == 0)
+                GS_ASSIGN_OR_THROW(n, stream.ReadByte());
+                if (n == -1)
                 {
                     GS_THROW(EndOfStreamException("EndOfStreamException"));
                 }
-                bytesRead += n;
-            } while (bytesRead < numBytes);
+
+                _buffer[i] = (unsigned char)n;
+            }
 
             return {};
         }
@@ -12,8 +12,10 @@ namespace System { namespace IO {
 			Failable<void> Write(float);
 			Failable<void> Write(double);
 		private:
+			Failable<void> WriteBuffer(int numBytes);
+
 			Stream& stream;
-			Bytes _buffer;
+			unsigned char _buffer[16];
 	};
 
 }} /* namespace System.IO */
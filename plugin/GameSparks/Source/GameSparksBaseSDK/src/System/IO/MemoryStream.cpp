@@ -260,6 +260,73 @@ namespace System { namespace IO {
             return {};
         }
 
+        const unsigned char* MemoryStream::ReadSpan(int& available) {
+            assert(_isOpen);
+            if (_position >= _length)
+            {
+                available = 0;
+                return _buffer.data() + _length;
+            }
+            available = _length - _position;
+            return _buffer.data() + _position;
+        }
+
+        void MemoryStream::Advance(int count) {
+            assert(count >= 0 && count <= _length - _position);
+            _position += count;
+        }
+
+        unsigned char* MemoryStream::WriteSpan(int size) {
+            assert(_isOpen);
+            if (!_writable || size < 0 || _position > MemStreamMaxLength - size)
+            {
+                return nullptr;
+            }
+            if (_position + size > _capacity)
+            {
+                auto allocatedNewArray = EnsureCapacity(_position + size);
+                if (!allocatedNewArray.isOK())
+                {
+                    return nullptr;
+                }
+            }
+            return _buffer.data() + _position;
+        }
+
+        void MemoryStream::Commit(int count) {
+            assert(count >= 0 && _position + count <= _capacity);
+            if (_position > _length)
+            {
+                gsstl::fill(_buffer.begin() + _length, _buffer.begin() + _position, 0);
+            }
+            _position += count;
+            if (_position > _length)
+            {
+                _length = _position;
+            }
+        }
+
+        Failable<void> MemoryStream::SetLength(int value) {
+            if (value < 0 || value > MemStreamMaxLength - _origin)
+            {
+                GS_THROW(ArgumentOutOfRangeException("ArgumentOutOfRangeException: value (StreamLength)"));
+            }
+            EnsureWriteable();
+
+            int newLength = _origin + value;
+            GS_ASSIGN_OR_THROW(allocatedNewArray, EnsureCapacity(newLength));
+            if (!allocatedNewArray && newLength > _length)
+            {
+                gsstl::fill(_buffer.begin() + _length, _buffer.begin() + newLength, 0);
+            }
+            _length = newLength;
+            if (_position > newLength)
+            {
+                _position = newLength;
+            }
+            return {};
+        }
+
         void MemoryStream::EnsureWriteable() {
             if (!CanWrite())
             {
@@ -36,6 +36,12 @@ namespace System { namespace IO {
             virtual Failable<int64_t> Seek(int64_t offset, IO::SeekOrigin origin) override;
             virtual int Position() const override;
             virtual Failable<void> Position(const int pos) override;
+            virtual const unsigned char* ReadSpan(int& available) override;
+            virtual void Advance(int count) override;
+            virtual unsigned char* WriteSpan(int size) override;
+            virtual void Commit(int count) override;
+            /// truncates or extends the stream, the buffer is kept. SetLength(0) empties the stream for reuse.
+            Failable<void> SetLength(int value);
 
             const Bytes& GetBuffer() const;
 
@@ -6,6 +6,7 @@ namespace System { namespace Net { namespace Sockets {
 
 NetworkStream::NetworkStream(Socket& socket_)
 :socket(socket_)
+,oneByte(1)
 {
 
 }
@@ -26,4 +27,13 @@ Failable<int> NetworkStream::Read(System::Bytes &buffer, int offset, int count)
     return socket.Receive(buffer,offset,count);
 }
 
+Failable<int> NetworkStream::ReadByte() {
+    GS_ASSIGN_OR_THROW(r, socket.Receive(oneByte, 0, 1));
+    if (r == 0)
+    {
+        return -1;
+    }
+    return oneByte[0];
+}
+
 }}}
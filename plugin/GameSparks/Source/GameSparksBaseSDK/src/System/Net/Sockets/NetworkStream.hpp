@@ -16,12 +16,16 @@ namespace System { namespace Net { namespace Sockets {
 
             virtual Failable<int> Read(System::Bytes &buffer, int offset, int count) override;
 
+            /// reads into oneByte, as the packets of the reliable connection are parsed byte by byte
+            virtual Failable<int> ReadByte() override;
+
             virtual bool CanRead() const override;
 
             virtual bool CanWrite() const override;
 
         private:
                 Socket& socket;
+                System::Bytes oneByte;
     };
 
 }}}
@@ -0,0 +1,490 @@
+#include "LoopbackServer.hpp"
+
+#include <mbedtls/certs.h>
+#include <mbedtls/ctr_drbg.h>
+#include <mbedtls/entropy.h>
+#include <mbedtls/net.h>
+#include <mbedtls/pk.h>
+#include <mbedtls/ssl.h>
+#include <mbedtls/ssl_cache.h>
+#include <mbedtls/x509_crt.h>
+
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+using namespace GameSparks::RT;
+
+namespace GameSparks { namespace Tests {
+
+	namespace {
+
+		bool ReadVarint(const unsigned char*& pos, const unsigned char* end, uint64_t& value)
+		{
+			value = 0;
+			for (int shift = 0; pos != end && shift < 64; shift += 7)
+			{
+				const unsigned char byte = *pos++;
+				value |= uint64_t(byte & 0x7f) << shift;
+				if ((byte & 0x80) == 0)
+				{
+					return true;
+				}
+			}
+			return false;
+		}
+
+		thread_local bool serverThread = false;
+
+		void WriteVarint(std::vector<unsigned char>& out, uint64_t value)
+		{
+			while (value >= 0x80)
+			{
+				out.push_back((unsigned char)(value | 0x80));
+				value >>= 7;
+			}
+			out.push_back((unsigned char)value);
+		}
+
+	}
+
+	/// the server side configuration, shared by the connections
+	struct LoopbackServer::Tls
+	{
+		mbedtls_entropy_context entropy;
+		mbedtls_ctr_drbg_context drbg;
+		mbedtls_x509_crt certificate;
+		mbedtls_pk_context key;
+		mbedtls_ssl_cache_context cache;
+		mbedtls_ssl_config conf;
+
+		Tls()
+		{
+			mbedtls_entropy_init(&entropy);
+			mbedtls_ctr_drbg_init(&drbg);
+			mbedtls_x509_crt_init(&certificate);
+			mbedtls_pk_init(&key);
+			mbedtls_ssl_cache_init(&cache);
+			mbedtls_ssl_config_init(&conf);
+
+			mbedtls_ctr_drbg_seed(&drbg, mbedtls_entropy_func, &entropy, nullptr, 0);
+			mbedtls_x509_crt_parse(&certificate, reinterpret_cast<const unsigned char*>(mbedtls_test_srv_crt), mbedtls_test_srv_crt_len);
+			mbedtls_pk_parse_key(&key, reinterpret_cast<const unsigned char*>(mbedtls_test_srv_key), mbedtls_test_srv_key_len, nullptr, 0);
+
+			mbedtls_ssl_config_defaults(&conf, MBEDTLS_SSL_IS_SERVER, MBEDTLS_SSL_TRANSPORT_STREAM, MBEDTLS_SSL_PRESET_DEFAULT);
+			mbedtls_ssl_conf_rng(&conf, mbedtls_ctr_drbg_random, &drbg);
+			mbedtls_ssl_conf_own_cert(&conf, &certificate, &key);
+			// lets reconnects resume their session, like the real server does
+			mbedtls_ssl_conf_session_cache(&conf, &cache, mbedtls_ssl_cache_get, mbedtls_ssl_cache_set);
+		}
+
+		~Tls()
+		{
+			mbedtls_ssl_config_free(&conf);
+			mbedtls_ssl_cache_free(&cache);
+			mbedtls_pk_free(&key);
+			mbedtls_x509_crt_free(&certificate);
+			mbedtls_ctr_drbg_free(&drbg);
+			mbedtls_entropy_free(&entropy);
+		}
+	};
+
+	struct LoopbackServer::Peer
+	{
+		mbedtls_net_context net;
+		mbedtls_ssl_context ssl;
+		bool connected = false;
+		std::vector<unsigned char> received; // not yet complete packets of the reliable channel
+		bool hasFast = false;
+		sockaddr_in fast;
+
+		Peer()
+		{
+			mbedtls_net_init(&net);
+			mbedtls_ssl_init(&ssl);
+		}
+
+		~Peer()
+		{
+			mbedtls_ssl_free(&ssl);
+			mbedtls_net_free(&net);
+		}
+
+		void Write(const unsigned char* data, size_t size)
+		{
+			while (connected && size > 0)
+			{
+				const int written = mbedtls_ssl_write(&ssl, data, size);
+				if (written == MBEDTLS_ERR_SSL_WANT_READ || written == MBEDTLS_ERR_SSL_WANT_WRITE)
+				{
+					continue;
+				}
+				if (written <= 0)
+				{
+					connected = false;
+					return;
+				}
+				data += written;
+				size -= size_t(written);
+			}
+		}
+	};
+
+	LoopbackServer::LoopbackServer()
+	:tls(new Tls())
+	{
+		// the sessions connect both channels to the same port, so the UDP socket has to get the port of the TCP one
+		for (;;)
+		{
+			tcp = socket(AF_INET, SOCK_STREAM, 0);
+			sockaddr_in address = {};
+			address.sin_family = AF_INET;
+			address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+			bind(tcp, reinterpret_cast<sockaddr*>(&address), sizeof(address));
+			socklen_t length = sizeof(address);
+			getsockname(tcp, reinterpret_cast<sockaddr*>(&address), &length);
+			listen(tcp, 8);
+
+			udp = socket(AF_INET, SOCK_DGRAM, 0);
+			if (bind(udp, reinterpret_cast<sockaddr*>(&address), sizeof(address)) == 0)
+			{
+				port = ntohs(address.sin_port);
+				break;
+			}
+			close(udp);
+			close(tcp);
+		}
+
+		thread = std::thread([this]() { Run(); });
+	}
+
+	LoopbackServer::~LoopbackServer()
+	{
+		stopped = true;
+		thread.join();
+		for (auto& peer : peers)
+		{
+			if (peer->connected)
+			{
+				mbedtls_ssl_close_notify(&peer->ssl);
+			}
+		}
+		peers.clear();
+		close(udp);
+		close(tcp);
+	}
+
+	void LoopbackServer::SetDropFilter(const std::function<bool(const RelayedPacket&)>& filter)
+	{
+		std::lock_guard<std::mutex> lock(filterMutex);
+		dropFilter = filter;
+	}
+
+	RTSessionImpl* LoopbackServer::Connect(GameSparksRTSessionBuilder& builder, IRTSessionListener& listener)
+	{
+		RTSessionImpl* session = static_cast<RTSessionImpl*>(builder
+			.SetHost("127.0.0.1")
+			.SetPort(port)
+			.SetListener(&listener)
+			.Build());
+
+		const int reliable = reliablePeers;
+		session->ConnectReliable();
+		while (reliablePeers == reliable)
+		{
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		}
+
+		const int fast = fastPeers;
+		session->ConnectFast();
+		while (fastPeers == fast)
+		{
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		}
+		session->SetConnectState(GameSparksRT::ConnectState::ReliableAndFast);
+		return session;
+	}
+
+	bool LoopbackServer::OnServerThread()
+	{
+		return serverThread;
+	}
+
+	void LoopbackServer::Run()
+	{
+		serverThread = true;
+		while (!stopped)
+		{
+			std::vector<pollfd> fds;
+			fds.push_back({tcp, POLLIN, 0});
+			fds.push_back({udp, POLLIN, 0});
+			for (auto& peer : peers)
+			{
+				fds.push_back({peer->connected ? peer->net.fd : -1, POLLIN, 0});
+			}
+
+			if (poll(fds.data(), fds.size(), 10) <= 0)
+			{
+				continue;
+			}
+			if (fds[0].revents & POLLIN)
+			{
+				Accept();
+			}
+			if (fds[1].revents & POLLIN)
+			{
+				ReadFast();
+			}
+			for (size_t i = 2; i < fds.size(); ++i)
+			{
+				if (fds[i].revents & (POLLIN | POLLHUP | POLLERR))
+				{
+					ReadReliable(*peers[i - 2]);
+				}
+			}
+		}
+	}
+
+	void LoopbackServer::Accept()
+	{
+		std::unique_ptr<Peer> peer(new Peer());
+		peer->net.fd = accept(tcp, nullptr, nullptr);
+		if (peer->net.fd < 0)
+		{
+			return;
+		}
+		const int noDelay = 1;
+		setsockopt(peer->net.fd, IPPROTO_TCP, TCP_NODELAY, &noDelay, sizeof(noDelay));
+
+		// the handshake blocks the server, the peers connect one after another anyway
+		mbedtls_ssl_setup(&peer->ssl, &tls->conf);
+		mbedtls_ssl_set_bio(&peer->ssl, &peer->net, mbedtls_net_send, mbedtls_net_recv, nullptr);
+		int result;
+		do result = mbedtls_ssl_handshake(&peer->ssl);
+		while (result == MBEDTLS_ERR_SSL_WANT_READ || result == MBEDTLS_ERR_SSL_WANT_WRITE);
+		if (result != 0)
+		{
+			return;
+		}
+
+		mbedtls_net_set_nonblock(&peer->net);
+		peer->connected = true;
+		peers.push_back(std::move(peer));
+	}
+
+	void LoopbackServer::ReadReliable(Peer& peer)
+	{
+		int id = 0;
+		for (size_t i = 0; i != peers.size(); ++i)
+		{
+			if (peers[i].get() == &peer)
+			{
+				id = int(i) + 1;
+			}
+		}
+
+		unsigned char buffer[4096];
+		for (;;)
+		{
+			const int read = mbedtls_ssl_read(&peer.ssl, buffer, sizeof(buffer));
+			if (read == MBEDTLS_ERR_SSL_WANT_READ || read == MBEDTLS_ERR_SSL_WANT_WRITE)
+			{
+				break;
+			}
+			if (read <= 0)
+			{
+				peer.connected = false;
+				return;
+			}
+			peer.received.insert(peer.received.end(), buffer, buffer + read);
+			if (mbedtls_ssl_get_bytes_avail(&peer.ssl) == 0 && read < int(sizeof(buffer)))
+			{
+				break;
+			}
+		}
+
+		std::vector<std::vector<unsigned char> > streams(peers.size());
+		const unsigned char* pos = peer.received.data();
+		const unsigned char* end = pos + peer.received.size();
+		for (;;)
+		{
+			const unsigned char* packet = pos;
+			uint64_t size;
+			if (!ReadVarint(packet, end, size) || uint64_t(end - packet) < size)
+			{
+				break;
+			}
+
+			if (reliablePeers < id)
+			{
+				// the login of the peer
+				reliablePeers = id;
+			}
+			else
+			{
+				Forward(id, true, packet, int(size), streams);
+			}
+			pos = packet + size;
+		}
+		peer.received.erase(peer.received.begin(), peer.received.begin() + (pos - peer.received.data()));
+
+		for (size_t i = 0; i != streams.size(); ++i)
+		{
+			if (!streams[i].empty())
+			{
+				peers[i]->Write(streams[i].data(), streams[i].size());
+			}
+		}
+	}
+
+	void LoopbackServer::ReadFast()
+	{
+		unsigned char datagram[65536];
+		sockaddr_in from = {};
+		socklen_t length = sizeof(from);
+		const ssize_t read = recvfrom(udp, datagram, sizeof(datagram), 0, reinterpret_cast<sockaddr*>(&from), &length);
+		if (read <= 0)
+		{
+			return;
+		}
+
+		int id = 0;
+		for (size_t i = 0; i != peers.size(); ++i)
+		{
+			if (peers[i]->hasFast && peers[i]->fast.sin_port == from.sin_port)
+			{
+				id = int(i) + 1;
+			}
+		}
+		if (id == 0)
+		{
+			// the login of the next peer that has no fast channel yet
+			for (size_t i = 0; i != peers.size(); ++i)
+			{
+				if (!peers[i]->hasFast)
+				{
+					peers[i]->hasFast = true;
+					peers[i]->fast = from;
+					fastPeers = int(i) + 1;
+					break;
+				}
+			}
+			return;
+		}
+
+		// the packets of one datagram go to the targets in one datagram each, as the real server does
+		std::vector<std::vector<unsigned char> > datagrams(peers.size());
+		const unsigned char* pos = datagram;
+		const unsigned char* end = datagram + read;
+		while (pos != end)
+		{
+			uint64_t size;
+			if (!ReadVarint(pos, end, size) || uint64_t(end - pos) < size)
+			{
+				break;
+			}
+			Forward(id, false, pos, int(size), datagrams);
+			pos += size;
+		}
+
+		for (size_t i = 0; i != datagrams.size(); ++i)
+		{
+			if (!datagrams[i].empty() && peers[i]->hasFast)
+			{
+				sendto(udp, datagrams[i].data(), datagrams[i].size(), 0, reinterpret_cast<const sockaddr*>(&peers[i]->fast), sizeof(peers[i]->fast));
+				++forwardedDatagrams;
+			}
+		}
+	}
+
+	void LoopbackServer::Forward(int sender, bool reliable, const unsigned char* packet, int size, std::vector<std::vector<unsigned char> >& out)
+	{
+		// the fields in front of the data are varints: opCode (1), sequence number (2), request id (3), target players (4)
+		const unsigned char* pos = packet;
+		const unsigned char* end = packet + size;
+		const unsigned char* afterOpCode = nullptr;
+		int opCode = 0;
+		std::vector<int> targets;
+		System::Bytes payload;
+		while (pos != end)
+		{
+			uint64_t key, value;
+			if (!ReadVarint(pos, end, key))
+			{
+				return;
+			}
+			if ((key & 7) == 2)
+			{
+				if (!ReadVarint(pos, end, value) || uint64_t(end - pos) < value)
+				{
+					return;
+				}
+				if (key >> 3 == 15)
+				{
+					payload.assign(pos, pos + value);
+				}
+				pos += value;
+				continue;
+			}
+			if (!ReadVarint(pos, end, value))
+			{
+				return;
+			}
+			switch (key >> 3)
+			{
+				case 1:
+					opCode = int(uint32_t(value) >> 1) ^ -int(value & 1);
+					afterOpCode = pos;
+					break;
+				case 4:
+					targets.push_back(int(value));
+					break;
+			}
+		}
+		if (opCode <= 0 || afterOpCode == nullptr)
+		{
+			return;
+		}
+
+		// the sender follows the opCode, the receiving side reads it before the payload
+		std::vector<unsigned char> sent;
+		sent.insert(sent.end(), packet, afterOpCode);
+		sent.push_back(5 << 3);
+		WriteVarint(sent, uint64_t(sender));
+		sent.insert(sent.end(), afterOpCode, end);
+
+		std::function<bool(const RelayedPacket&)> filter;
+		{
+			std::lock_guard<std::mutex> lock(filterMutex);
+			filter = dropFilter;
+		}
+
+		for (int target = 1; target <= int(peers.size()); ++target)
+		{
+			const bool targeted = targets.empty() ? target != sender : std::find(targets.begin(), targets.end(), target) != targets.end();
+			if (!targeted)
+			{
+				continue;
+			}
+			if (filter && filter(RelayedPacket {sender, target, reliable, opCode, payload}))
+			{
+				++droppedPackets;
+				continue;
+			}
+
+			std::vector<unsigned char>& stream = out[target - 1];
+			WriteVarint(stream, sent.size());
+			stream.insert(stream.end(), sent.begin(), sent.end());
+			++forwardedPackets;
+		}
+	}
+
+}} /* namespace GameSparks.Tests */
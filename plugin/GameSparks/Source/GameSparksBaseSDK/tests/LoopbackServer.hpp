@@ -0,0 +1,88 @@
+#ifndef _GAMESPARKS_TESTS_LOOPBACKSERVER_HPP_
+#define _GAMESPARKS_TESTS_LOOPBACKSERVER_HPP_
+
+#include <GameSparksRT/RTSessionImpl.hpp>
+#include <GameSparksRT/IRTSessionListener.hpp>
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace GameSparks { namespace Tests {
+
+	/// a packet on its way through LoopbackServer, to one of the peers it is forwarded to
+	struct RelayedPacket
+	{
+		int sender;
+		int target;
+		bool reliable; // over the TLS connection, otherwise as a datagram
+		int opCode;
+		System::Bytes payload;
+	};
+
+	/*!
+		Stands in for the RT server on both channels of up to eight peers, on 127.0.0.1 and the same port for TCP and UDP.
+
+		The reliable channel is TLS like the real one, with the test certificate of mbedtls. Peers get their ids in the order
+		they connect reliably, the first datagram of a peer registers its fast channel. Packets with an opCode above zero are
+		forwarded to their target players, or to all other peers, on the channel they arrived on, with the sender set.
+		Everything else, e.g. the logins, is swallowed, so the tests set the connect state of the sessions themselves.
+	*/
+	class LoopbackServer
+	{
+		public:
+			LoopbackServer();
+			~LoopbackServer();
+
+			int Port() const { return port; }
+			int ReliablePeers() const { return reliablePeers; }
+			int FastPeers() const { return fastPeers; }
+
+			/// called by the thread of the server for each packet before it is forwarded, returns true to drop it
+			void SetDropFilter(const std::function<bool(const RelayedPacket&)>& filter);
+
+			long long ForwardedPackets() const { return forwardedPackets; }
+			long long ForwardedDatagrams() const { return forwardedDatagrams; }
+			long long DroppedPackets() const { return droppedPackets; }
+
+			/// true on the thread of any LoopbackServer, e.g. to leave the allocations of the server out of a count
+			static bool OnServerThread();
+
+			/// a session with a reliable and a fast connection to this server. blocks until both are registered.
+			RT::RTSessionImpl* Connect(RT::GameSparksRTSessionBuilder& builder, RT::IRTSessionListener& listener);
+
+		private:
+			struct Peer;
+
+			void Run();
+			void Accept();
+			void ReadReliable(Peer& peer);
+			void ReadFast();
+			void Forward(int sender, bool reliable, const unsigned char* packet, int size, std::vector<std::vector<unsigned char> >& datagrams);
+
+			int tcp;
+			int udp;
+			int port;
+			std::thread thread;
+			std::atomic<bool> stopped {false};
+
+			struct Tls;
+			std::unique_ptr<Tls> tls;
+			std::vector<std::unique_ptr<Peer> > peers; // by peer id - 1, only touched by the thread of the server
+
+			std::mutex filterMutex;
+			std::function<bool(const RelayedPacket&)> dropFilter; // guarded by filterMutex
+
+			std::atomic<int> reliablePeers {0};
+			std::atomic<int> fastPeers {0};
+			std::atomic<long long> forwardedPackets {0};
+			std::atomic<long long> forwardedDatagrams {0};
+			std::atomic<long long> droppedPackets {0};
+	};
+
+}} /* namespace GameSparks.Tests */
+
+#endif /* _GAMESPARKS_TESTS_LOOPBACKSERVER_HPP_ */
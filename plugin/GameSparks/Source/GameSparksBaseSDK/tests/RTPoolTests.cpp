@@ -0,0 +1,197 @@
+#include "Tests.hpp"
+#include "LoopbackServer.hpp"
+
+#include <GameSparksRT/RTSessionImpl.hpp>
+#include <GameSparksRT/IRTSessionListener.hpp>
+#include <GameSparksRT/Commands/Requests/CustomRequest.hpp>
+#include <GameSparksRT/Proto/Packet.hpp>
+#include <GameSparksRT/Proto/ReusableBinaryWriter.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <new>
+#include <thread>
+
+// counts the heap allocations of the whole process while counting is set, except those of LoopbackServer. replacing the
+// global operator new is the only way to see allocations made by the standard library, e.g. when a vector grows.
+static std::atomic<bool> counting(false);
+static std::atomic<long long> allocations(0);
+
+void* operator new(std::size_t size)
+{
+	if (counting && !GameSparks::Tests::LoopbackServer::OnServerThread())
+	{
+		++allocations;
+	}
+	if (void* p = std::malloc(size ? size : 1))
+	{
+		return p;
+	}
+	throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept
+{
+	std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept
+{
+	std::free(p);
+}
+
+using namespace GameSparks::RT;
+
+namespace {
+
+	class Listener : public IRTSessionListener
+	{
+		public:
+			long long bytes = 0;
+			std::atomic<long long> packets {0};
+
+			virtual void OnPlayerConnect(int) override {}
+			virtual void OnPlayerDisconnect(int) override {}
+			virtual void OnReady(bool) override {}
+			virtual void OnPacket(const RTPacket& packet) override
+			{
+				bytes += packet.Payload.size();
+				++packets;
+			}
+	};
+
+	/// a packet of payload on its way from one session to another: serialized as FastConnection::Queue() does,
+	/// read back as FastConnection::ReadBuffer() does and submitted to session
+	void Transfer(RTSessionImpl& session, const System::Bytes& payload, BinaryWriteMemoryStream& wire)
+	{
+		CustomRequest request(5, GameSparksRT::DeliveryIntent::UNRELIABLE_SEQUENCED, payload, RTData(), gsstl::vector<int>());
+		Proto::Packet sent = request.ToPacket(session, true);
+		sent.Sender = 2;
+		wire.SetLength(0);
+		Proto::Packet::SerializeLengthDelimited(wire, sent);
+
+		wire.Position(0);
+		Proto::Packet received(session);
+		Proto::Packet::DeserializeLengthDelimited(wire, wire.BinaryReader, received);
+		session.SubmitAction(received.Command, received.SequenceNumber.HasValue());
+	}
+
+}
+
+GS_TEST(RTPoolSteadyStateDoesNotAllocate)
+{
+	Listener listener;
+	gsstl::unique_ptr<RTSessionImpl> session(static_cast<RTSessionImpl*>(GameSparksRTSessionBuilder()
+		.SetListener(&listener)
+		.Build()));
+
+	System::Bytes payload(40, 7);
+	BinaryWriteMemoryStream wire;
+
+	// fills the pools. messages are delivered every third packet, so a few are queued at a time.
+	for (int i = 0; i != 1000; ++i)
+	{
+		Transfer(*session, payload, wire);
+		if (i % 3 == 0) session->Update();
+	}
+	session->Update();
+	const long long poolAllocations = session->GetPoolAllocations();
+
+	allocations = 0;
+	counting = true;
+	for (int i = 0; i != 1000; ++i)
+	{
+		Transfer(*session, payload, wire);
+		if (i % 3 == 0) session->Update();
+	}
+	session->Update();
+	counting = false;
+
+	std::printf("heap allocations in 1000 steady state messages: %lld, pool allocations %lld after warm up, %lld after\n",
+		allocations.load(), poolAllocations, session->GetPoolAllocations());
+	GS_TEST_CHECK(listener.bytes == 2000 * 40);
+	GS_TEST_CHECK(allocations == 0);
+	GS_TEST_CHECK(session->GetPoolAllocations() == poolAllocations);
+
+	// a larger message grows the payload buffer of a pooled command, which GetPoolAllocations() reports
+	System::Bytes larger(400, 7);
+	Transfer(*session, larger, wire);
+	session->Update();
+	GS_TEST_CHECK(session->GetPoolAllocations() > poolAllocations);
+	return true;
+}
+
+namespace {
+
+	const int CompressionOpCode = 30;
+	const int DeltaOpCode = 31;
+
+	/// one message each of plain, compressed and delta encoded data, sent unreliably as a game sends them every tick.
+	/// updates the receiver until it delivered all three.
+	bool Tick(RTSessionImpl& sender, RTSessionImpl& receiver, Listener& listener, int tick, const System::Bytes& payload)
+	{
+		RTData state;
+		state.SetInt(1, 7);
+		state.SetRTVector(2, RTVector(float(tick), 1.0f, 0.0f));
+		state.SetString(3, "player_7");
+
+		const long long expected = listener.packets + 3;
+		sender.SendRTDataAndBytes(5, GameSparksRT::DeliveryIntent::UNRELIABLE, payload, state, {});
+		sender.SendCompressed(6, GameSparksRT::DeliveryIntent::UNRELIABLE, payload, state, {});
+		sender.SendDelta(7, GameSparksRT::DeliveryIntent::UNRELIABLE, state, {});
+		sender.Update();
+
+		for (int wait = 0; wait != 2000; ++wait)
+		{
+			receiver.Update();
+			if (listener.packets >= expected)
+			{
+				return true;
+			}
+			std::this_thread::sleep_for(std::chrono::microseconds(500));
+		}
+		return false;
+	}
+
+}
+
+GS_TEST(RTPoolSessionsOverLoopbackDoNotAllocate)
+{
+	// SendRTDataAndBytes() and friends through FastConnection::Queue() and Flush(), the loopback server and the receive
+	// buffer of the other session's FastConnection, and the keyframes of the delta encoding over TLS
+	GameSparks::Tests::LoopbackServer server;
+	Listener ignored, listener;
+	GameSparksRTSessionBuilder senderBuilder, receiverBuilder;
+	gsstl::unique_ptr<RTSessionImpl> sender(server.Connect(senderBuilder.EnableCompression(CompressionOpCode).EnableDeltaEncoding(DeltaOpCode, 10), ignored));
+	gsstl::unique_ptr<RTSessionImpl> receiver(server.Connect(receiverBuilder.EnableCompression(CompressionOpCode).EnableDeltaEncoding(DeltaOpCode, 10), listener));
+
+	System::Bytes payload(200);
+	for (size_t i = 0; i != payload.size(); ++i)
+	{
+		payload[i] = System::Byte(i % 8);
+	}
+
+	for (int tick = 0; tick != 200; ++tick)
+	{
+		GS_TEST_CHECK(Tick(*sender, *receiver, listener, tick, payload));
+	}
+	const long long poolAllocations = receiver->GetPoolAllocations();
+
+	allocations = 0;
+	counting = true;
+	bool delivered = true;
+	for (int tick = 200; tick != 500 && delivered; ++tick)
+	{
+		delivered = Tick(*sender, *receiver, listener, tick, payload);
+	}
+	counting = false;
+
+	std::printf("heap allocations in 300 steady state ticks over loopback: %lld, pool allocations %lld after warm up, %lld after\n",
+		allocations.load(), poolAllocations, receiver->GetPoolAllocations());
+	GS_TEST_CHECK(delivered);
+	GS_TEST_CHECK(listener.packets == 1500);
+	GS_TEST_CHECK(allocations == 0);
+	GS_TEST_CHECK(receiver->GetPoolAllocations() == poolAllocations);
+	return true;
+}
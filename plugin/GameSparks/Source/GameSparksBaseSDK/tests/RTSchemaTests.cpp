@@ -0,0 +1,144 @@
+#include "Tests.hpp"
+
+#include <GameSparksRT/RTSchema.hpp>
+#include <GameSparksRT/RTData.hpp>
+#include <GameSparksRT/Proto/RTData.Serializer.hpp>
+#include <GameSparksRT/Proto/ReusableBinaryWriter.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <random>
+
+using namespace GameSparks::RT;
+
+namespace {
+
+	struct Vec3 { float x, y, z; };
+	struct Quat { float x, y, z, w; };
+	struct Entity { uint32_t id; Vec3 position; Quat rotation; int16_t health; bool firing; };
+
+	typedef RTSchema<Entity,
+		Schema::VarInt<GS_RT_SCHEMA_MEMBER(Entity, id)>,
+		Schema::QuantizedVector3<GS_RT_SCHEMA_MEMBER(Entity, position), -1024, 1024, 100>,
+		Schema::SmallestThree<GS_RT_SCHEMA_MEMBER(Entity, rotation), 10>,
+		Schema::Range<GS_RT_SCHEMA_MEMBER(Entity, health), 0, 1000>,
+		Schema::Bool<GS_RT_SCHEMA_MEMBER(Entity, firing)>
+	> EntitySchema;
+
+	gsstl::vector<Entity> RandomEntities(int count)
+	{
+		std::mt19937 rng(5);
+		std::uniform_real_distribution<float> position(-1000.0f, 1000.0f), component(-1.0f, 1.0f);
+		gsstl::vector<Entity> entities(count);
+		for (int i = 0; i != count; ++i)
+		{
+			Entity& e = entities[i];
+			e.id = uint32_t(i);
+			e.position.x = position(rng);
+			e.position.y = position(rng);
+			e.position.z = position(rng);
+			Quat q = {component(rng), component(rng), component(rng), component(rng)};
+			const float length = std::sqrt(q.x * q.x + q.y * q.y + q.z * q.z + q.w * q.w);
+			e.rotation.x = q.x / length;
+			e.rotation.y = q.y / length;
+			e.rotation.z = q.z / length;
+			e.rotation.w = q.w / length;
+			e.health = int16_t(rng() % 1001);
+			e.firing = rng() % 2 == 0;
+		}
+		return entities;
+	}
+
+	/// the size of the entity sent as RTData, the way it is done without a schema
+	int RTDataSize(const Entity& e)
+	{
+		RTData data;
+		data.SetInt(1, e.id);
+		data.SetRTVector(2, RTVector(e.position.x, e.position.y, e.position.z));
+		data.SetRTVector(3, RTVector(e.rotation.x, e.rotation.y, e.rotation.z, e.rotation.w));
+		data.SetInt(4, e.health);
+		data.SetInt(5, e.firing ? 1 : 0);
+
+		BinaryWriteMemoryStream stream;
+		Proto::RTDataSerializer::WriteRTData(stream, data);
+		return stream.Position();
+	}
+
+}
+
+GS_TEST(RTSchemaBenchmark)
+{
+	const int count = 64, rounds = 2000;
+	const gsstl::vector<Entity> entities = RandomEntities(count);
+
+	System::Bytes snapshot;
+	const auto start = std::chrono::steady_clock::now();
+	for (int round = 0; round != rounds; ++round)
+	{
+		snapshot.clear();
+		RTBitWriter writer(snapshot);
+		writer.WriteVarInt(entities.size());
+		for (int i = 0; i != count; ++i)
+		{
+			EntitySchema::Encode(entities[i], writer);
+		}
+		writer.Flush();
+	}
+	const auto encodeEnd = std::chrono::steady_clock::now();
+
+	gsstl::vector<Entity> decoded(count);
+	bool complete = true;
+	for (int round = 0; round != rounds; ++round)
+	{
+		RTBitReader reader(snapshot.data(), int(snapshot.size()));
+		const uint64_t n = reader.ReadVarInt();
+		for (uint64_t i = 0; i < n && i < uint64_t(count); ++i)
+		{
+			complete = EntitySchema::Decode(reader, decoded[size_t(i)]) && complete;
+		}
+	}
+	const auto decodeEnd = std::chrono::steady_clock::now();
+
+	int rtDataBytes = 0;
+	double positionError = 0, rotationError = 0;
+	bool exact = true;
+	for (int i = 0; i != count; ++i)
+	{
+		const Entity& a = entities[i];
+		const Entity& b = decoded[i];
+		rtDataBytes += RTDataSize(a);
+		positionError = std::max(positionError, double(std::fabs(a.position.x - b.position.x)));
+		positionError = std::max(positionError, double(std::fabs(a.position.y - b.position.y)));
+		positionError = std::max(positionError, double(std::fabs(a.position.z - b.position.z)));
+		const float dot = a.rotation.x * b.rotation.x + a.rotation.y * b.rotation.y + a.rotation.z * b.rotation.z + a.rotation.w * b.rotation.w;
+		rotationError = std::max(rotationError, 2.0 * std::acos(std::min(1.0, double(std::fabs(dot)))) * 180.0 / 3.14159265358979);
+		exact = exact && a.id == b.id && a.health == b.health && a.firing == b.firing;
+	}
+
+	const double entitiesCoded = double(rounds) * count;
+	std::printf("schema: %.2f bytes/entity (RTData: %.2f), encode %.1f ns/entity, decode %.1f ns/entity\n",
+		double(snapshot.size()) / count, double(rtDataBytes) / count,
+		std::chrono::duration<double, std::nano>(encodeEnd - start).count() / entitiesCoded,
+		std::chrono::duration<double, std::nano>(decodeEnd - encodeEnd).count() / entitiesCoded);
+	std::printf("max position error %.4f, max rotation error %.3f degrees\n", positionError, rotationError);
+
+	GS_TEST_CHECK(complete);
+	GS_TEST_CHECK(exact);
+	GS_TEST_CHECK(positionError <= 0.0051); // half a step of 1 cm
+	GS_TEST_CHECK(rotationError < 1.0);
+	GS_TEST_CHECK(snapshot.size() * 2 < size_t(rtDataBytes));
+	return true;
+}
+
+GS_TEST(RTSchemaRejectsTruncatedInput)
+{
+	System::Bytes encoded;
+	EntitySchema::Encode(RandomEntities(1)[0], encoded);
+
+	for (size_t size = 0; size != encoded.size(); ++size)
+	{
+		Entity e;
+		GS_TEST_CHECK(!EntitySchema::Decode(System::ArraySegment<System::Byte>(encoded, 0, int(size)), e));
+	}
+	return true;
+}
@@ -0,0 +1,49 @@
+#ifndef _GAMESPARKS_TESTS_TESTPLATFORM_HPP_
+#define _GAMESPARKS_TESTS_TESTPLATFORM_HPP_
+
+#include <GameSparks/GS.h>
+#include <GameSparks/IGSPlatform.h>
+
+#include <chrono>
+#include <map>
+#include <string>
+#include <thread>
+
+namespace GameSparks { namespace Tests {
+
+	/// the platform of the tests that run GS against a WebSocketServerStub. keeps the stored values in memory instead of
+	/// files in the working directory and swallows the log.
+	class TestPlatform : public Core::IGSPlatform
+	{
+		public:
+			TestPlatform() : IGSPlatform("exampleKey12", "exampleSecret1234567890123456789", true) {}
+
+			virtual gsstl::string GetSDK() const override { return "GameSparksRTTests"; }
+			virtual gsstl::string GetDeviceType() const override { return "Desktop"; }
+			virtual void DebugMsg(const gsstl::string&) const override {}
+
+			virtual void StoreValue(const gsstl::string& key, const gsstl::string& value) const override { values[key] = value; }
+			virtual gsstl::string LoadValue(const gsstl::string& key) const override
+			{
+				std::map<std::string, std::string>::const_iterator value = values.find(key);
+				return value == values.end() ? "" : value->second;
+			}
+
+		private:
+			mutable std::map<std::string, std::string> values;
+	};
+
+	/// updates gs until it is available, the websocket handshake runs on a thread of easywsclient
+	inline bool WaitUntilAvailable(Core::GS& gs)
+	{
+		for (int i = 0; i != 1000 && !gs.GetAvailable(); ++i)
+		{
+			gs.Update(0.001f);
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		}
+		return gs.GetAvailable();
+	}
+
+}} /* namespace GameSparks.Tests */
+
+#endif /* _GAMESPARKS_TESTS_TESTPLATFORM_HPP_ */
@@ -0,0 +1,30 @@
+#ifndef _GAMESPARKS_TESTS_HPP_
+#define _GAMESPARKS_TESTS_HPP_
+
+#include <cstdio>
+
+namespace GameSparks { namespace Tests {
+
+	typedef bool (*TestFunction)();
+
+	/// adds a test to the ones run by GameSparksRTTests, see GS_TEST
+	struct Registration
+	{
+		Registration(const char* name, TestFunction test);
+	};
+
+	/// reports a failed GS_TEST_CHECK, returns false
+	bool Fail(const char* file, int line, const char* expression);
+
+}} /* namespace GameSparks.Tests */
+
+/// defines a test. the body returns true on success, GS_TEST_CHECK returns false from it on failure.
+#define GS_TEST(name) \
+	static bool name(); \
+	static ::GameSparks::Tests::Registration name##Registration(#name, &name); \
+	static bool name()
+
+#define GS_TEST_CHECK(expression) \
+	do { if (!(expression)) return ::GameSparks::Tests::Fail(__FILE__, __LINE__, #expression); } while (false)
+
+#endif /* _GAMESPARKS_TESTS_HPP_ */
@@ -0,0 +1,61 @@
+#ifndef _GAMESPARKS_TESTS_WEBSOCKETSERVERSTUB_HPP_
+#define _GAMESPARKS_TESTS_WEBSOCKETSERVERSTUB_HPP_
+
+#include <cstddef>
+#include <mutex>
+#include <string>
+#include <vector>
+
+class BaseSocket;
+
+namespace GameSparks { namespace Tests {
+
+	/*!
+		Stands in for the GameSparks websocket server, in memory: while one is alive, BaseSocket::create() returns sockets
+		that talk to it instead of the network, so GS, GSConnection and easywsclient run unchanged on top of it.
+
+		It answers the websocket upgrade, sends the nonce and accepts any .AuthenticatedConnectRequest, after which GS is
+		available. It records the text frames of the client in the order they arrive, but only responds to requests when
+		told to with Send(). LimitSend() stands in for a slow uplink: the client can only write as much as it was granted.
+	*/
+	class WebSocketServerStub
+	{
+		public:
+			WebSocketServerStub();
+			~WebSocketServerStub();
+
+			/// from now on, the client can send at most bytes until the next call. unlimited until the first call.
+			void LimitSend(std::size_t bytes);
+
+			/// the payloads of the text frames the client sent after the websocket upgrade, in order, from the first-th on
+			std::vector<std::string> Frames(std::size_t first = 0) const;
+
+			/// queues a text frame for the client, e.g. the response to one of its requests
+			void Send(const std::string& payload);
+
+			/// the bytes of the frames the client sent, including their headers
+			std::size_t ReceivedBytes() const;
+
+		private:
+			friend class ::BaseSocket; // BaseSocket::create() makes the sockets
+			class Socket;
+
+			void Write(const char* buf, std::size_t size); // from the client
+			int Read(char* buf, std::size_t size); // to the client
+			void ParseFrames(); // needs lock
+			void QueueFrame(const std::string& payload); // needs lock
+
+			mutable std::mutex lock;
+			bool upgraded; // guarded by lock
+			bool limited; // guarded by lock
+			std::size_t sendBudget; // guarded by lock
+			std::size_t receivedBytes; // guarded by lock
+			std::string request; // the http upgrade request, guarded by lock
+			std::vector<unsigned char> inbox; // client bytes not yet parsed, guarded by lock
+			std::vector<char> outbox; // server bytes not yet read by the client, guarded by lock
+			std::vector<std::string> frames; // guarded by lock
+	};
+
+}} /* namespace GameSparks.Tests */
+
+#endif /* _GAMESPARKS_TESTS_WEBSOCKETSERVERSTUB_HPP_ */